@@ -14,8 +14,13 @@
 
 #include <atomic>
 #include <functional>
+#include <memory>
 
 namespace ROOT {
+namespace Internal {
+class RTaskArenaWrapper;
+}
+
 namespace Experimental {
 
 class TTaskGroup {
@@ -29,6 +34,8 @@ class TTaskGroup {
    */
 private:
    void *fTaskContainer{nullptr};
+   /// The tasks are run in ROOT's global task arena, such that they respect the pool size set by EnableImplicitMT()
+   std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> fTaskArenaW;
    std::atomic<bool> fCanRun{true};
    void ExecuteInIsolation(const std::function<void(void)> &operation);
 
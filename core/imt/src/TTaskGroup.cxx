@@ -14,6 +14,8 @@
 #include "ROOT/TTaskGroup.hxx"
 
 #ifdef R__USE_IMT
+#include "ROOT/RTaskArena.hxx"
+#include "ROpaqueTaskArena.hxx"
 #include "TROOT.h"
 #include "tbb/task_group.h"
 #include "tbb/task_arena.h"
@@ -59,6 +61,7 @@ TTaskGroup::TTaskGroup()
    if (!ROOT::IsImplicitMTEnabled()) {
       throw std::runtime_error("Implicit parallelism not enabled. Cannot instantiate a TTaskGroup.");
    }
+   fTaskArenaW = ROOT::Internal::GetGlobalTaskArena();
    fTaskContainer = ((void *)new tbb::task_group());
 #endif
 }
@@ -72,6 +75,7 @@ TTaskGroup &TTaskGroup::operator=(TTaskGroup &&other)
 {
    fTaskContainer = other.fTaskContainer;
    other.fTaskContainer = nullptr;
+   fTaskArenaW = std::move(other.fTaskArenaW);
    fCanRun.store(other.fCanRun);
    return *this;
 }
@@ -86,6 +90,18 @@ TTaskGroup::~TTaskGroup()
 #endif
 }
 
+/////////////////////////////////////////////////////////////////////////////
+/// Run operation inside ROOT's task arena. Tasks spawned by the operation are thus
+/// executed by the worker threads of the arena.
+void TTaskGroup::ExecuteInIsolation(const std::function<void(void)> &operation)
+{
+#ifdef R__USE_IMT
+   fTaskArenaW->Access().execute([&] { operation(); });
+#else
+   operation();
+#endif
+}
+
 /////////////////////////////////////////////////////////////////////////////
 /// Cancel all submitted tasks immediately.
 void TTaskGroup::Cancel()
@@ -111,7 +127,7 @@ void TTaskGroup::Run(const std::function<void(void)> &closure)
    while (!fCanRun)
       /* empty */;
 
-   CastToTG(fTaskContainer)->run(closure);
+   ExecuteInIsolation([&] { CastToTG(fTaskContainer)->run(closure); });
 #else
    closure();
 #endif
@@ -124,7 +140,7 @@ void TTaskGroup::Wait()
 {
 #ifdef R__USE_IMT
    fCanRun = false;
-   CastToTG(fTaskContainer)->wait();
+   ExecuteInIsolation([&] { CastToTG(fTaskContainer)->wait(); });
    fCanRun = true;
 #endif
 }
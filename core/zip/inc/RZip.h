@@ -29,6 +29,10 @@ extern "C" void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, in
  */
 extern "C" void R__zip(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 
+/**
+ * Sets *irep to the number of uncompressed bytes, or to 0 on error. Blocks compressed with a zstd dictionary (header
+ * "ZD") can not be uncompressed here and also yield 0; see ROOT::Internal::RZSTDDictionary::IsDictionaryHeader.
+ */
 extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
 
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
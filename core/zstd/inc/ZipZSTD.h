@@ -19,6 +19,47 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
 #ifdef __cplusplus
 }
+
+#include <cstddef>
+
+namespace ROOT {
+namespace Internal {
+
+/// A zstd dictionary for compressing many small buffers with similar content, e.g. the baskets of a TTree branch.
+/// The dictionary is digested once on construction; Zip() and Unzip() can then be called concurrently. Buffers
+/// compressed with a dictionary carry a different header ("ZD") than the plain zstd ones, such that R__unzip()
+/// refuses them instead of producing garbage.
+class RZSTDDictionary {
+   void *fCDict = nullptr; ///< ZSTD_CDict, only created for a positive compression level
+   void *fDDict = nullptr; ///< ZSTD_DDict
+   int fCompressionLevel = 0;
+
+public:
+   /// Digest the dictionary `content` of `size` bytes; `cxlevel` is the ROOT compression level used by Zip(), if it
+   /// is 0 the dictionary can only be used for decompression.
+   RZSTDDictionary(const char *content, std::size_t size, int cxlevel);
+   RZSTDDictionary(const RZSTDDictionary &) = delete;
+   RZSTDDictionary &operator=(const RZSTDDictionary &) = delete;
+   ~RZSTDDictionary();
+
+   bool IsValid() const { return fDDict != nullptr; }
+   int GetCompressionLevel() const { return fCompressionLevel; }
+
+   /// Same interface as R__zipZSTD, the compression level is the one given to the constructor.
+   void Zip(int *srcsize, char *src, int *tgtsize, char *tgt, int *irep) const;
+   /// Same interface as R__unzipZSTD, for buffers produced by Zip() with the same dictionary.
+   void Unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep) const;
+
+   /// Train a dictionary of at most `capacity` bytes into `content` from `nSamples` samples, stored back-to-back in
+   /// `samples`. Returns the size of the dictionary, or 0 if the samples are not suitable for training.
+   static std::size_t Train(char *content, std::size_t capacity, const char *samples, const std::size_t *sampleSizes,
+                            unsigned nSamples);
+   /// Whether the compressed block starting at `src` was compressed with a dictionary.
+   static bool IsDictionaryHeader(const unsigned char *src) { return src[0] == 'Z' && src[1] == 'D'; }
+};
+
+} // namespace Internal
+} // namespace ROOT
 #endif
 
 #endif
@@ -22,6 +22,19 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
+static void R__writeZSTDHeader(char *tgt, char method, size_t deflate_size, size_t inflate_size)
+{
+    tgt[0] = 'Z';
+    tgt[1] = method;
+    tgt[2] = '\1';
+    tgt[3] = deflate_size & 0xff;
+    tgt[4] = (deflate_size >> 8) & 0xff;
+    tgt[5] = (deflate_size >> 16) & 0xff;
+    tgt[6] = inflate_size & 0xff;
+    tgt[7] = (inflate_size >> 8) & 0xff;
+    tgt[8] = (inflate_size >> 16) & 0xff;
+}
+
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
@@ -45,17 +58,7 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
         *irep = static_cast<size_t>(retval + kHeaderSize);
     }
 
-    size_t deflate_size = retval;
-    size_t inflate_size = static_cast<size_t>(*srcsize);
-    tgt[0] = 'Z';
-    tgt[1] = 'S';
-    tgt[2] = '\1';
-    tgt[3] = deflate_size & 0xff;
-    tgt[4] = (deflate_size >> 8) & 0xff;
-    tgt[5] = (deflate_size >> 16) & 0xff;
-    tgt[6] = inflate_size & 0xff;
-    tgt[7] = (inflate_size >> 8) & 0xff;
-    tgt[8] = (inflate_size >> 16) & 0xff;
+    R__writeZSTDHeader(tgt, 'S', retval, static_cast<size_t>(*srcsize));
 }
 
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
@@ -95,3 +98,88 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
         *irep = retval;
     }
 }
+
+ROOT::Internal::RZSTDDictionary::RZSTDDictionary(const char *content, std::size_t size, int cxlevel)
+    : fCompressionLevel(cxlevel)
+{
+    if (cxlevel > 0)
+        fCDict = ZSTD_createCDict(content, size, 2 * cxlevel);
+    fDDict = ZSTD_createDDict(content, size);
+}
+
+ROOT::Internal::RZSTDDictionary::~RZSTDDictionary()
+{
+    ZSTD_freeCDict(static_cast<ZSTD_CDict *>(fCDict));
+    ZSTD_freeDDict(static_cast<ZSTD_DDict *>(fDDict));
+}
+
+void ROOT::Internal::RZSTDDictionary::Zip(int *srcsize, char *src, int *tgtsize, char *tgt, int *irep) const
+{
+    *irep = 0;
+    if (R__unlikely(!fCDict)) {
+        std::cerr << "Error in zip ZSTD with dictionary: the dictionary was not digested for compression" << std::endl;
+        return;
+    }
+
+    using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
+    Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+
+    size_t retval = ZSTD_compress_usingCDict(fCtx.get(),
+                                             &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                             src, static_cast<size_t>(*srcsize),
+                                             static_cast<const ZSTD_CDict *>(fCDict));
+
+    if (R__unlikely(ZSTD_isError(retval))) {
+        if (R__unlikely(retval != errorCodeSmallBuffer)) {
+            std::cerr << "Error in zip ZSTD with dictionary. Type = " << ZSTD_getErrorName(retval) <<
+            " . Code = " << retval << std::endl;
+        }
+        return;
+    }
+    *irep = static_cast<size_t>(retval + kHeaderSize);
+    R__writeZSTDHeader(tgt, 'D', retval, static_cast<size_t>(*srcsize));
+}
+
+void ROOT::Internal::RZSTDDictionary::Unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt,
+                                            int *irep) const
+{
+    *irep = 0;
+
+    if (R__unlikely(!IsDictionaryHeader(src))) {
+      std::cerr << "R__unzipZSTD: algorithm run against buffer with incorrect header (got " <<
+      src[0] << src[1] << "; expected ZD)." << std::endl;
+      return;
+    }
+
+    int ZSTD_version =  ZSTD_versionNumber() / (100 * 100);
+    if (R__unlikely(src[2] != ZSTD_version)) {
+      std::cerr << "R__unzipZSTD: This version of ZSTD is incompatible with the on-disk version "
+      "got "<< src[2] << "; expected "<< ZSTD_version << ")" << std::endl;
+      return;
+    }
+
+    using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
+    Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+
+    size_t retval = ZSTD_decompress_usingDDict(fCtx.get(),
+                                               (char *)tgt, static_cast<size_t>(*tgtsize),
+                                               (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize),
+                                               static_cast<const ZSTD_DDict *>(fDDict));
+
+    if (R__unlikely(ZSTD_isError(retval))) {
+        std::cerr << "Error in unzip ZSTD with dictionary. Type = " << ZSTD_getErrorName(retval) <<
+        " . Code = " << retval << std::endl;
+        return;
+    }
+    *irep = retval;
+}
+
+std::size_t ROOT::Internal::RZSTDDictionary::Train(char *content, std::size_t capacity, const char *samples,
+                                                   const std::size_t *sampleSizes, unsigned nSamples)
+{
+    size_t retval = ZDICT_trainFromBuffer(content, capacity, samples, sampleSizes, nSamples);
+    // Typically not enough or too uniform samples; the caller is expected to carry on without a dictionary.
+    if (ZDICT_isError(retval))
+        return 0;
+    return retval;
+}
@@ -54,6 +54,13 @@ class TVirtualFFT;
 class TVirtualHistPainter;
 class TRandom;
 
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+class RSharedHistoFill;
+}
+}
+}
 
 class TH1 : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
@@ -83,6 +90,7 @@ public:
    };
 
    friend class TH1Merger;
+   friend class ROOT::Internal::RDF::RSharedHistoFill; // follows the statistics rules of Fill() when filling concurrently
 
 protected:
     Int_t         fNcells;          ///<  Number of bins(1D), cells (2D) +U/Overflows
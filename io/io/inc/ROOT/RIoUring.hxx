@@ -9,10 +9,12 @@
 #ifndef ROOT_RIoUring
 #define ROOT_RIoUring
 
+#include <cerrno>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <liburing.h>
 #include <liburing/io_uring.h>
@@ -26,6 +28,10 @@ class RIoUring {
 private:
    struct io_uring fRing;
    std::uint32_t fDepth = 0;
+   /// Number of prepared submission queue entries not yet handed to the kernel
+   std::uint32_t fNPrepared = 0;
+   /// Number of submitted events whose completion has not yet been reaped
+   std::uint32_t fNInFlight = 0;
 
 public:
    // Create an io_uring instance. The ring selects an appropriate queue depth. which can be queried
@@ -94,6 +100,96 @@ public:
       int fFileDes = -1;
    };
 
+   /// Completion of an asynchronous read, see PrepareRead() and Reap()
+   struct RCompletion {
+      /// The user data given to PrepareRead()
+      void *fUserData = nullptr;
+      /// The number of read bytes or, if negative, the error number
+      int fResult = 0;
+   };
+
+   /// Number of events that are prepared or submitted and not yet reaped
+   std::uint32_t GetNInFlight() const { return fNPrepared + fNInFlight; }
+
+   /// Puts a read event into the submission queue without submitting it to the kernel. Returns false if the queue
+   /// is full, i.e. if the number of in-flight events reached the queue depth. The user data is returned as part of
+   /// the read's completion. Together with Submit() and Reap(), the ring can be used as a long-lived, asynchronous
+   /// read queue.
+   bool PrepareRead(int fileDes, void *buffer, std::size_t size, std::uint64_t offset, void *userData)
+   {
+      if (GetNInFlight() >= fDepth)
+         return false;
+      struct io_uring_sqe *sqe = io_uring_get_sqe(&fRing);
+      if (!sqe)
+         return false;
+      io_uring_prep_read(sqe, fileDes, buffer, size, offset);
+      sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
+      io_uring_sqe_set_data(sqe, userData);
+      fNPrepared++;
+      return true;
+   }
+
+   /// Puts a request to cancel the submitted read event with the given user data into the submission queue. Returns
+   /// false if the queue is full. The cancel request completes with null user data; the read, if it was still pending,
+   /// completes with -ECANCELED.
+   bool PrepareCancel(void *userData)
+   {
+      if (GetNInFlight() >= fDepth)
+         return false;
+      struct io_uring_sqe *sqe = io_uring_get_sqe(&fRing);
+      if (!sqe)
+         return false;
+      io_uring_prep_cancel(sqe, userData, 0 /* no flags */);
+      io_uring_sqe_set_data(sqe, nullptr);
+      fNPrepared++;
+      return true;
+   }
+
+   /// Hands all prepared events to the kernel without waiting for their completion
+   void Submit()
+   {
+      if (fNPrepared == 0)
+         return;
+      int submitted = io_uring_submit(&fRing);
+      if (submitted < 0) {
+         throw std::runtime_error("ring submit failed, error: " + std::string(std::strerror(-submitted)));
+      }
+      fNPrepared -= submitted;
+      fNInFlight += submitted;
+   }
+
+   /// Blocks until at least `minCompleted` submitted events completed and appends the completions to `completions`.
+   /// Completions that are available without blocking are collected, too. Events can complete in any order.
+   void Reap(unsigned int minCompleted, std::vector<RCompletion> &completions)
+   {
+      if (minCompleted > fNInFlight) {
+         throw std::runtime_error("waiting for " + std::to_string(minCompleted) + " completions but only " +
+                                  std::to_string(fNInFlight) + " events are in flight");
+      }
+      unsigned int nReaped = 0;
+      struct io_uring_cqe *cqe;
+      while (fNInFlight > 0) {
+         int ret;
+         if (nReaped < minCompleted) {
+            ret = io_uring_wait_cqe(&fRing, &cqe);
+            if (ret == -EINTR)
+               continue;
+            if (ret < 0)
+               throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
+         } else {
+            ret = io_uring_peek_cqe(&fRing, &cqe);
+            if (ret == -EAGAIN)
+               break;
+            if (ret < 0)
+               throw std::runtime_error("peek cqe failed, error: " + std::string(std::strerror(-ret)));
+         }
+         completions.push_back(RCompletion{io_uring_cqe_get_data(cqe), cqe->res});
+         io_uring_cqe_seen(&fRing, cqe);
+         fNInFlight--;
+         nReaped++;
+      }
+   }
+
    /// Submit a number of read events and wait for completion. Events are submitted in batches if
    /// the number of events is larger than the submission queue depth.
    void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -108,6 +109,10 @@ private:
    std::uint64_t fFileSize;
    /// Files are opened lazily and only when required; the open state is kept by this flag
    bool fIsOpen;
+   /// Number of requests passed to SubmitReadV() that have not yet been returned by ReapReadV()
+   std::size_t fNPendingReads = 0;
+   /// Used by the default, synchronous implementation of the asynchronous read interface
+   std::vector<RIOVec *> fCompletedReads;
 
 protected:
    std::string fUrl;
@@ -137,6 +142,12 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// Derived classes with kFeatureHasAsyncIo queue the requests and return immediately. The default implementation
+   /// reads synchronously through ReadVImpl() and marks the requests as completed.
+   virtual void SubmitReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// Waits for at least minCompleted of the submitted requests, which is guaranteed to be no more than the number
+   /// of pending requests, and returns all the completed requests
+   virtual std::vector<RIOVec *> ReapReadVImpl(unsigned int minCompleted);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -172,6 +183,16 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Asynchronous version of ReadV(): submits the requests and returns without waiting for the data. The I/O vector
+   /// elements and their buffers must stay valid until the requests are returned by ReapReadV(). Requests can be
+   /// submitted while others are still pending, e.g. to read the next cluster while the current one is decompressed.
+   /// Without kFeatureHasAsyncIo, the requests are read synchronously.
+   void SubmitReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Blocks until at least minCompleted of the pending requests (or all of them, if fewer are pending) are completed
+   /// and returns the completed requests with fOutBytes set. Requests complete in any order.
+   std::vector<RIOVec *> ReapReadV(unsigned int minCompleted = 1);
+   /// The number of submitted requests that have not yet been returned by ReapReadV()
+   std::size_t GetNPendingReads() const { return fNPendingReads; }
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
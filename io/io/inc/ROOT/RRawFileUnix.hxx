@@ -17,6 +17,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -31,11 +33,25 @@ namespace Internal {
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes;
+   /// The long-lived io_uring instance and the requests waiting for a free submission slot; only used if ROOT is
+   /// built with io_uring support. Created on the first vector read.
+   struct RIoUringState;
+   std::unique_ptr<RIoUringState> fIoUringState;
+
+   /// Returns the io_uring state or nullptr if io_uring is not available
+   RIoUringState *GetIoUringState();
+   /// Moves as many waiting requests as possible into the submission queue and submits them
+   void SubmitWaitingReads();
+   /// Cancels the given requests of a failed vector read and waits until the kernel is done with all of them, so that
+   /// their buffers are not written to anymore
+   void CancelReads(RIOVec *ioVec, unsigned int nReq);
 
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   void SubmitReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::vector<RIOVec *> ReapReadVImpl(unsigned int minCompleted) final;
    std::uint64_t GetSizeImpl() final;
    void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset) final;
    void UnmapImpl(void *region, size_t nbytes) final;
@@ -109,6 +109,20 @@ void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    }
 }
 
+void ROOT::Internal::RRawFile::SubmitReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   ReadVImpl(ioVec, nReq);
+   for (unsigned i = 0; i < nReq; ++i)
+      fCompletedReads.emplace_back(&ioVec[i]);
+}
+
+std::vector<ROOT::Internal::RRawFile::RIOVec *> ROOT::Internal::RRawFile::ReapReadVImpl(unsigned int /* minCompleted */)
+{
+   std::vector<RIOVec *> result;
+   std::swap(result, fCompletedReads);
+   return result;
+}
+
 void ROOT::Internal::RRawFile::UnmapImpl(void * /* region */, size_t /* nbytes */)
 {
    throw std::runtime_error("Memory mapping unsupported");
@@ -216,6 +230,25 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    ReadVImpl(ioVec, nReq);
 }
 
+void ROOT::Internal::RRawFile::SubmitReadV(RIOVec *ioVec, unsigned int nReq)
+{
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   SubmitReadVImpl(ioVec, nReq);
+   fNPendingReads += nReq;
+}
+
+std::vector<ROOT::Internal::RRawFile::RIOVec *> ROOT::Internal::RRawFile::ReapReadV(unsigned int minCompleted)
+{
+   if (fNPendingReads == 0)
+      return {};
+   auto result = ReapReadVImpl(std::min<std::size_t>(minCompleted, fNPendingReads));
+   R__ASSERT(result.size() <= fNPendingReads);
+   fNPendingReads -= result.size();
+   return result;
+}
+
 bool ROOT::Internal::RRawFile::Readln(std::string &line)
 {
    if (fOptions.fLineBreak == ELineBreaks::kAuto) {
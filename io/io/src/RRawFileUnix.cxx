@@ -18,8 +18,10 @@
 
 #include "TError.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -35,6 +37,14 @@ namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
 } // anonymous namespace
 
+struct ROOT::Internal::RRawFileUnix::RIoUringState {
+#ifdef R__HAS_URING
+   RIoUring fRing;
+   /// Requests that did not fit into the submission queue, submitted as soon as completions free up slots
+   std::deque<RIOVec *> fWaiting;
+#endif
+};
+
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options)
    : RRawFile(url, options), fFileDes(-1)
 {
@@ -42,6 +52,15 @@ ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions option
 
 ROOT::Internal::RRawFileUnix::~RRawFileUnix()
 {
+#ifdef R__HAS_URING
+   // Buffers of requests still in flight must not be written to after the owner of the file is gone
+   if (fIoUringState) {
+      std::vector<RIoUring::RCompletion> completions;
+      fIoUringState->fWaiting.clear();
+      fIoUringState->fRing.Submit();
+      fIoUringState->fRing.Reap(fIoUringState->fRing.GetNInFlight(), completions);
+   }
+#endif
    if (fFileDes >= 0)
       close(fFileDes);
 }
@@ -52,7 +71,11 @@ std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileUnix::Clone()
 }
 
 int ROOT::Internal::RRawFileUnix::GetFeatures() const {
+#ifdef R__HAS_URING
+   return kFeatureHasSize | kFeatureHasMmap | kFeatureHasAsyncIo;
+#else
    return kFeatureHasSize | kFeatureHasMmap;
+#endif
 }
 
 std::uint64_t ROOT::Internal::RRawFileUnix::GetSizeImpl()
@@ -112,36 +135,132 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
    }
 }
 
-void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+ROOT::Internal::RRawFileUnix::RIoUringState *ROOT::Internal::RRawFileUnix::GetIoUringState()
 {
 #ifdef R__HAS_URING
    thread_local bool uring_failed = false;
-   if (!uring_failed) {
+   if (!fIoUringState && !uring_failed) {
       try {
-         RIoUring ring; // throws std::runtime_error
-         std::vector<RIoUring::RReadEvent> reads;
-         reads.reserve(nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            RIoUring::RReadEvent ev;
-            ev.fBuffer = ioVec[i].fBuffer;
-            ev.fOffset = ioVec[i].fOffset;
-            ev.fSize = ioVec[i].fSize;
-            ev.fFileDes = fFileDes;
-            reads.push_back(ev);
-         }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            ioVec[i].fOutBytes = reads.at(i).fOutBytes;
-         }
-         return;
-      }
-      catch(const std::runtime_error &e) {
+         // The ring is kept for the lifetime of the file so that its setup cost is paid only once
+         fIoUringState = std::make_unique<RIoUringState>(); // throws std::runtime_error
+      } catch (const std::runtime_error &e) {
          Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
-         Warning("RRawFileUnix",
-              "io_uring setup failed, falling back to blocking I/O in ReadV");
+         Warning("RRawFileUnix", "io_uring setup failed, falling back to blocking I/O in ReadV");
          uring_failed = true;
       }
    }
+#endif
+   return fIoUringState.get();
+}
+
+void ROOT::Internal::RRawFileUnix::SubmitWaitingReads()
+{
+#ifdef R__HAS_URING
+   auto &ring = fIoUringState->fRing;
+   auto &waiting = fIoUringState->fWaiting;
+   while (!waiting.empty()) {
+      auto req = waiting.front();
+      if (!ring.PrepareRead(fFileDes, req->fBuffer, req->fSize, req->fOffset, req))
+         break;
+      waiting.pop_front();
+   }
+   ring.Submit();
+#endif
+}
+
+void ROOT::Internal::RRawFileUnix::CancelReads(RIOVec *ioVec, unsigned int nReq)
+{
+#ifdef R__HAS_URING
+   auto &ring = fIoUringState->fRing;
+   fIoUringState->fWaiting.clear();
+   std::vector<RIoUring::RCompletion> completions;
+   try {
+      for (unsigned int i = 0; i < nReq; ++i) {
+         while (!ring.PrepareCancel(&ioVec[i])) {
+            // The submission queue is full, wait for a free slot
+            ring.Submit();
+            ring.Reap(1, completions);
+         }
+      }
+      ring.Submit();
+      ring.Reap(ring.GetNInFlight(), completions);
+   } catch (const std::runtime_error &e) {
+      Fatal("RRawFileUnix", "cannot cancel the reads of a failed vector read:\n%s", e.what());
+   }
+#else
+   (void)ioVec;
+   (void)nReq;
+#endif
+}
+
+void ROOT::Internal::RRawFileUnix::SubmitReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+#ifdef R__HAS_URING
+   if (GetIoUringState()) {
+      for (unsigned int i = 0; i < nReq; ++i)
+         fIoUringState->fWaiting.emplace_back(&ioVec[i]);
+      SubmitWaitingReads();
+      return;
+   }
+#endif
+   RRawFile::SubmitReadVImpl(ioVec, nReq);
+}
+
+std::vector<ROOT::Internal::RRawFile::RIOVec *> ROOT::Internal::RRawFileUnix::ReapReadVImpl(unsigned int minCompleted)
+{
+#ifdef R__HAS_URING
+   if (fIoUringState) {
+      std::vector<RIOVec *> result;
+      std::vector<RIoUring::RCompletion> completions;
+      while (result.size() < minCompleted) {
+         completions.clear();
+         auto &ring = fIoUringState->fRing;
+         ring.Reap(std::min<std::size_t>(minCompleted - result.size(), ring.GetNInFlight()), completions);
+         for (const auto &c : completions) {
+            auto req = reinterpret_cast<RIOVec *>(c.fUserData);
+            if (c.fResult < 0) {
+               throw std::runtime_error("Cannot read from '" + fUrl +
+                                        "', error: " + std::string(std::strerror(-c.fResult)));
+            }
+            req->fOutBytes = static_cast<std::size_t>(c.fResult);
+            result.emplace_back(req);
+         }
+         // Completions freed submission slots
+         SubmitWaitingReads();
+      }
+      return result;
+   }
+#endif
+   return RRawFile::ReapReadVImpl(minCompleted);
+}
+
+void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+#ifdef R__HAS_URING
+   // Reuse the long-lived ring unless asynchronous requests are in flight, whose completions must not be mixed
+   // with the ones of the synchronous vector read
+   if ((GetNPendingReads() == 0) && GetIoUringState()) {
+      // The submitted requests point into ioVec and into the caller's buffers: if a read fails, the other requests
+      // are cancelled and drained before the exception propagates
+      struct RCancelGuard {
+         RRawFileUnix &fFile;
+         RIOVec *fIoVec;
+         unsigned int fNReq;
+         bool fIsDone;
+         ~RCancelGuard()
+         {
+            if (!fIsDone)
+               fFile.CancelReads(fIoVec, fNReq);
+         }
+      } cancelGuard{*this, ioVec, nReq, false};
+
+      SubmitReadVImpl(ioVec, nReq);
+      unsigned int nCompleted = 0;
+      while (nCompleted < nReq)
+         nCompleted += ReapReadVImpl(nReq - nCompleted).size();
+      cancelGuard.fIsDone = true;
+      return;
+   }
 #endif
    RRawFile::ReadVImpl(ioVec, nReq);
 }
@@ -68,6 +68,116 @@ static inline bool Class_Has_StreamerInfo(const TClass* cl)
    return cl->GetStreamerInfos()->GetLast()>1;
 }
 
+namespace {
+
+// Array kernels for the compressed floating point representations of Float16_t and Double32_t, see
+// TBufferFile::WriteFloat16(). The values are (de)serialized one byte at a time in big endian order and every iteration
+// is independent of the others and free of branches, so that the compiler can vectorize the loops.
+
+inline UInt_t LoadBigEndian32(const UChar_t *in)
+{
+   return (UInt_t(in[0]) << 24) | (UInt_t(in[1]) << 16) | (UInt_t(in[2]) << 8) | UInt_t(in[3]);
+}
+
+inline void StoreBigEndian32(UInt_t x, UChar_t *out)
+{
+   out[0] = UChar_t(x >> 24);
+   out[1] = UChar_t(x >> 16);
+   out[2] = UChar_t(x >> 8);
+   out[3] = UChar_t(x);
+}
+
+inline Float_t BitsToFloat(UInt_t bits)
+{
+   Float_t x;
+   memcpy(&x, &bits, sizeof(x));
+   return x;
+}
+
+inline UInt_t FloatToBits(Float_t x)
+{
+   UInt_t bits;
+   memcpy(&bits, &x, sizeof(bits));
+   return bits;
+}
+
+/// Decode n values stored as 32 bit integers in the range given by factor and minvalue.
+template <typename T>
+void DecodeWithFactor(const char *buf, T *out, Int_t n, Double_t factor, Double_t minvalue)
+{
+   const UChar_t *in = reinterpret_cast<const UChar_t *>(buf);
+   for (Int_t i = 0; i < n; ++i)
+      out[i] = (T)(LoadBigEndian32(in + 4 * i) / factor + minvalue);
+}
+
+/// Decode n floats stored as an exponent byte followed by the sign and the nbits truncated mantissa in 16 bits.
+template <typename T>
+void DecodeWithNbits(const char *buf, T *out, Int_t n, Int_t nbits)
+{
+   const UChar_t *in = reinterpret_cast<const UChar_t *>(buf);
+   const UInt_t manMask = (1u << (nbits + 1)) - 1;
+   const UInt_t signBit = 1u << (nbits + 1);
+   for (Int_t i = 0; i < n; ++i) {
+      const UInt_t theExp = in[3 * i];
+      const UInt_t theMan = (UInt_t(in[3 * i + 1]) << 8) | UInt_t(in[3 * i + 2]);
+      // Moving the stored sign to bit 31 is the same as negating the rebuilt float.
+      const UInt_t bits = (theExp << 23) | ((theMan & manMask) << (23 - nbits)) | ((theMan & signBit) << (30 - nbits));
+      out[i] = (T)BitsToFloat(bits);
+   }
+}
+
+/// Decode n floats into doubles.
+inline void DecodeFloats(const char *buf, Double_t *out, Int_t n)
+{
+   const UChar_t *in = reinterpret_cast<const UChar_t *>(buf);
+   for (Int_t i = 0; i < n; ++i)
+      out[i] = (Double_t)BitsToFloat(LoadBigEndian32(in + 4 * i));
+}
+
+/// Encode n values as 32 bit integers in the range [xmin, xmax], the values outside are clamped.
+template <typename T>
+void EncodeWithFactor(const T *in, char *buf, Int_t n, Double_t factor, Double_t xmin, Double_t xmax)
+{
+   UChar_t *out = reinterpret_cast<UChar_t *>(buf);
+   for (Int_t i = 0; i < n; ++i) {
+      T x = in[i];
+      x = (x < xmin) ? (T)xmin : x;
+      x = (x > xmax) ? (T)xmax : x;
+      StoreBigEndian32(UInt_t(0.5 + factor * (x - xmin)), out + 4 * i);
+   }
+}
+
+/// Encode n values as floats with their mantissa rounded to nbits, see TBufferFile::WriteFloat16().
+template <typename T>
+void EncodeWithNbits(const T *in, char *buf, Int_t n, Int_t nbits)
+{
+   UChar_t *out = reinterpret_cast<UChar_t *>(buf);
+   const UInt_t manMask = (1u << (nbits + 1)) - 1;
+   const UInt_t manMax = (1u << nbits) - 1;
+   const UInt_t signBit = 1u << (nbits + 1);
+   for (Int_t i = 0; i < n; ++i) {
+      const Float_t x = (Float_t)in[i];
+      const UInt_t bits = FloatToBits(x);
+      const UInt_t theExp = (bits >> 23) & 0xff;
+      UInt_t theMan = (((bits >> (22 - nbits)) & manMask) + 1) >> 1;
+      theMan = (theMan & (1u << nbits)) ? manMax : theMan;
+      theMan |= (x < 0) ? signBit : 0u;
+      out[3 * i] = UChar_t(theExp);
+      out[3 * i + 1] = UChar_t(theMan >> 8);
+      out[3 * i + 2] = UChar_t(theMan);
+   }
+}
+
+/// Encode n doubles as floats.
+inline void EncodeFloats(const Double_t *in, char *buf, Int_t n)
+{
+   UChar_t *out = reinterpret_cast<UChar_t *>(buf);
+   for (Int_t i = 0; i < n; ++i)
+      StoreBigEndian32(FloatToBits((Float_t)in[i]), out + 4 * i);
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create an I/O buffer object. Mode should be either TBuffer::kRead or
 /// TBuffer::kWrite. By default the I/O buffer has a size of
@@ -1418,33 +1528,11 @@ void TBufferFile::ReadFastArrayFloat16(Float_t *f, Int_t n, TStreamerElement *el
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a float
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; f[j] = (Float_t)(aint/factor + xmin);
-      }
+      ReadFastArrayWithFactor(f, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
-      if (!nbits) nbits = 12;
-      //we read the exponent and the truncated mantissa of the float
-      //and rebuild the new float.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         f[i] = fFloatValue;
-      }
+      ReadFastArrayWithNbits(f, n, nbits);
    }
 }
 
@@ -1457,9 +1545,8 @@ void TBufferFile::ReadFastArrayWithFactor(Float_t *ptr, Int_t n, Double_t factor
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a float
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; ptr[j] = (Float_t)(aint/factor + minvalue);
-   }
+   DecodeWithFactor(fBufCur, ptr, n, factor, minvalue);
+   fBufCur += sizeof(UInt_t)*n;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1473,21 +1560,8 @@ void TBufferFile::ReadFastArrayWithNbits(Float_t *ptr, Int_t n, Int_t nbits)
    if (!nbits) nbits = 12;
    //we read the exponent and the truncated mantissa of the float
    //and rebuild the new float.
-   union {
-      Float_t fFloatValue;
-      Int_t   fIntValue;
-   };
-   UChar_t  theExp;
-   UShort_t theMan;
-   for (Int_t i = 0; i < n; i++) {
-      *this >> theExp;
-      *this >> theMan;
-      fIntValue = theExp;
-      fIntValue <<= 23;
-      fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-      if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-      ptr[i] = fFloatValue;
-   }
+   DecodeWithNbits(fBufCur, ptr, n, nbits);
+   fBufCur += 3*n;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1500,41 +1574,11 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a double.
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + xmin);
-      }
+      ReadFastArrayWithFactor(d, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
-      if (!nbits) {
-         //we read a float and convert it to double
-         Float_t afloat;
-         for (i = 0; i < n; i++) {
-            *this >> afloat;
-            d[i] = (Double_t)afloat;
-         }
-      } else {
-         //we read the exponent and the truncated mantissa of the float
-         //and rebuild the double.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         UChar_t  theExp;
-         UShort_t theMan;
-         for (i = 0; i < n; i++) {
-            *this >> theExp;
-            *this >> theMan;
-            fIntValue = theExp;
-            fIntValue <<= 23;
-            fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-            if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-            d[i] = (Double_t)fFloatValue;
-         }
-      }
+      ReadFastArrayWithNbits(d, n, nbits);
    }
 }
 
@@ -1547,9 +1591,8 @@ void TBufferFile::ReadFastArrayWithFactor(Double_t *d, Int_t n, Double_t factor,
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a double.
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + minvalue);
-   }
+   DecodeWithFactor(fBufCur, d, n, factor, minvalue);
+   fBufCur += sizeof(UInt_t)*n;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1562,29 +1605,13 @@ void TBufferFile::ReadFastArrayWithNbits(Double_t *d, Int_t n, Int_t nbits)
 
    if (!nbits) {
       //we read a float and convert it to double
-      Float_t afloat;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> afloat;
-         d[i] = (Double_t)afloat;
-      }
+      DecodeFloats(fBufCur, d, n);
+      fBufCur += sizeof(Float_t)*n;
    } else {
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the double.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         d[i] = (Double_t)fFloatValue;
-      }
+      DecodeWithNbits(fBufCur, d, n, nbits);
+      fBufCur += 3*n;
    }
 }
 
@@ -2142,39 +2169,18 @@ void TBufferFile::WriteFastArrayFloat16(const Float_t *f, Int_t n, TStreamerElem
       //A range is specified. We normalize the float to the range and
       //convert it to an integer using a scaling factor that is a function of nbits.
       //see TStreamerElement::GetRange.
-      Double_t factor = ele->GetFactor();
-      Double_t xmin = ele->GetXmin();
-      Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Float_t x = f[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
-      }
+      EncodeWithFactor(f, fBufCur, n, ele->GetFactor(), ele->GetXmin(), ele->GetXmax());
+      fBufCur += sizeof(UInt_t)*n;
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
-      Int_t i;
       //a range is not specified, but nbits is.
       //In this case we truncate the mantissa to nbits and we stream
       //the exponent as a UChar_t and the mantissa as a UShort_t.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      for (i = 0; i < n; i++) {
-         fFloatValue = f[i];
-         UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-         UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-         theMan++;
-         theMan = theMan>>1;
-         if (theMan&1<<nbits) theMan = (1<<nbits) - 1;
-         if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-         *this << theExp;
-         *this << theMan;
-      }
+      EncodeWithNbits(f, fBufCur, n, nbits);
+      fBufCur += 3*n;
    }
 }
 
@@ -2193,45 +2199,22 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
       //A range is specified. We normalize the double to the range and
       //convert it to an integer using a scaling factor that is a function of nbits.
       //see TStreamerElement::GetRange.
-      Double_t factor = ele->GetFactor();
-      Double_t xmin = ele->GetXmin();
-      Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Double_t x = d[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
-      }
+      EncodeWithFactor(d, fBufCur, n, ele->GetFactor(), ele->GetXmin(), ele->GetXmax());
+      fBufCur += sizeof(UInt_t)*n;
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
-      Int_t i;
       if (!nbits) {
          //if no range and no bits specified, we convert from double to float
-         for (i = 0; i < n; i++) {
-            Float_t afloat = (Float_t)d[i];
-            *this << afloat;
-         }
+         EncodeFloats(d, fBufCur, n);
+         fBufCur += sizeof(Float_t)*n;
       } else {
          //a range is not specified, but nbits is.
          //In this case we truncate the mantissa to nbits and we stream
          //the exponent as a UChar_t and the mantissa as a UShort_t.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         for (i = 0; i < n; i++) {
-            fFloatValue = (Float_t)d[i];
-            UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-            UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-            theMan++;
-            theMan = theMan>>1;
-            if(theMan&1<<nbits) theMan = (1<<nbits) - 1;
-            if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-            *this << theExp;
-            *this << theMan;
-         }
+         EncodeWithNbits(d, fBufCur, n, nbits);
+         fBufCur += 3*n;
       }
    }
 }
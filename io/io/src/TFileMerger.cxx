@@ -374,16 +374,37 @@ Bool_t TFileMerger::Merge(Bool_t)
 
 namespace {
 
-/// Merge a list of RNTuples
-Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const TList& /* sources */) {
-   if (!rntupleHandle) {
+/// Merge a list of RNTuples. RNTuple::Merge() expects the ntuple name, the output file and the input files
+/// containing the ntuple, in this order.
+Long64_t MergeRNTuples(TClass *rntupleHandle, const char *ntupleName, TDirectory *target, const TList &sources,
+                       TFile *firstSource, TFileMergeInfo &info)
+{
+   if (!rntupleHandle || !rntupleHandle->GetMerge()) {
+      return Long64_t(-1);
+   }
+   if (target != target->GetFile()) {
+      Error("MergeRecursive", "merging RNTuples in sub directories is unsupported (key: %s)", ntupleName);
       return Long64_t(-1);
    }
-   // todo(max) implement rntuple merger
-   // [ ] build complete list of sources (some sources may actually be a directory with RNTuples inside)
-   // [ ] merge them
+
+   TObjString name(ntupleName);
+   TList inputs;
+   inputs.Add(&name);
+   inputs.Add(target->GetFile());
+   for (auto obj = firstSource ? firstSource : sources.First(); obj; obj = sources.After(obj)) {
+      auto file = dynamic_cast<TFile *>(obj);
+      if (file && file->FindKey(ntupleName))
+         inputs.Add(file);
+   }
+
+   // The merged ntuple is written directly to the output file by RNTuple::Merge(); the handle object only provides
+   // the entry point
+   void *handle = rntupleHandle->New();
    ROOT::MergeFunc_t func = rntupleHandle->GetMerge();
-   return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
+   auto result = func(handle, &inputs, &info);
+   rntupleHandle->Destructor(handle);
+   inputs.Clear("nodelete");
+   return result;
 }
 
 Bool_t IsMergeable(TClass *cl)
@@ -597,13 +618,18 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       // merge objects that don't derive from TObject
       if (std::string(keyclassname) == "ROOT::Experimental::RNTuple") {
          Warning("MergeRecursive", "merging RNTuples is experimental");
-         // todo(max): check if this works when a TDirectory is passed as the first
-         // input argument
-         Long64_t mergeResult = MergeRNTuples(cl, *path, *sourcelist);
+         Long64_t mergeResult = MergeRNTuples(cl, keyname, target, *sourcelist, current_file, info);
          if (mergeResult < 0) {
             Error("MergeRecursive", "error merging RNTuples");
             return kFALSE;
          }
+         // The merged RNTuple is already written to the target; the anchor read from the first input must not
+         // overwrite it
+         if (ownobj)
+            cl->Destructor(obj);
+         oldkeyname = keyname;
+         info.Reset();
+         return kTRUE;
       } else {
          TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
          Error("MergeRecursive", "Merging objects that don't inherit from TObject is unimplemented (key: %s of type %s in file %s)",
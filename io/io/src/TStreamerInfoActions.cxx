@@ -925,6 +925,26 @@ namespace TStreamerInfoActions
       return 0;
    }
 
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t ReadBasicArray_WithFactor(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      // Stream a fixed size array of Float16 or Double32 where a factor has been specified.
+
+      TConfWithFactor *conf = (TConfWithFactor *)config;
+      buf.ReadFastArrayWithFactor((T*)( ((char*)addr) + config->fOffset ), config->fCompInfo->fLength, conf->fFactor, conf->fXmin);
+      return 0;
+   }
+
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t ReadBasicArray_NoFactor(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      // Stream a fixed size array of Float16 or Double32 where a factor has not been specified.
+
+      TConfNoFactor *conf = (TConfNoFactor *)config;
+      buf.ReadFastArrayWithNbits((T*)( ((char*)addr) + config->fOffset ), config->fCompInfo->fLength, conf->fNbits);
+      return 0;
+   }
+
    INLINE_TEMPLATE_ARGS Int_t ReadTString(TBuffer &buf, void *addr, const TConfiguration *config)
    {
       // Read in a TString object.
@@ -2883,6 +2903,25 @@ static TConfiguredAction GetCollectionReadAction(TVirtualStreamerInfo *info, TSt
          }
          break;
       }
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat16: {
+         if (element->GetFactor() != 0) {
+            return TConfiguredAction( Looper::template ReadAction<ReadBasicArray_WithFactor<float> >, new TConfWithFactor(info,i,compinfo,offset,element->GetFactor(),element->GetXmin()) );
+         } else {
+            Int_t nbits = (Int_t)element->GetXmin();
+            if (!nbits) nbits = 12;
+            return TConfiguredAction( Looper::template ReadAction<ReadBasicArray_NoFactor<float> >, new TConfNoFactor(info,i,compinfo,offset,nbits) );
+         }
+         break;
+      }
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble32: {
+         // With nbits == 0, ReadFastArrayWithNbits reads floats and converts them to double.
+         if (element->GetFactor() != 0) {
+            return TConfiguredAction( Looper::template ReadAction<ReadBasicArray_WithFactor<double> >, new TConfWithFactor(info,i,compinfo,offset,element->GetFactor(),element->GetXmin()) );
+         } else {
+            return TConfiguredAction( Looper::template ReadAction<ReadBasicArray_NoFactor<double> >, new TConfNoFactor(info,i,compinfo,offset,(Int_t)element->GetXmin()) );
+         }
+         break;
+      }
       case TStreamerInfo::kTNamed:  return TConfiguredAction( Looper::template ReadAction<ReadTNamed >, new TConfiguration(info,i,compinfo,offset) );    break;
          // Idea: We should calculate the CanIgnoreTObjectStreamer here and avoid calling the
          // Streamer alltogether.
@@ -3312,6 +3351,25 @@ void TStreamerInfo::AddReadAction(TStreamerInfoActions::TActionSequence *readSeq
          }
          break;
       }
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat16: {
+         if (element->GetFactor() != 0) {
+            readSequence->AddAction( ReadBasicArray_WithFactor<float>, new TConfWithFactor(this,i,compinfo,compinfo->fOffset,element->GetFactor(),element->GetXmin()) );
+         } else {
+            Int_t nbits = (Int_t)element->GetXmin();
+            if (!nbits) nbits = 12;
+            readSequence->AddAction( ReadBasicArray_NoFactor<float>, new TConfNoFactor(this,i,compinfo,compinfo->fOffset,nbits) );
+         }
+         break;
+      }
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble32: {
+         // With nbits == 0, ReadFastArrayWithNbits reads floats and converts them to double.
+         if (element->GetFactor() != 0) {
+            readSequence->AddAction( ReadBasicArray_WithFactor<double>, new TConfWithFactor(this,i,compinfo,compinfo->fOffset,element->GetFactor(),element->GetXmin()) );
+         } else {
+            readSequence->AddAction( ReadBasicArray_NoFactor<double>, new TConfNoFactor(this,i,compinfo,compinfo->fOffset,(Int_t)element->GetXmin()) );
+         }
+         break;
+      }
       case TStreamerInfo::kTNamed:  readSequence->AddAction( ReadTNamed, new TConfiguration(this,i,compinfo,compinfo->fOffset) );    break;
          // Idea: We should calculate the CanIgnoreTObjectStreamer here and avoid calling the
          // Streamer alltogether.
@@ -43,6 +43,65 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, SubmitReapReadV)
+{
+   auto file = "test_uring_submitreadv";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'a')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+   EXPECT_TRUE(f->GetFeatures() & RRawFile::kFeatureHasAsyncIo);
+
+   auto nReq = 2000; // more requests than fit in the ring at once
+   auto iovecs = make_iovecs(nReq, filesize);
+   f->SubmitReadV(iovecs.data(), nReq);
+
+   // A synchronous vector read can be interleaved with the pending asynchronous requests
+   char buffer = 0;
+   RIOVec single;
+   single.fBuffer = &buffer;
+   single.fOffset = 0;
+   single.fSize = 1;
+   f->ReadV(&single, 1);
+   EXPECT_EQ('a', buffer);
+
+   std::size_t nCompleted = 0;
+   while (f->GetNPendingReads() > 0)
+      nCompleted += f->ReapReadV(100).size();
+   EXPECT_EQ(static_cast<std::size_t>(nReq), nCompleted);
+
+   for (auto iovec: iovecs) {
+      for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+         EXPECT_EQ('a', ((unsigned char*)iovec.fBuffer)[i]);
+      }
+      free(iovec.fBuffer);
+   }
+}
+
+TEST(RRawFileUnix, ReadVFailure)
+{
+   auto file = "test_uring_readvfailure";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'a')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+
+   auto nReq = 2000; // more requests than fit in the ring at once
+   auto iovecs = make_iovecs(nReq, filesize);
+   auto validBuffer = iovecs[10].fBuffer;
+   iovecs[10].fBuffer = nullptr; // fails with EFAULT
+   EXPECT_THROW(f->ReadV(iovecs.data(), nReq), std::runtime_error);
+   iovecs[10].fBuffer = validBuffer;
+
+   // The remaining requests of the failed read are cancelled or completed, the file can be read again
+   f->ReadV(iovecs.data(), nReq);
+   for (auto iovec: iovecs) {
+      EXPECT_GT(iovec.fOutBytes, 0u);
+      for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+         EXPECT_EQ('a', ((unsigned char*)iovec.fBuffer)[i]);
+      }
+      free(iovec.fBuffer);
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
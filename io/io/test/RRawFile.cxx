@@ -138,6 +138,39 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, SubmitReapReadV)
+{
+   FileRaii readvGuard("test_rawfile_submitreadv", "Hello, World");
+   auto f = RRawFile::Create("test_rawfile_submitreadv");
+
+   char buffer[2];
+   buffer[0] = buffer[1] = 0;
+   RRawFile::RIOVec iovec[2];
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 1;
+   iovec[1].fBuffer = &buffer[1];
+   iovec[1].fOffset = 11;
+   iovec[1].fSize = 2;
+   f->SubmitReadV(iovec, 2);
+   EXPECT_EQ(2U, f->GetNPendingReads());
+
+   std::vector<RRawFile::RIOVec *> completed;
+   while (f->GetNPendingReads() > 0) {
+      auto reaped = f->ReapReadV();
+      EXPECT_FALSE(reaped.empty());
+      completed.insert(completed.end(), reaped.begin(), reaped.end());
+   }
+   EXPECT_EQ(2U, completed.size());
+   EXPECT_TRUE(f->ReapReadV().empty());
+
+   EXPECT_EQ(1U, iovec[0].fOutBytes);
+   EXPECT_EQ(1U, iovec[1].fOutBytes);
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ('d', buffer[1]);
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
@@ -121,6 +121,139 @@ auto MapFromTuple(Tuple_t &&t, std::index_sequence<Is...>)
    return MapImpl(std::get<tupleSizeM1>(t), std::get<Is>(t)...);
 }
 
+/// Element-wise operations for which vectorized kernels exist, see BinaryKernel and CompareKernel.
+enum class EVecOp { kNone, kAdd, kSub, kMul, kDiv, kLess, kGreater, kLessEqual, kGreaterEqual, kEqual, kNotEqual };
+/// Which operands of an element-wise kernel are vectors. For a scalar operand only the pointed-to value is read.
+enum class EOperands { kVecVec, kVecScalar, kScalarVec };
+
+/// Vectors with fewer elements are processed by the inline loops, for which a kernel call would not pay off.
+constexpr std::size_t kMinKernelSize = 16;
+
+// Vectorized kernels for float and double, implemented in libROOTVecOps. At the first call the library selects the
+// kernels compiled for the best instruction set supported by the CPU, see GetKernelArchitecture.
+// The output buffer may be one of the inputs.
+void BinaryKernel(EVecOp op, EOperands operands, const float *x, const float *y, float *out, std::size_t n);
+void BinaryKernel(EVecOp op, EOperands operands, const double *x, const double *y, double *out, std::size_t n);
+void CompareKernel(EVecOp op, EOperands operands, const float *x, const float *y, int *out, std::size_t n);
+void CompareKernel(EVecOp op, EOperands operands, const double *x, const double *y, int *out, std::size_t n);
+void WhereKernel(EOperands operands, const int *c, const float *x, const float *y, float *out, std::size_t n);
+void WhereKernel(EOperands operands, const int *c, const double *x, const double *y, double *out, std::size_t n);
+void TakeKernel(const float *x, const std::size_t *idx, float *out, std::size_t n);
+void TakeKernel(const double *x, const std::size_t *idx, double *out, std::size_t n);
+void DeltaRKernel(const float *eta1, const float *eta2, const float *phi1, const float *phi2, float *out,
+                  std::size_t n, float c);
+void DeltaRKernel(const double *eta1, const double *eta2, const double *phi1, const double *phi2, double *out,
+                  std::size_t n, double c);
+/// inputs are the arrays of pt1, eta1, phi1, mass1, pt2, eta2, phi2 and mass2.
+void InvariantMassesKernel(const float *const *inputs, float *out, std::size_t n);
+void InvariantMassesKernel(const double *const *inputs, double *out, std::size_t n);
+/// Return the instruction set of the kernels in use: "AVX512", "AVX2" or "GENERIC".
+/// The choice can be forced with the `VecOps.SIMD` option of .rootrc.
+const char *GetKernelArchitecture();
+
+/// The type to which a scalar operand of an element-wise operation on a vector with values of type V is converted, so
+/// that a kernel for V can be used: V if the operation is computed in V anyway, e.g. for `RVecF * 2`, S otherwise.
+template <typename V, typename S, bool = std::is_floating_point<V>::value &&std::is_arithmetic<S>::value>
+struct KernelScalar {
+   using type = S;
+};
+
+template <typename V, typename S>
+struct KernelScalar<V, S, true> {
+   using type = typename std::conditional<std::is_same<typename std::common_type<V, S>::type, V>::value, V, S>::type;
+};
+
+template <typename V, typename S>
+using KernelScalar_t = typename KernelScalar<V, S>::type;
+
+// The Try*Kernel helpers run the corresponding kernel if there is one for the value types and if the vectors are long
+// enough, and return whether they did. Otherwise the caller runs its own loop.
+template <typename T0, typename T1, typename R>
+bool TryElementWiseKernel(EVecOp, EOperands, const T0 *, const T1 *, R *, std::size_t)
+{
+   return false;
+}
+
+template <typename T>
+bool TryWhereKernel(EOperands, const int *, const T *, const T *, T *, std::size_t)
+{
+   return false;
+}
+
+template <typename T>
+bool TryTakeKernel(const T *, const std::size_t *, T *, std::size_t)
+{
+   return false;
+}
+
+template <typename T>
+bool TryDeltaRKernel(const T *, const T *, const T *, const T *, T *, std::size_t, T)
+{
+   return false;
+}
+
+template <typename T>
+bool TryInvariantMassesKernel(const T *const *, T *, std::size_t)
+{
+   return false;
+}
+
+#define RVEC_KERNELS(T)                                                                                              \
+   inline bool TryElementWiseKernel(EVecOp op, EOperands operands, const T *x, const T *y, T *out, std::size_t n)   \
+   {                                                                                                                \
+      if (op == EVecOp::kNone || n < kMinKernelSize)                                                                \
+         return false;                                                                                              \
+      BinaryKernel(op, operands, x, y, out, n);                                                                     \
+      return true;                                                                                                  \
+   }                                                                                                                \
+   inline bool TryElementWiseKernel(EVecOp op, EOperands operands, const T *x, const T *y, int *out, std::size_t n) \
+   {                                                                                                                \
+      if (op == EVecOp::kNone || n < kMinKernelSize)                                                                \
+         return false;                                                                                              \
+      CompareKernel(op, operands, x, y, out, n);                                                                    \
+      return true;                                                                                                  \
+   }                                                                                                                \
+   inline bool TryWhereKernel(EOperands operands, const int *c, const T *x, const T *y, T *out, std::size_t n)      \
+   {                                                                                                                \
+      if (n < kMinKernelSize)                                                                                       \
+         return false;                                                                                              \
+      WhereKernel(operands, c, x, y, out, n);                                                                       \
+      return true;                                                                                                  \
+   }                                                                                                                \
+   inline bool TryTakeKernel(const T *x, const std::size_t *idx, T *out, std::size_t n)                             \
+   {                                                                                                                \
+      if (n < kMinKernelSize)                                                                                       \
+         return false;                                                                                              \
+      TakeKernel(x, idx, out, n);                                                                                   \
+      return true;                                                                                                  \
+   }                                                                                                                \
+   inline bool TryDeltaRKernel(const T *eta1, const T *eta2, const T *phi1, const T *phi2, T *out, std::size_t n,   \
+                               T c)                                                                                 \
+   {                                                                                                                \
+      if (n < kMinKernelSize)                                                                                       \
+         return false;                                                                                              \
+      DeltaRKernel(eta1, eta2, phi1, phi2, out, n, c);                                                              \
+      return true;                                                                                                  \
+   }                                                                                                                \
+   inline bool TryInvariantMassesKernel(const T *const *inputs, T *out, std::size_t n)                              \
+   {                                                                                                                \
+      if (n < kMinKernelSize)                                                                                       \
+         return false;                                                                                              \
+      InvariantMassesKernel(inputs, out, n);                                                                        \
+      return true;                                                                                                  \
+   }
+
+RVEC_KERNELS(float)
+RVEC_KERNELS(double)
+#undef RVEC_KERNELS
+
+/// Whether the Try*Kernel helpers run a kernel for vectors of n elements of type T.
+template <typename T>
+constexpr bool UseKernel(std::size_t n)
+{
+   return (std::is_same<T, float>::value || std::is_same<T, double>::value) && n >= kMinKernelSize;
+}
+
 /// Return the next power of two (in 64-bits) that is strictly greater than A.
 /// Return zero on overflow.
 inline uint64_t NextPowerOf2(uint64_t A)
@@ -1345,6 +1478,7 @@ to make RVec a drop-in replacement for `std::vector`.
 - [Owning and adopting memory](\ref owningandadoptingmemory)
 - [Sorting and manipulation of indices](\ref sorting)
 - [Usage in combination with RDataFrame](\ref usagetdataframe)
+- [Vectorized kernels](\ref vectorizedkernels)
 - [Reference for the RVec class](\ref RVecdoxyref)
 - [Reference for RVec helper functions](https://root.cern/doc/master/namespaceROOT_1_1VecOps.html)
 
@@ -1470,6 +1604,17 @@ auto hpt = d.Define("pt", "sqrt(pxs * pxs + pys * pys)[E>200]")
             .Histo1D("pt");
 hpt->Draw();
 ~~~
+
+\anchor vectorizedkernels
+## Vectorized kernels
+For RVecF and RVecD with at least 16 elements, the arithmetic operators `+`, `-`, `*` and `/`, the comparison operators,
+Where(), Take() with indices, DeltaR() and InvariantMasses() are computed by kernels that are compiled for
+several instruction sets. The first time a kernel is called, the most recent instruction set supported by the CPU is
+chosen among AVX-512, AVX2 and a generic version. The choice can be forced with the `VecOps.SIMD` option of `.rootrc`,
+which accepts `auto` (the default), `avx512`, `avx2` and `generic`.
+The kernels for AVX-512 and AVX2 are in the libraries libROOTVecOps_AVX512 and libROOTVecOps_AVX2, which are loaded
+only on CPUs that support them.
+All kernels return the same results as the loops used for short vectors.
 \anchor RVecdoxyref
 **/
 // clang-format on
@@ -1582,12 +1727,17 @@ RVEC_UNARY_OPERATOR(!)
 #define ERROR_MESSAGE(OP) \
  "Cannot call operator " #OP " on vectors of different sizes."
 
-#define RVEC_BINARY_OPERATOR(OP)                                               \
+#define RVEC_BINARY_OPERATOR(OP, KERNEL_OP)                                    \
 template <typename T0, typename T1>                                            \
 auto operator OP(const RVec<T0> &v, const T1 &y)                               \
   -> RVec<decltype(v[0] OP y)>                                                 \
 {                                                                              \
    RVec<decltype(v[0] OP y)> ret(v.size());                                    \
+   const Internal::VecOps::KernelScalar_t<T0, T1> &s = y;                      \
+   if (Internal::VecOps::TryElementWiseKernel(                                 \
+          KERNEL_OP, Internal::VecOps::EOperands::kVecScalar, v.data(), &s,    \
+          ret.data(), v.size()))                                               \
+      return ret;                                                              \
    auto op = [&y](const T0 &x) { return x OP y; };                             \
    std::transform(v.begin(), v.end(), ret.begin(), op);                        \
    return ret;                                                                 \
@@ -1598,6 +1748,11 @@ auto operator OP(const T0 &x, const RVec<T1> &v)                               \
   -> RVec<decltype(x OP v[0])>                                                 \
 {                                                                              \
    RVec<decltype(x OP v[0])> ret(v.size());                                    \
+   const Internal::VecOps::KernelScalar_t<T1, T0> &s = x;                      \
+   if (Internal::VecOps::TryElementWiseKernel(                                 \
+          KERNEL_OP, Internal::VecOps::EOperands::kScalarVec, &s, v.data(),    \
+          ret.data(), v.size()))                                               \
+      return ret;                                                              \
    auto op = [&x](const T1 &y) { return x OP y; };                             \
    std::transform(v.begin(), v.end(), ret.begin(), op);                        \
    return ret;                                                                 \
@@ -1611,29 +1766,38 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
       throw std::runtime_error(ERROR_MESSAGE(OP));                             \
                                                                                \
    RVec<decltype(v0[0] OP v1[0])> ret(v0.size());                              \
+   if (Internal::VecOps::TryElementWiseKernel(                                 \
+          KERNEL_OP, Internal::VecOps::EOperands::kVecVec, v0.data(),          \
+          v1.data(), ret.data(), v0.size()))                                   \
+      return ret;                                                              \
    auto op = [](const T0 &x, const T1 &y) { return x OP y; };                  \
    std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
    return ret;                                                                 \
 }                                                                              \
 
-RVEC_BINARY_OPERATOR(+)
-RVEC_BINARY_OPERATOR(-)
-RVEC_BINARY_OPERATOR(*)
-RVEC_BINARY_OPERATOR(/)
-RVEC_BINARY_OPERATOR(%)
-RVEC_BINARY_OPERATOR(^)
-RVEC_BINARY_OPERATOR(|)
-RVEC_BINARY_OPERATOR(&)
+RVEC_BINARY_OPERATOR(+, Internal::VecOps::EVecOp::kAdd)
+RVEC_BINARY_OPERATOR(-, Internal::VecOps::EVecOp::kSub)
+RVEC_BINARY_OPERATOR(*, Internal::VecOps::EVecOp::kMul)
+RVEC_BINARY_OPERATOR(/, Internal::VecOps::EVecOp::kDiv)
+RVEC_BINARY_OPERATOR(%, Internal::VecOps::EVecOp::kNone)
+RVEC_BINARY_OPERATOR(^, Internal::VecOps::EVecOp::kNone)
+RVEC_BINARY_OPERATOR(|, Internal::VecOps::EVecOp::kNone)
+RVEC_BINARY_OPERATOR(&, Internal::VecOps::EVecOp::kNone)
 #undef RVEC_BINARY_OPERATOR
 
 ///@}
 ///@name RVec Assignment Arithmetic Operators
 ///@{
 
-#define RVEC_ASSIGNMENT_OPERATOR(OP)                                           \
+#define RVEC_ASSIGNMENT_OPERATOR(OP, KERNEL_OP)                                \
 template <typename T0, typename T1>                                            \
 RVec<T0>& operator OP(RVec<T0> &v, const T1 &y)                                \
 {                                                                              \
+   const Internal::VecOps::KernelScalar_t<T0, T1> &s = y;                      \
+   if (Internal::VecOps::TryElementWiseKernel(                                 \
+          KERNEL_OP, Internal::VecOps::EOperands::kVecScalar, v.data(), &s,    \
+          v.data(), v.size()))                                                 \
+      return v;                                                                \
    auto op = [&y](T0 &x) { return x OP y; };                                   \
    std::transform(v.begin(), v.end(), v.begin(), op);                          \
    return v;                                                                   \
@@ -1645,33 +1809,42 @@ RVec<T0>& operator OP(RVec<T0> &v0, const RVec<T1> &v1)                        \
    if (v0.size() != v1.size())                                                 \
       throw std::runtime_error(ERROR_MESSAGE(OP));                             \
                                                                                \
+   if (Internal::VecOps::TryElementWiseKernel(                                 \
+          KERNEL_OP, Internal::VecOps::EOperands::kVecVec, v0.data(),          \
+          v1.data(), v0.data(), v0.size()))                                    \
+      return v0;                                                               \
    auto op = [](T0 &x, const T1 &y) { return x OP y; };                        \
    std::transform(v0.begin(), v0.end(), v1.begin(), v0.begin(), op);           \
    return v0;                                                                  \
 }                                                                              \
 
-RVEC_ASSIGNMENT_OPERATOR(+=)
-RVEC_ASSIGNMENT_OPERATOR(-=)
-RVEC_ASSIGNMENT_OPERATOR(*=)
-RVEC_ASSIGNMENT_OPERATOR(/=)
-RVEC_ASSIGNMENT_OPERATOR(%=)
-RVEC_ASSIGNMENT_OPERATOR(^=)
-RVEC_ASSIGNMENT_OPERATOR(|=)
-RVEC_ASSIGNMENT_OPERATOR(&=)
-RVEC_ASSIGNMENT_OPERATOR(>>=)
-RVEC_ASSIGNMENT_OPERATOR(<<=)
+RVEC_ASSIGNMENT_OPERATOR(+=, Internal::VecOps::EVecOp::kAdd)
+RVEC_ASSIGNMENT_OPERATOR(-=, Internal::VecOps::EVecOp::kSub)
+RVEC_ASSIGNMENT_OPERATOR(*=, Internal::VecOps::EVecOp::kMul)
+RVEC_ASSIGNMENT_OPERATOR(/=, Internal::VecOps::EVecOp::kDiv)
+RVEC_ASSIGNMENT_OPERATOR(%=, Internal::VecOps::EVecOp::kNone)
+RVEC_ASSIGNMENT_OPERATOR(^=, Internal::VecOps::EVecOp::kNone)
+RVEC_ASSIGNMENT_OPERATOR(|=, Internal::VecOps::EVecOp::kNone)
+RVEC_ASSIGNMENT_OPERATOR(&=, Internal::VecOps::EVecOp::kNone)
+RVEC_ASSIGNMENT_OPERATOR(>>=, Internal::VecOps::EVecOp::kNone)
+RVEC_ASSIGNMENT_OPERATOR(<<=, Internal::VecOps::EVecOp::kNone)
 #undef RVEC_ASSIGNMENT_OPERATOR
 
 ///@}
 ///@name RVec Comparison and Logical Operators
 ///@{
 
-#define RVEC_LOGICAL_OPERATOR(OP)                                              \
+#define RVEC_LOGICAL_OPERATOR(OP, KERNEL_OP)                                   \
 template <typename T0, typename T1>                                            \
 auto operator OP(const RVec<T0> &v, const T1 &y)                               \
   -> RVec<int> /* avoid std::vector<bool> */                                   \
 {                                                                              \
    RVec<int> ret(v.size());                                                    \
+   const Internal::VecOps::KernelScalar_t<T0, T1> &s = y;                      \
+   if (Internal::VecOps::TryElementWiseKernel(                                 \
+          KERNEL_OP, Internal::VecOps::EOperands::kVecScalar, v.data(), &s,    \
+          ret.data(), v.size()))                                               \
+      return ret;                                                              \
    auto op = [y](const T0 &x) -> int { return x OP y; };                       \
    std::transform(v.begin(), v.end(), ret.begin(), op);                        \
    return ret;                                                                 \
@@ -1682,6 +1855,11 @@ auto operator OP(const T0 &x, const RVec<T1> &v)                               \
   -> RVec<int> /* avoid std::vector<bool> */                                   \
 {                                                                              \
    RVec<int> ret(v.size());                                                    \
+   const Internal::VecOps::KernelScalar_t<T1, T0> &s = x;                      \
+   if (Internal::VecOps::TryElementWiseKernel(                                 \
+          KERNEL_OP, Internal::VecOps::EOperands::kScalarVec, &s, v.data(),    \
+          ret.data(), v.size()))                                               \
+      return ret;                                                              \
    auto op = [x](const T1 &y) -> int { return x OP y; };                       \
    std::transform(v.begin(), v.end(), ret.begin(), op);                        \
    return ret;                                                                 \
@@ -1695,19 +1873,23 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
       throw std::runtime_error(ERROR_MESSAGE(OP));                             \
                                                                                \
    RVec<int> ret(v0.size());                                                   \
+   if (Internal::VecOps::TryElementWiseKernel(                                 \
+          KERNEL_OP, Internal::VecOps::EOperands::kVecVec, v0.data(),          \
+          v1.data(), ret.data(), v0.size()))                                   \
+      return ret;                                                              \
    auto op = [](const T0 &x, const T1 &y) -> int { return x OP y; };           \
    std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
    return ret;                                                                 \
 }                                                                              \
 
-RVEC_LOGICAL_OPERATOR(<)
-RVEC_LOGICAL_OPERATOR(>)
-RVEC_LOGICAL_OPERATOR(==)
-RVEC_LOGICAL_OPERATOR(!=)
-RVEC_LOGICAL_OPERATOR(<=)
-RVEC_LOGICAL_OPERATOR(>=)
-RVEC_LOGICAL_OPERATOR(&&)
-RVEC_LOGICAL_OPERATOR(||)
+RVEC_LOGICAL_OPERATOR(<, Internal::VecOps::EVecOp::kLess)
+RVEC_LOGICAL_OPERATOR(>, Internal::VecOps::EVecOp::kGreater)
+RVEC_LOGICAL_OPERATOR(==, Internal::VecOps::EVecOp::kEqual)
+RVEC_LOGICAL_OPERATOR(!=, Internal::VecOps::EVecOp::kNotEqual)
+RVEC_LOGICAL_OPERATOR(<=, Internal::VecOps::EVecOp::kLessEqual)
+RVEC_LOGICAL_OPERATOR(>=, Internal::VecOps::EVecOp::kGreaterEqual)
+RVEC_LOGICAL_OPERATOR(&&, Internal::VecOps::EVecOp::kNone)
+RVEC_LOGICAL_OPERATOR(||, Internal::VecOps::EVecOp::kNone)
 #undef RVEC_LOGICAL_OPERATOR
 
 ///@}
@@ -2287,6 +2469,8 @@ RVec<T> Take(const RVec<T> &v, const RVec<typename RVec<T>::size_type> &i)
    using size_type = typename RVec<T>::size_type;
    const size_type isize = i.size();
    RVec<T> r(isize);
+   if (Internal::VecOps::TryTakeKernel(v.data(), i.data(), r.data(), isize))
+      return r;
    for (size_type k = 0; k < isize; k++)
       r[k] = v[i[k]];
    return r;
@@ -2702,6 +2886,12 @@ RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, const RVec<T>& v2)
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
    RVec<T> r;
+   if (Internal::VecOps::UseKernel<T>(size)) {
+      r.resize(size);
+      Internal::VecOps::TryWhereKernel(Internal::VecOps::EOperands::kVecVec, c.data(), v1.data(), v2.data(),
+                                       r.data(), size);
+      return r;
+   }
    r.reserve(size);
    for (size_type i=0; i<size; i++) {
       r.emplace_back(c[i] != 0 ? v1[i] : v2[i]);
@@ -2730,6 +2920,12 @@ RVec<T> Where(const RVec<int> &c, const RVec<T> &v1, typename RVec<T>::value_typ
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
    RVec<T> r;
+   if (Internal::VecOps::UseKernel<T>(size)) {
+      r.resize(size);
+      Internal::VecOps::TryWhereKernel(Internal::VecOps::EOperands::kVecScalar, c.data(), v1.data(), &v2, r.data(),
+                                       size);
+      return r;
+   }
    r.reserve(size);
    for (size_type i=0; i<size; i++) {
       r.emplace_back(c[i] != 0 ? v1[i] : v2);
@@ -2758,6 +2954,12 @@ RVec<T> Where(const RVec<int>& c, typename RVec<T>::value_type v1, const RVec<T>
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
    RVec<T> r;
+   if (Internal::VecOps::UseKernel<T>(size)) {
+      r.resize(size);
+      Internal::VecOps::TryWhereKernel(Internal::VecOps::EOperands::kScalarVec, c.data(), &v1, v2.data(), r.data(),
+                                       size);
+      return r;
+   }
    r.reserve(size);
    for (size_type i=0; i<size; i++) {
       r.emplace_back(c[i] != 0 ? v1 : v2[i]);
@@ -2901,30 +3103,38 @@ RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, c
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
-/// the collections eta1, eta2, phi1 and phi2.
+/// the scalars eta1, eta2, phi1 and phi2.
 ///
 /// The function computes \f$\Delta R = \sqrt{(\eta_1 - \eta_2)^2 + (\phi_1 - \phi_2)^2}\f$
-/// of the given collections eta1, eta2, phi1 and phi2. The angle \f$\phi\f$ can
+/// of the given scalars eta1, eta2, phi1 and phi2. The angle \f$\phi\f$ can
 /// be set to radian or degrees using the optional argument c, see the documentation
 /// of the DeltaPhi helper.
 template <typename T>
-RVec<T> DeltaR(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
+T DeltaR(T eta1, T eta2, T phi1, T phi2, const T c = M_PI)
 {
-   return sqrt(DeltaR2(eta1, eta2, phi1, phi2, c));
+   const auto dphi = DeltaPhi(phi1, phi2, c);
+   return std::sqrt((eta1 - eta2) * (eta1 - eta2) + dphi * dphi);
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
-/// the scalars eta1, eta2, phi1 and phi2.
+/// the collections eta1, eta2, phi1 and phi2.
 ///
 /// The function computes \f$\Delta R = \sqrt{(\eta_1 - \eta_2)^2 + (\phi_1 - \phi_2)^2}\f$
-/// of the given scalars eta1, eta2, phi1 and phi2. The angle \f$\phi\f$ can
+/// of the given collections eta1, eta2, phi1 and phi2. The angle \f$\phi\f$ can
 /// be set to radian or degrees using the optional argument c, see the documentation
 /// of the DeltaPhi helper.
 template <typename T>
-T DeltaR(T eta1, T eta2, T phi1, T phi2, const T c = M_PI)
+RVec<T> DeltaR(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
-   const auto dphi = DeltaPhi(phi1, phi2, c);
-   return std::sqrt((eta1 - eta2) * (eta1 - eta2) + dphi * dphi);
+   const std::size_t size = eta1.size();
+   if (eta2.size() != size || phi1.size() != size || phi2.size() != size)
+      throw std::runtime_error("DeltaR: input RVec instances have different lengths!");
+   RVec<T> r(size);
+   if (Internal::VecOps::TryDeltaRKernel(eta1.data(), eta2.data(), phi1.data(), phi2.data(), r.data(), size, c))
+      return r;
+   for (std::size_t i = 0u; i < size; ++i)
+      r[i] = DeltaR(eta1[i], eta2[i], phi1[i], phi2[i], c);
+   return r;
 }
 
 /// Return the invariant mass of two particles given the collections of the quantities
@@ -2944,6 +3154,11 @@ RVec<T> InvariantMasses(
 
    RVec<T> inv_masses(size);
 
+   const T *inputs[] = {pt1.data(), eta1.data(), phi1.data(), mass1.data(),
+                        pt2.data(), eta2.data(), phi2.data(), mass2.data()};
+   if (Internal::VecOps::TryInvariantMassesKernel(inputs, inv_masses.data(), size))
+      return inv_masses;
+
    for (std::size_t i = 0u; i < size; ++i) {
       // Conversion from (pt, eta, phi, mass) to (x, y, z, e) coordinate system
       const auto x1 = pt1[i] * std::cos(phi1[i]);
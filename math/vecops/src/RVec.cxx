@@ -11,6 +11,13 @@
  *************************************************************************/
 
 #include "ROOT/RVec.hxx"
+#include "RVecKernels.h"
+#include "TEnv.h"
+#include "TError.h"
+#include "TSystem.h"
+
+#include <string>
+
 using namespace ROOT::VecOps;
 
 // Check that no bytes are wasted and everything is well-aligned.
@@ -84,6 +91,107 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
    this->fCapacity = NewCapacity;
 }
 
+namespace {
+
+using ROOT::Internal::VecOps::RKernelTable;
+
+/// The kernels of the last library loaded by LoadKernels, see RegisterArchitectureKernels.
+const RKernelTable *gArchitectureKernels = nullptr;
+
+#ifdef R__VECOPS_ARCHITECTURE_SPECIFIC_LIBS
+/// Load the library with the kernels for an instruction set, return its kernels or nullptr if it cannot be loaded.
+const RKernelTable *LoadKernels(const char *libName)
+{
+   gArchitectureKernels = nullptr;
+   const auto returnValue = gSystem->Load(libName);
+   if (returnValue < 0 || gArchitectureKernels == nullptr) {
+      Warning("ROOT::VecOps", "Unable to load %s, falling back to the kernels for an older instruction set.", libName);
+      return nullptr;
+   }
+   return gArchitectureKernels;
+}
+#endif
+
+/// Select the kernels for the most recent instruction set supported by the CPU, or the ones requested in .rootrc.
+/// The kernels for specific instruction sets are in separate libraries, which are only loaded if the CPU supports them.
+const RKernelTable &SelectKernels()
+{
+   const std::string userChoice = gEnv ? gEnv->GetValue("VecOps.SIMD", "auto") : "auto";
+   if (userChoice != "auto" && userChoice != "avx512" && userChoice != "avx2" && userChoice != "generic") {
+      Warning("ROOT::VecOps", "Unknown value \"%s\" for the VecOps.SIMD option, supported values are \"auto\", "
+              "\"avx512\", \"avx2\" and \"generic\". The generic kernels will be used.", userChoice.c_str());
+   }
+#ifdef R__VECOPS_ARCHITECTURE_SPECIFIC_LIBS
+   __builtin_cpu_init();
+   // the AVX-512 kernels are compiled for skylake-avx512, see CMakeLists.txt
+   const bool supportedAVX512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd") &&
+                                __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512bw") &&
+                                __builtin_cpu_supports("avx512dq");
+   const bool supportedAVX2 = __builtin_cpu_supports("avx2");
+   if ((userChoice == "auto" || userChoice == "avx512") && supportedAVX512) {
+      if (const auto *kernels = LoadKernels("libROOTVecOps_AVX512"))
+         return *kernels;
+   }
+   if ((userChoice == "auto" || userChoice == "avx512" || userChoice == "avx2") && supportedAVX2) {
+      if (const auto *kernels = LoadKernels("libROOTVecOps_AVX2"))
+         return *kernels;
+   }
+#endif
+   return ROOT::Internal::VecOps::GENERIC::GetKernelTable();
+}
+
+const RKernelTable &GetKernels()
+{
+   static const RKernelTable &kernels = SelectKernels();
+   return kernels;
+}
+
+} // anonymous namespace
+
+#define RVEC_KERNEL_ENTRY_POINTS(T, MEMBER)                                                                          \
+   void ROOT::Internal::VecOps::BinaryKernel(EVecOp op, EOperands operands, const T *x, const T *y, T *out,        \
+                                             std::size_t n)                                                         \
+   {                                                                                                                \
+      GetKernels().MEMBER.fBinary(op, operands, x, y, out, n);                                                      \
+   }                                                                                                                \
+   void ROOT::Internal::VecOps::CompareKernel(EVecOp op, EOperands operands, const T *x, const T *y, int *out,     \
+                                              std::size_t n)                                                        \
+   {                                                                                                                \
+      GetKernels().MEMBER.fCompare(op, operands, x, y, out, n);                                                     \
+   }                                                                                                                \
+   void ROOT::Internal::VecOps::WhereKernel(EOperands operands, const int *c, const T *x, const T *y, T *out,      \
+                                            std::size_t n)                                                          \
+   {                                                                                                                \
+      GetKernels().MEMBER.fWhere(operands, c, x, y, out, n);                                                        \
+   }                                                                                                                \
+   void ROOT::Internal::VecOps::TakeKernel(const T *x, const std::size_t *idx, T *out, std::size_t n)              \
+   {                                                                                                                \
+      GetKernels().MEMBER.fTake(x, idx, out, n);                                                                    \
+   }                                                                                                                \
+   void ROOT::Internal::VecOps::DeltaRKernel(const T *eta1, const T *eta2, const T *phi1, const T *phi2, T *out,   \
+                                             std::size_t n, T c)                                                    \
+   {                                                                                                                \
+      GetKernels().MEMBER.fDeltaR(eta1, eta2, phi1, phi2, out, n, c);                                               \
+   }                                                                                                                \
+   void ROOT::Internal::VecOps::InvariantMassesKernel(const T *const *inputs, T *out, std::size_t n)               \
+   {                                                                                                                \
+      GetKernels().MEMBER.fInvariantMasses(inputs, out, n);                                                         \
+   }
+
+RVEC_KERNEL_ENTRY_POINTS(float, fFloat)
+RVEC_KERNEL_ENTRY_POINTS(double, fDouble)
+#undef RVEC_KERNEL_ENTRY_POINTS
+
+void ROOT::Internal::VecOps::RegisterArchitectureKernels(const RKernelTable &table)
+{
+   gArchitectureKernels = &table;
+}
+
+const char *ROOT::Internal::VecOps::GetKernelArchitecture()
+{
+   return GetKernels().fArchitecture;
+}
+
 #if (_VECOPS_USE_EXTERN_TEMPLATES)
 
 namespace ROOT {
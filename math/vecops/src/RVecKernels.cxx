@@ -0,0 +1,199 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// This file is compiled once per supported instruction set, with R__VECOPS_ARCH set to the name of the namespace that
+// contains the kernels and with the corresponding compiler flags, see CMakeLists.txt. The loops are written so that
+// the compiler can vectorize them; RVec.cxx picks the kernels to use at runtime based on the CPU capabilities.
+// The kernels compute exactly what the loops of RVec.hxx for short vectors compute, including the calls to the
+// standard math functions, so that the results do not depend on the length of the vectors.
+// All helpers are in an anonymous namespace: the kernels do not call inline functions of RVec.hxx, whose instantiations
+// could otherwise be shared with code compiled for another instruction set.
+
+#include "RVecKernels.h"
+
+#include <TError.h> // R__ASSERT
+
+#include <cmath>
+
+#ifndef R__VECOPS_ARCH
+#error "R__VECOPS_ARCH should always be defined"
+#endif
+
+#define R__VECOPS_QUOTE(x) #x
+#define R__VECOPS_QUOTE_VALUE(x) R__VECOPS_QUOTE(x)
+
+namespace ROOT {
+namespace Internal {
+namespace VecOps {
+namespace R__VECOPS_ARCH {
+
+namespace {
+
+/// The same as ROOT::VecOps::DeltaPhi, so that the kernels return the same results as the loops for short vectors.
+template <typename T>
+T DeltaPhi(T v1, T v2, const T c)
+{
+   auto r = std::fmod(v2 - v1, 2.0 * c);
+   if (r < -c) {
+      r += 2.0 * c;
+   } else if (r > c) {
+      r -= 2.0 * c;
+   }
+   return r;
+}
+
+/// The same computation as the loop of ROOT::VecOps::InvariantMasses.
+template <typename T>
+T InvariantMassOfPair(T pt1, T eta1, T phi1, T mass1, T pt2, T eta2, T phi2, T mass2)
+{
+   // Conversion from (pt, eta, phi, mass) to (x, y, z, e) coordinate system
+   const auto x1 = pt1 * std::cos(phi1);
+   const auto y1 = pt1 * std::sin(phi1);
+   const auto z1 = pt1 * std::sinh(eta1);
+   const auto e1 = std::sqrt(x1 * x1 + y1 * y1 + z1 * z1 + mass1 * mass1);
+
+   const auto x2 = pt2 * std::cos(phi2);
+   const auto y2 = pt2 * std::sin(phi2);
+   const auto z2 = pt2 * std::sinh(eta2);
+   const auto e2 = std::sqrt(x2 * x2 + y2 * y2 + z2 * z2 + mass2 * mass2);
+
+   // Addition of particle four-vector elements
+   const auto e = e1 + e2;
+   const auto x = x1 + x2;
+   const auto y = y1 + y2;
+   const auto z = z1 + z2;
+
+   // Invariant mass with (+, -, -, -) metric
+   return std::sqrt(e * e - x * x - y * y - z * z);
+}
+
+template <typename T, typename R, typename Op>
+void ElementWise(EOperands operands, const T *x, const T *y, R *out, std::size_t n, Op op)
+{
+   switch (operands) {
+   case EOperands::kVecVec:
+      for (std::size_t i = 0; i < n; ++i)
+         out[i] = op(x[i], y[i]);
+      break;
+   case EOperands::kVecScalar: {
+      const T s = *y;
+      for (std::size_t i = 0; i < n; ++i)
+         out[i] = op(x[i], s);
+      break;
+   }
+   case EOperands::kScalarVec: {
+      const T s = *x;
+      for (std::size_t i = 0; i < n; ++i)
+         out[i] = op(s, y[i]);
+      break;
+   }
+   }
+}
+
+template <typename T>
+void Binary(EVecOp op, EOperands operands, const T *x, const T *y, T *out, std::size_t n)
+{
+   switch (op) {
+   case EVecOp::kAdd: ElementWise(operands, x, y, out, n, [](T a, T b) { return a + b; }); break;
+   case EVecOp::kSub: ElementWise(operands, x, y, out, n, [](T a, T b) { return a - b; }); break;
+   case EVecOp::kMul: ElementWise(operands, x, y, out, n, [](T a, T b) { return a * b; }); break;
+   case EVecOp::kDiv: ElementWise(operands, x, y, out, n, [](T a, T b) { return a / b; }); break;
+   default: R__ASSERT(false && "Not an arithmetic operation.");
+   }
+}
+
+template <typename T>
+void Compare(EVecOp op, EOperands operands, const T *x, const T *y, int *out, std::size_t n)
+{
+   switch (op) {
+   case EVecOp::kLess: ElementWise(operands, x, y, out, n, [](T a, T b) -> int { return a < b; }); break;
+   case EVecOp::kGreater: ElementWise(operands, x, y, out, n, [](T a, T b) -> int { return a > b; }); break;
+   case EVecOp::kLessEqual: ElementWise(operands, x, y, out, n, [](T a, T b) -> int { return a <= b; }); break;
+   case EVecOp::kGreaterEqual: ElementWise(operands, x, y, out, n, [](T a, T b) -> int { return a >= b; }); break;
+   case EVecOp::kEqual: ElementWise(operands, x, y, out, n, [](T a, T b) -> int { return a == b; }); break;
+   case EVecOp::kNotEqual: ElementWise(operands, x, y, out, n, [](T a, T b) -> int { return a != b; }); break;
+   default: R__ASSERT(false && "Not a comparison.");
+   }
+}
+
+template <typename T>
+void Where(EOperands operands, const int *c, const T *x, const T *y, T *out, std::size_t n)
+{
+   switch (operands) {
+   case EOperands::kVecVec:
+      for (std::size_t i = 0; i < n; ++i)
+         out[i] = c[i] != 0 ? x[i] : y[i];
+      break;
+   case EOperands::kVecScalar: {
+      const T s = *y;
+      for (std::size_t i = 0; i < n; ++i)
+         out[i] = c[i] != 0 ? x[i] : s;
+      break;
+   }
+   case EOperands::kScalarVec: {
+      const T s = *x;
+      for (std::size_t i = 0; i < n; ++i)
+         out[i] = c[i] != 0 ? s : y[i];
+      break;
+   }
+   }
+}
+
+template <typename T>
+void Take(const T *x, const std::size_t *idx, T *out, std::size_t n)
+{
+   for (std::size_t i = 0; i < n; ++i)
+      out[i] = x[idx[i]];
+}
+
+template <typename T>
+void DeltaR(const T *eta1, const T *eta2, const T *phi1, const T *phi2, T *out, std::size_t n, T c)
+{
+   for (std::size_t i = 0; i < n; ++i) {
+      const T dphi = DeltaPhi(phi1[i], phi2[i], c);
+      out[i] = std::sqrt((eta1[i] - eta2[i]) * (eta1[i] - eta2[i]) + dphi * dphi);
+   }
+}
+
+/// inputs are pt1, eta1, phi1, mass1, pt2, eta2, phi2, mass2
+template <typename T>
+void InvariantMasses(const T *const *inputs, T *out, std::size_t n)
+{
+   const T *pt1 = inputs[0], *eta1 = inputs[1], *phi1 = inputs[2], *mass1 = inputs[3];
+   const T *pt2 = inputs[4], *eta2 = inputs[5], *phi2 = inputs[6], *mass2 = inputs[7];
+   for (std::size_t i = 0; i < n; ++i)
+      out[i] = InvariantMassOfPair(pt1[i], eta1[i], phi1[i], mass1[i], pt2[i], eta2[i], phi2[i], mass2[i]);
+}
+
+template <typename T>
+constexpr RVecKernels<T> MakeKernels()
+{
+   return {&Binary<T>, &Compare<T>, &Where<T>, &Take<T>, &DeltaR<T>, &InvariantMasses<T>};
+}
+
+} // anonymous namespace
+
+const RKernelTable &GetKernelTable()
+{
+   static const RKernelTable table{R__VECOPS_QUOTE_VALUE(R__VECOPS_ARCH), MakeKernels<float>(), MakeKernels<double>()};
+   return table;
+}
+
+#ifdef R__VECOPS_KERNEL_LIBRARY
+namespace {
+/// Registers the kernels of this library with libROOTVecOps when the library is loaded, see SelectKernels in RVec.cxx
+struct RKernelRegistration {
+   RKernelRegistration() { RegisterArchitectureKernels(GetKernelTable()); }
+} gKernelRegistration;
+} // anonymous namespace
+#endif
+
+} // namespace R__VECOPS_ARCH
+} // namespace VecOps
+} // namespace Internal
+} // namespace ROOT
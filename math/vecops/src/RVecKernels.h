@@ -0,0 +1,52 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVECKERNELS
+#define ROOT_RVECKERNELS
+
+#include "ROOT/RVec.hxx" // EVecOp, EOperands
+
+#include <cstddef>
+
+namespace ROOT {
+namespace Internal {
+namespace VecOps {
+
+/// The kernels for one value type, see the entry points declared in RVec.hxx for the meaning of the arguments.
+template <typename T>
+struct RVecKernels {
+   void (*fBinary)(EVecOp op, EOperands operands, const T *x, const T *y, T *out, std::size_t n);
+   void (*fCompare)(EVecOp op, EOperands operands, const T *x, const T *y, int *out, std::size_t n);
+   void (*fWhere)(EOperands operands, const int *c, const T *x, const T *y, T *out, std::size_t n);
+   void (*fTake)(const T *x, const std::size_t *idx, T *out, std::size_t n);
+   void (*fDeltaR)(const T *eta1, const T *eta2, const T *phi1, const T *phi2, T *out, std::size_t n, T c);
+   void (*fInvariantMasses)(const T *const *inputs, T *out, std::size_t n);
+};
+
+/// The kernels compiled for one instruction set. RVecKernels.cxx is compiled once per supported instruction set, each
+/// time in a different namespace, see CMakeLists.txt; RVec.cxx selects one of them at runtime.
+struct RKernelTable {
+   const char *fArchitecture;
+   RVecKernels<float> fFloat;
+   RVecKernels<double> fDouble;
+};
+
+/// The generic kernels, part of libROOTVecOps.
+namespace GENERIC {
+const RKernelTable &GetKernelTable();
+}
+
+/// Called by the libraries with the kernels for a specific instruction set, libROOTVecOps_AVX2 and
+/// libROOTVecOps_AVX512, when they are loaded.
+void RegisterArchitectureKernels(const RKernelTable &table);
+
+} // namespace VecOps
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -1255,6 +1255,58 @@ TEST(VecOps, DeltaR)
    }
 }
 
+template <typename T>
+void CheckKernels()
+{
+   // long enough to be processed by the vectorized kernels, not a multiple of the vector widths
+   const std::size_t n = 3 * ROOT::Internal::VecOps::kMinKernelSize + 5;
+   RVec<T> a(n), b(n), phi(n);
+   RVec<std::size_t> idx(n);
+   for (std::size_t i = 0; i < n; ++i) {
+      a[i] = T(0.25) * i - T(4.);
+      b[i] = T(3.) - T(0.5) * i;
+      phi[i] = T(0.3) * i;
+      idx[i] = (i * 7) % n;
+   }
+
+   const auto sum = a + b;
+   const auto prod = a * 2;
+   const auto ratio = 1 / b;
+   const auto less = a < b;
+   const auto geq = a >= T(0.);
+   const auto where = Where(less, a, b);
+   const auto whereScalar = Where(less, a, T(42.));
+   const auto taken = Take(a, idx);
+   const auto dr = DeltaR(a, b, phi, b);
+   const auto masses = InvariantMasses(b * b, a, phi, b * b, a * a, b, a, a * a);
+   auto inPlace = a;
+   inPlace -= b;
+   for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(sum[i], a[i] + b[i]);
+      EXPECT_EQ(prod[i], a[i] * T(2));
+      EXPECT_EQ(ratio[i], T(1) / b[i]);
+      EXPECT_EQ(less[i], a[i] < b[i]);
+      EXPECT_EQ(geq[i], a[i] >= T(0.));
+      EXPECT_EQ(where[i], a[i] < b[i] ? a[i] : b[i]);
+      EXPECT_EQ(whereScalar[i], a[i] < b[i] ? a[i] : T(42.));
+      EXPECT_EQ(taken[i], a[idx[i]]);
+      EXPECT_EQ(dr[i], DeltaR(a[i], b[i], phi[i], b[i]));
+      // a vector with a single element is processed by the loop of the header
+      const RVec<T> a1{a[i]}, b1{b[i]}, phi1{phi[i]};
+      EXPECT_EQ(masses[i], InvariantMasses(b1 * b1, a1, phi1, b1 * b1, a1 * a1, b1, a1, a1 * a1)[0]);
+      EXPECT_EQ(inPlace[i], a[i] - b[i]);
+   }
+   EXPECT_EQ(Sum(a), std::accumulate(a.begin(), a.end(), T(0.)));
+}
+
+TEST(VecOps, Kernels)
+{
+   const std::string arch = ROOT::Internal::VecOps::GetKernelArchitecture();
+   EXPECT_TRUE(arch == "AVX512" || arch == "AVX2" || arch == "GENERIC") << arch;
+   CheckKernels<float>();
+   CheckKernels<double>();
+}
+
 TEST(VecOps, Map)
 {
    RVec<float> a({1.f, 2.f, 3.f});
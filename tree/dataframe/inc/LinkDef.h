@@ -58,9 +58,39 @@
 #pragma link C++ class ROOT::Detail::RDF::RMergeableValue<TStatistic>+;
 #pragma link C++ class ROOT::Detail::RDF::RMergeableValue<TProfile>+;
 #pragma link C++ class ROOT::Detail::RDF::RMergeableValue<TProfile2D>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableCount+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMean+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableStdDev+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableSum<int>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMin<int>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMax<int>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableSum<unsigned int>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMin<unsigned int>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMax<unsigned int>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableSum<float>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMin<float>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMax<float>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableSum<double>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMin<double>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMax<double>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableSum<Long64_t>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMin<Long64_t>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMax<Long64_t>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableSum<ULong64_t>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMin<ULong64_t>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableMax<ULong64_t>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableFill<TH1D>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableFill<TH2D>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableFill<TH3D>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableFill<THnD>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableFill<TGraph>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableFill<TStatistic>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableFill<TProfile>+;
+#pragma link C++ class ROOT::Detail::RDF::RMergeableFill<TProfile2D>+;
 #pragma link C++ class ROOT::Detail::RDF::RMergeableVariationsBase+;
 #pragma link C++ class TNotifyLink<ROOT::Internal::RDF::RNewSampleFlag>;
 #pragma link C++ class ROOT::RDF::RCutFlowReport;
+#pragma link C++ class ROOT::RDF::Experimental::RProfileReport;
 
 #endif
 
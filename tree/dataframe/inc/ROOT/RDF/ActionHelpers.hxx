@@ -48,6 +48,8 @@
 #include "ROOT/RDF/RMergeableValue.hxx"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -61,6 +63,13 @@
 
 /// \cond HIDDEN_SYMBOLS
 
+class TH2D;
+class TH3D;
+
+namespace ROOT {
+class RDataFrame;
+} // namespace ROOT
+
 namespace ROOT {
 namespace Internal {
 namespace RDF {
@@ -566,6 +575,235 @@ public:
    }
 };
 
+/// Number of axes of the histogram types that SharedFillHelper can fill, 0 for all other types.
+template <typename HIST>
+struct SharedFillDim : std::integral_constant<int, 0> {
+};
+template <>
+struct SharedFillDim<::TH1D> : std::integral_constant<int, 1> {
+};
+template <>
+struct SharedFillDim<::TH2D> : std::integral_constant<int, 2> {
+};
+template <>
+struct SharedFillDim<::TH3D> : std::integral_constant<int, 3> {
+};
+
+template <typename T, bool = IsDataContainer<T>::value>
+struct IsArithmeticValue : std::is_arithmetic<T> {
+};
+template <typename T>
+struct IsArithmeticValue<T, true> : std::is_arithmetic<typename T::value_type> {
+};
+
+/// Whether a histogram of type HIST filled from columns of type ColTypes can be filled by SharedFillHelper:
+/// one value per axis, optionally followed by a weight, all of them arithmetic or containers of arithmetic values.
+template <typename HIST, typename... ColTypes>
+struct CanUseSharedFill
+   : std::integral_constant<bool, (SharedFillDim<HIST>::value > 0) &&
+                                     (sizeof...(ColTypes) == SharedFillDim<HIST>::value ||
+                                      sizeof...(ColTypes) == SharedFillDim<HIST>::value + 1) &&
+                                     !Disjunction<std::integral_constant<bool, !IsArithmeticValue<ColTypes>::value>...>::value> {
+};
+
+/// Return true if filling the histogram in all slots concurrently via SharedFillHelper is preferable to filling
+/// per-slot copies: the histogram has fixed axes and the copies would take more memory than the threshold set by
+/// the RDataFrame.SharedFillThreshold configuration option.
+bool UseSharedFill(const TH1 &h, unsigned int nSlots);
+
+/// The bin contents and statistics of a histogram that is filled concurrently by all slots.
+/// The bin contents and the sums of the squares of the weights are stored once for all slots and updated atomically,
+/// the statistics and the number of entries are accumulated per slot.
+class RSharedHistoFill {
+   struct RSlotStats {
+      std::array<double, TH1::kNstat> fSums{};
+      ULong64_t fNEntries = 0;
+      bool fHasWeights = false;
+      char fPadding[kCacheLineSize]; // avoid false sharing between slots
+   };
+
+   TH1 *fHist = nullptr;
+   int fDim = 1;
+   const TAxis *fXaxis = nullptr;
+   const TAxis *fYaxis = nullptr;
+   const TAxis *fZaxis = nullptr;
+   int fNx = 0;
+   int fNy = 0;
+   int fNz = 0;
+   bool fStatOverflows = false;
+   std::size_t fNCells = 0;
+   std::unique_ptr<std::atomic<double>[]> fContents;
+   std::unique_ptr<std::atomic<double>[]> fSumw2;
+   std::vector<RSlotStats> fSlotStats;
+
+   static void AtomicAdd(std::atomic<double> &a, double v)
+   {
+      auto old = a.load(std::memory_order_relaxed);
+      while (!a.compare_exchange_weak(old, old + v, std::memory_order_relaxed))
+         ;
+   }
+
+public:
+   RSharedHistoFill(TH1 &h, unsigned int nSlots);
+
+   /// Equivalent to TH1::Fill(x, w), TH2::Fill(x, y, w) or TH3::Fill(x, y, z, w), depending on the histogram's
+   /// dimension: unused coordinates are ignored.
+   void Fill(unsigned int slot, double x, double y, double z, double w)
+   {
+      const int binx = fXaxis->FindFixBin(x);
+      const int biny = fDim > 1 ? fYaxis->FindFixBin(y) : 0;
+      const int binz = fDim > 2 ? fZaxis->FindFixBin(z) : 0;
+      const auto bin = binx + (fNx + 2) * (biny + (fNy + 2) * binz);
+      AtomicAdd(fContents[bin], w);
+      AtomicAdd(fSumw2[bin], w * w);
+
+      auto &stats = fSlotStats[slot];
+      ++stats.fNEntries;
+      if (w != 1.)
+         stats.fHasWeights = true;
+      const bool isFlow = binx == 0 || binx > fNx || (fDim > 1 && (biny == 0 || biny > fNy)) ||
+                          (fDim > 2 && (binz == 0 || binz > fNz));
+      if (isFlow && !fStatOverflows)
+         return;
+      auto &s = stats.fSums;
+      s[0] += w;
+      s[1] += w * w;
+      s[2] += w * x;
+      s[3] += w * x * x;
+      if (fDim > 1) {
+         s[4] += w * y;
+         s[5] += w * y * y;
+         s[6] += w * x * y;
+      }
+      if (fDim > 2) {
+         s[7] += w * z;
+         s[8] += w * z * z;
+         s[9] += w * x * z;
+         s[10] += w * y * z;
+      }
+   }
+
+   /// Write the bin contents, the statistics and the number of entries accumulated by all slots to the histogram.
+   void Finalize();
+   /// Copy the bin contents accumulated so far by all slots to h, which must have the same binning.
+   void CopyContentsTo(TH1 &h) const;
+};
+
+/// A Fill helper for large TH1D, TH2D and TH3D with fixed axes: instead of filling one copy of the histogram per
+/// slot and merging the copies at the end of the event loop, all slots fill the same bins with atomic operations.
+/// Memory usage does not grow with the number of slots, at the price of contention on the bins that are filled most
+/// often, which is negligible for the large histograms this helper is used for, see UseSharedFill().
+template <typename HIST>
+class R__CLING_PTRCHECK(off) SharedFillHelper : public RActionImpl<SharedFillHelper<HIST>> {
+   static constexpr int kDim = SharedFillDim<HIST>::value;
+
+   HIST *fObject;
+   unsigned int fNSlots;
+   RSharedHistoFill fFill;
+   std::vector<std::unique_ptr<HIST>> fPartialResults;
+
+   template <typename T, std::enable_if_t<!IsDataContainer<T>::value, int> = 0>
+   static double GetValue(const T &val, std::size_t)
+   {
+      return val;
+   }
+
+   template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
+   static double GetValue(const T &vals, std::size_t i)
+   {
+      return vals[i];
+   }
+
+   template <typename T, std::enable_if_t<!IsDataContainer<T>::value, int> = 0>
+   static std::size_t GetSize(const T &)
+   {
+      return 0;
+   }
+
+   template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
+   static std::size_t GetSize(const T &vals)
+   {
+      return vals.size();
+   }
+
+public:
+   SharedFillHelper(SharedFillHelper &&) = default;
+   SharedFillHelper(const SharedFillHelper &) = delete;
+
+   SharedFillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fObject(h.get()), fNSlots(nSlots), fFill(*h, nSlots), fPartialResults(nSlots)
+   {
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Initialize() { /* noop */}
+
+   template <typename... Xs>
+   void Exec(unsigned int slot, const Xs &...xs)
+   {
+      static_assert(CanUseSharedFill<HIST, Xs...>::value, "SharedFillHelper cannot fill this histogram type.");
+      constexpr std::array<bool, sizeof...(Xs)> isContainer{{IsDataContainer<Xs>::value...}};
+      const std::array<std::size_t, sizeof...(Xs)> sizes{{GetSize(xs)...}};
+
+      // scalars are filled once, containers once per element
+      bool hasContainers = false;
+      std::size_t size = 1;
+      for (std::size_t i = 0; i < sizeof...(Xs); ++i) {
+         if (!isContainer[i])
+            continue;
+         if (hasContainers && sizes[i] != size)
+            throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
+         hasContainers = true;
+         size = sizes[i];
+      }
+
+      for (std::size_t i = 0; i < size; ++i) {
+         const std::array<double, sizeof...(Xs)> vals{{GetValue(xs, i)...}};
+         // coordinates x, y, z and weight
+         std::array<double, 4> coords{{0., 0., 0., 1.}};
+         for (int d = 0; d < kDim; ++d)
+            coords[d] = vals[d];
+         if (sizeof...(Xs) == kDim + 1)
+            coords[3] = vals[sizeof...(Xs) - 1];
+         fFill.Fill(slot, coords[0], coords[1], coords[2], coords[3]);
+      }
+   }
+
+   void Finalize() { fFill.Finalize(); }
+
+   /// The partial result is a copy of the histogram with the bin contents filled by all slots so far.
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      auto &partial = fPartialResults[slot];
+      if (!partial) {
+         partial.reset(static_cast<HIST *>(fObject->Clone()));
+         partial->SetDirectory(nullptr);
+      }
+      fFill.CopyContentsTo(*partial);
+      return *partial;
+   }
+
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
+   {
+      return std::make_unique<RMergeableFill<HIST>>(*fObject);
+   }
+
+   std::string GetActionName()
+   {
+      return std::string(fObject->IsA()->GetName()) + "\\n" + std::string(fObject->GetName());
+   }
+
+   template <typename H = HIST>
+   SharedFillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<H> *>(newResult);
+      result->Reset();
+      result->SetDirectory(nullptr);
+      return SharedFillHelper(result, fNSlots);
+   }
+};
+
 class R__CLING_PTRCHECK(off) FillTGraphHelper : public ROOT::Detail::RDF::RActionImpl<FillTGraphHelper> {
 public:
    using Result_t = ::TGraph;
@@ -1816,6 +2054,80 @@ public:
    }
 };
 
+/// Writes the output of a Snapshot to RNTuple. Its definition is in RDFActionHelpers.cxx, so that this header does not
+/// depend on RNTuple, which is only available in builds with root7=ON.
+class RNTupleSnapshotWriter;
+
+/// Throw if RNTuple output is not available or if the options cannot be honored by it
+void ValidateRNTupleSnapshotOutput(const RSnapshotOptions &opts, const std::string &dirName);
+std::shared_ptr<RNTupleSnapshotWriter>
+MakeRNTupleSnapshotWriter(const std::string &fileName, const std::string &ntupleName, const ColumnNames_t &fieldNames,
+                          const std::vector<std::string> &fieldTypes, const RSnapshotOptions &opts,
+                          unsigned int nSlots);
+/// Fill one entry, `values` holds the addresses of the values of all fields
+void FillRNTupleSnapshot(RNTupleSnapshotWriter &writer, unsigned int slot, void *const *values);
+/// Write the RNTuple to disk and point `outputDF` to it
+void FinalizeRNTupleSnapshot(RNTupleSnapshotWriter &writer, ROOT::RDataFrame &outputDF);
+/// Return the data frame to be returned by a Snapshot to RNTuple. It throws when it is used before
+/// FinalizeRNTupleSnapshot points it to the RNTuple.
+std::shared_ptr<ROOT::RDataFrame> MakeRNTupleSnapshotOutputDF(const std::string &ntupleName, const std::string &fileName);
+
+/// Helper object for a Snapshot action that writes an RNTuple. Every slot fills its own RNTuple fill context: pages are
+/// compressed by the slots in parallel and their clusters are appended to the same output file.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   unsigned int fNSlots;
+   std::string fFileName;
+   std::string fNTupleName;
+   RSnapshotOptions fOptions;
+   ColumnNames_t fOutputFieldNames;
+   /// The data frame returned by Snapshot, reading the RNTuple once it is written
+   std::shared_ptr<ROOT::RDataFrame> fOutputDF;
+   std::shared_ptr<RNTupleSnapshotWriter> fWriter;
+   bool fHasRun = false;
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options,
+                         const std::shared_ptr<ROOT::RDataFrame> &outputDF)
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntuplename), fOptions(options),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames)), fOutputDF(outputDF)
+   {
+      ValidateRNTupleSnapshotOutput(fOptions, std::string(dirname));
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+   ~SnapshotRNTupleHelper()
+   {
+      if (!fNTupleName.empty() /*not moved from*/ && fOptions.fLazy && !fHasRun)
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+   }
+
+   void Initialize()
+   {
+      fWriter = MakeRNTupleSnapshotWriter(fFileName, fNTupleName, fOutputFieldNames,
+                                          {TypeID2TypeName(typeid(ColTypes))...}, fOptions, fNSlots);
+      fHasRun = true;
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, ColTypes &...values)
+   {
+      void *const addresses[] = {&values..., nullptr};
+      FillRNTupleSnapshot(*fWriter, slot, addresses);
+   }
+
+   void Finalize()
+   {
+      FinalizeRNTupleSnapshot(*fWriter, *fOutputDF);
+      fWriter.reset();
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class R__CLING_PTRCHECK(off) AggregateHelper
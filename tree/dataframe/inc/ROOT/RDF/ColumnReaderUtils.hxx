@@ -84,8 +84,9 @@ GetColumnReaders(unsigned int slot, TTreeReader *r, TypeList<ColTypes...>, const
 
    int i = -1;
    std::array<RDFDetail::RColumnReaderBase *, sizeof...(ColTypes)> ret{
-      (++i, GetColumnReader<ColTypes>(slot, colRegister.GetReader(slot, colNames[i], variationName, typeid(ColTypes)),
-                                      lm, r, colNames[i]))...};
+      (++i, GetColumnReader<ColTypes>(slot,
+                                      colRegister.GetReader(slot, r, colNames[i], variationName, typeid(ColTypes)), lm,
+                                      r, colNames[i]))...};
    return ret;
 }
 
@@ -51,6 +51,9 @@ class GraphNode {
 
    std::string fName, fColor, fShape;
 
+   /// Time and number of calls of the node, if it was profiled. Appended to the label in the dot representation.
+   std::string fProfile;
+
    /// Columns defined up to this node. By checking the defined columns between two consecutive
    /// nodes, it is possible to know if there was some Define in between.
    std::vector<std::string> fDefinedColumns;
@@ -137,6 +140,8 @@ public:
    unsigned int GetID() const { return fID; }
    std::string GetName() const { return fName; }
    std::string GetShape() const { return fShape; }
+   const std::string &GetProfile() const { return fProfile; }
+   void SetProfile(const std::string &profile) { fProfile = profile; }
    GraphNode *GetPrevNode() const { return fPrevNode.get(); }
 
    ////////////////////////////////////////////////////////////////////////////
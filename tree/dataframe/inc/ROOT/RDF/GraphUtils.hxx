@@ -31,8 +31,12 @@ class RRangeBase;
 namespace Internal {
 namespace RDF {
 class RColumnRegister;
+class RNodeProfile;
 namespace GraphDrawing {
 
+/// Format the profile of a node as an annotation of its label, empty if the node was never profiled.
+std::string FormatProfile(const ROOT::Internal::RDF::RNodeProfile &profile);
+
 std::shared_ptr<GraphNode> CreateDefineNode(const std::string &columnName,
                                             const ROOT::Detail::RDF::RDefineBase *columnPtr,
                                             std::unordered_map<void *, std::shared_ptr<GraphNode>> &visitedMap);
@@ -60,6 +64,14 @@ private:
    /// \brief Map to keep track of visited nodes when constructing the computation graph (SaveGraph)
    std::unordered_map<void *, std::shared_ptr<GraphNode>> fVisitedMap;
 
+   /// Whether the labels of the nodes are annotated with their profile, see ROOT::RDF::Experimental::EnableProfiling
+   bool fWithProfile = true;
+
+   std::string GetLabel(const GraphNode &node) const
+   {
+      return fWithProfile ? node.GetName() + node.GetProfile() : node.GetName();
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Starting from any leaf (Action, Filter, Range) it draws the dot representation of the branch.
    std::string FromGraphLeafToDot(const GraphNode &leaf) const;
@@ -69,6 +81,10 @@ private:
    std::string FromGraphActionsToDot(std::vector<std::shared_ptr<GraphNode>> leaves) const;
 
 public:
+   GraphCreatorHelper() = default;
+   /// Use `withProfile = false` for a representation that does not depend on previous event loops.
+   explicit GraphCreatorHelper(bool withProfile) : fWithProfile(withProfile) {}
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Starting from the root node, prints the entire graph.
    std::string RepresentGraph(ROOT::RDataFrame &rDataFrame);
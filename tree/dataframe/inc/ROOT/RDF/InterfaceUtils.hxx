@@ -44,6 +44,7 @@
 class TObjArray;
 class TTree;
 namespace ROOT {
+class RDataFrame;
 namespace Detail {
 namespace RDF {
 class RNodeBase;
@@ -125,15 +126,41 @@ struct HistoUtils<T, false> {
    static bool HasAxisLimits(T &) { return true; }
 };
 
+// Filling of per-slot copies of the result, merged at the end of the event loop
+template <typename... ColTypes, typename ActionResultType, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildFillAction(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h, const unsigned int nSlots,
+                std::shared_ptr<PrevNodeType> prevNode, const RColumnRegister &colRegister,
+                std::false_type /*canUseSharedFill*/)
+{
+   using Helper_t = FillHelper<ActionResultType>;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+}
+
+// Large histograms with fixed axes are filled concurrently by all slots rather than copied, see UseSharedFill
+template <typename... ColTypes, typename ActionResultType, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildFillAction(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h, const unsigned int nSlots,
+                std::shared_ptr<PrevNodeType> prevNode, const RColumnRegister &colRegister,
+                std::true_type /*canUseSharedFill*/)
+{
+   if (!UseSharedFill(*h, nSlots))
+      return BuildFillAction<ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister, std::false_type{});
+
+   using Helper_t = SharedFillHelper<ActionResultType>;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+}
+
 // Generic filling (covers Histo2D, Histo3D, HistoND, Profile1D and Profile2D actions, with and without weights)
 template <typename... ColTypes, typename ActionTag, typename ActionResultType, typename PrevNodeType>
 std::unique_ptr<RActionBase>
 BuildAction(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h, const unsigned int nSlots,
             std::shared_ptr<PrevNodeType> prevNode, ActionTag, const RColumnRegister &colRegister)
 {
-   using Helper_t = FillHelper<ActionResultType>;
-   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
-   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+   using CanUseSharedFill_t = std::integral_constant<bool, CanUseSharedFill<ActionResultType, ColTypes...>::value>;
+   return BuildFillAction<ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister, CanUseSharedFill_t{});
 }
 
 // Histo1D filling (must handle the special case of distinguishing FillHelper and BufferedFillHelper
@@ -145,9 +172,8 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h, const uns
    auto hasAxisLimits = HistoUtils<::TH1D>::HasAxisLimits(*h);
 
    if (hasAxisLimits) {
-      using Helper_t = FillHelper<::TH1D>;
-      using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
-      return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+      using CanUseSharedFill_t = std::integral_constant<bool, CanUseSharedFill<::TH1D, ColTypes...>::value>;
+      return BuildFillAction<ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister, CanUseSharedFill_t{});
    } else {
       using Helper_t = BufferedFillHelper;
       using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
@@ -251,6 +277,8 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// The data frame returned by Snapshot, only needed if it must be constructed after the output is written
+   std::shared_ptr<ROOT::RDataFrame> fOutputDF;
 };
 
 // Snapshot action
@@ -276,7 +304,14 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    std::vector<bool> isDefine = makeIsDefine();
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+      // same helper for single- and multi-thread snapshots
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(new Action_t(
+         Helper_t(nSlots, filename, dirname, treename, outputColNames, options, snapHelperArgs->fOutputDF), colNames,
+         prevNode, colRegister));
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -327,6 +362,20 @@ void CheckForDefinition(const std::string &where, std::string_view definedColVie
 void CheckForNoVariations(const std::string &where, std::string_view definedColView,
                           const RColumnRegister &colRegister);
 
+/// Declare to the interpreter all jitted functions booked by Filter, Define and Vary calls that have not been declared
+/// yet, in a single transaction. If that fails, the functions are declared one by one and the ones that do not compile
+/// are dropped, such that only the computation graphs that use them fail.
+void DeclarePendingFunctions();
+
+/// The file of the on-disk cache of return types (RDataFrame.JitTypeCacheDir) for the function jitted from the given
+/// expression, in which the columns have been replaced by the variables vars of types varTypes. Used in tests.
+std::string GetJitTypeCacheFile(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes);
+
+/// Store type as the return type of the function jitted from the given expression in the on-disk cache of return
+/// types, see GetJitTypeCacheFile. Used in tests.
+void WriteJitTypeCacheEntry(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes,
+                            const std::string &type);
+
 std::string PrettyPrintAddr(const void *const addr);
 
 std::shared_ptr<RJittedFilter> BookFilterJit(std::shared_ptr<RNodeBase> *prevNodeOnHeap, std::string_view name,
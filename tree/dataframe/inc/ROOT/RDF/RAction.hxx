@@ -37,6 +37,7 @@ std::shared_ptr<GraphNode> AddDefinesToGraph(std::shared_ptr<GraphNode> node,
                                              const RDFInternal::RColumnRegister &colRegister,
                                              const std::vector<std::string> &prevNodeDefines,
                                              std::unordered_map<void *, std::shared_ptr<GraphNode>> &visitedMap);
+std::string FormatProfile(const RNodeProfile &profile);
 } // namespace GraphDrawing
 
 // clang-format off
@@ -109,12 +110,16 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevNode.CheckFilters(slot, entry))
+      if (fPrevNode.CheckFilters(slot, entry)) {
+         RProfileScope profileScope(fProfile, fLoopManager->GetProfiler(), slot);
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
    }
 
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final
    {
@@ -140,6 +145,7 @@ public:
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
       auto thisNode =
          std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName(), visitedMap.size(), nodeType);
+      thisNode->SetProfile(RDFGraphDrawing::FormatProfile(fProfile));
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
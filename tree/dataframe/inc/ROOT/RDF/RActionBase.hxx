@@ -12,6 +12,7 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
@@ -42,6 +43,8 @@ protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   /// Time spent executing this action, filled if profiling is enabled.
+   RNodeProfile fProfile;
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -63,6 +66,9 @@ public:
    RColumnRegister &GetColRegister() { return fColRegister; }
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
+   const RNodeProfile &GetProfile() const { return fProfile; }
+   /// The name of the action as used in profile reports. Overridden by RAction.
+   virtual std::string GetActionName() { return "Action"; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
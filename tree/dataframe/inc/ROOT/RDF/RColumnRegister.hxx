@@ -19,6 +19,8 @@
 #include <string>
 #include <vector>
 
+class TTreeReader;
+
 namespace ROOT {
 namespace RDF {
 class RVariationsDescription;
@@ -53,7 +55,9 @@ class RDefinesWithReaders {
 public:
    RDefinesWithReaders(std::shared_ptr<RDefineBase> define, unsigned int nSlots);
    RDefineBase &GetDefine() const { return *fDefine; }
-   RDefineReader &GetReader(unsigned int slot, const std::string &variationName);
+   /// Return the reader of the define for this slot and variation, initializing the slot of the define for the current
+   /// task if this is its first reader in the task.
+   RDefineReader &GetReader(unsigned int slot, TTreeReader *r, const std::string &variationName);
 };
 
 class RVariationsWithReaders {
@@ -146,7 +150,7 @@ public:
 
    ROOT::RDF::RVariationsDescription BuildVariationsDescription() const;
 
-   RDFDetail::RColumnReaderBase *GetReader(unsigned int slot, const std::string &colName,
+   RDFDetail::RColumnReaderBase *GetReader(unsigned int slot, TTreeReader *r, const std::string &colName,
                                            const std::string &variationName, const std::type_info &tid);
 };
 
@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
@@ -48,6 +49,9 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   RDFInternal::RNodeProfile fProfile;      ///< Time spent evaluating this define, filled if profiling is enabled
+   /// Per-slot identifier of the last task for which InitSlot was called, see InitSlotOnDemand.
+   std::vector<ULong64_t> fInitTaskIds;
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -57,11 +61,16 @@ public:
    RDefineBase &operator=(RDefineBase &&) = delete;
    virtual ~RDefineBase();
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
+   /// Call InitSlot if it has not been called yet in the task currently running in this slot.
+   void InitSlotOnDemand(TTreeReader *r, unsigned int slot);
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
    virtual void *GetValuePtr(unsigned int slot) = 0;
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
    std::string GetTypeName() const;
+   const std::string &GetVariation() const { return fVariation; }
+   /// Overridden by RJittedDefine, whose concrete define is the one that is profiled.
+   virtual const RDFInternal::RNodeProfile &GetProfile() const { return fProfile; }
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "ROOT/RVec.hxx"
 #include "RtypesCore.h"
@@ -48,6 +49,7 @@ protected:
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   RDFInternal::RNodeProfile fProfile; ///< Time spent evaluating this filter, filled if profiling is enabled
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -60,6 +62,8 @@ public:
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    bool HasName() const;
    std::string GetName() const;
+   const std::string &GetVariation() const { return fVariation; }
+   const RDFInternal::RNodeProfile &GetProfile() const { return fProfile; }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
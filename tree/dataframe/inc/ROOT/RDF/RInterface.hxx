@@ -86,11 +86,17 @@ template <typename Proxied, typename DataSource>
 class RInterface;
 
 using RNode = RInterface<::ROOT::Detail::RDF::RNodeBase, void>;
+
+namespace Experimental {
+void EnableProfiling(const RNode &node, bool enable);
+RProfileReport GetProfileReport(const RNode &node);
+} // namespace Experimental
 } // namespace RDF
 
 namespace Internal {
 namespace RDF {
 void ChangeEmptyEntryRange(const ROOT::RDF::RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
+std::string GetDatasetFingerprint(const ROOT::RDF::RNode &node);
 } // namespace RDF
 } // namespace Internal
 
@@ -122,6 +128,9 @@ class RInterface : public RInterfaceBase {
 
    friend void RDFInternal::TriggerRun(RNode &node);
    friend void RDFInternal::ChangeEmptyEntryRange(const RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
+   friend void Experimental::EnableProfiling(const RNode &node, bool enable);
+   friend Experimental::RProfileReport Experimental::GetProfileReport(const RNode &node);
+   friend std::string RDFInternal::GetDatasetFingerprint(const RNode &node);
 
    std::shared_ptr<Proxied> fProxiedPtr; ///< Smart pointer to the graph node encapsulated by this RInterface.
 
@@ -910,6 +919,15 @@ public:
    /// the TTree as part of the TTree name, e.g. `df.Snapshot("subdir/t", "f.root")` write TTree `t` in the
    /// sub-directory `subdir` of file `f.root` (creating file and sub-directory as needed).
    ///
+   /// ### Writing RNTuple
+   ///
+   /// If ROOT is built with root7=ON, Snapshot can write an RNTuple instead of a TTree by setting
+   /// `RSnapshotOptions::fOutputFormat` to `ESnapshotOutputFormat::kRNTuple`. In multi-thread runs, every slot fills and
+   /// compresses its own clusters, which are then appended to the same output file. The compression settings of
+   /// RSnapshotOptions apply; only the "RECREATE" mode is supported and the RNTuple cannot be written to a
+   /// sub-directory. The returned `RDataFrame` reads the RNTuple: accessing it runs the event loop of a lazy Snapshot
+   /// first, as for any other result.
+   ///
    /// \attention In multi-thread runs (i.e. when EnableImplicitMT() has been called) threads will loop over clusters of
    /// entries in an undefined order, so Snapshot will produce outputs in which (clusters of) entries will be shuffled with
    /// respect to the input TTree. Using such "shuffled" TTrees as friends of the original trees would result in wrong
@@ -988,8 +1006,7 @@ public:
          RDFInternal::SnapshotHelperArgs{std::string(filename), std::string(dirname), std::string(treename),
                                          colListWithAliasesAndSizeBranches, options});
 
-      ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      auto newRDF = MakeSnapshotOutputDF(fullTreeName, filename, colListNoAliasesWithSizeBranches, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, fProxiedPtr,
@@ -2801,9 +2818,7 @@ private:
       auto snapHelperArgs = std::make_shared<RDFInternal::SnapshotHelperArgs>(RDFInternal::SnapshotHelperArgs{
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
-      ::TDirectory::TContext ctxt;
-      auto newRDF =
-         std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns);
+      auto newRDF = MakeSnapshotOutputDF(fullTreeName, filename, columnListWithoutSizeColumns, *snapHelperArgs);
 
       // The Snapshot helper will use validCols (with aliases resolved) as input columns, and
       // columnListWithoutSizeColumns (still with aliases in it, passed through snapHelperArgs) as output column names.
@@ -2815,6 +2830,24 @@ private:
       return resPtr;
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the data frame returned by Snapshot, reading the output dataset.
+   std::shared_ptr<ROOT::RDataFrame> MakeSnapshotOutputDF(std::string_view fullTreeName, std::string_view filename,
+                                                          const ColumnNames_t &defaultColumns,
+                                                          RDFInternal::SnapshotHelperArgs &snapHelperArgs)
+   {
+      if (snapHelperArgs.fOptions.fOutputFormat == ESnapshotOutputFormat::kRNTuple) {
+         // The RNTuple can only be opened once it is written: the action points this data frame to it at the end of
+         // the event loop, until then using it throws
+         snapHelperArgs.fOutputDF =
+            RDFInternal::MakeRNTupleSnapshotOutputDF(std::string(fullTreeName), std::string(filename));
+         return snapHelperArgs.fOutputDF;
+      }
+
+      ::TDirectory::TContext ctxt;
+      return std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, defaultColumns);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Implementation of cache.
    template <typename... ColTypes, std::size_t... S>
@@ -16,6 +16,8 @@
 #include "ROOT/RDF/RDatasetSpec.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 
 #include <functional>
@@ -148,9 +150,15 @@ class RLoopManager : public RNodeBase {
    RDFInternal::RNewSampleNotifier fNewSampleNotifier;
    std::vector<ROOT::RDF::RSampleInfo> fSampleInfos;
    unsigned int fNRuns{0}; ///< Number of event loops run
+   /// Profiling state, created the first time profiling is enabled, see ROOT::RDF::Experimental::EnableProfiling
+   std::unique_ptr<RDFInternal::RLoopProfiler> fProfiler;
+   bool fProfilingEnabled{false};
 
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::unique_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
+   /// Per-slot counter of the tasks that have been started, used by Defines to initialize their slot at most once
+   /// per task, and only if some node reads their value.
+   std::vector<ULong64_t> fSlotTaskIds;
 
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
@@ -167,6 +175,7 @@ class RLoopManager : public RNodeBase {
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
+   void ProfileDataSourceColumnReaders(bool profile);
    void CleanUpTask(TTreeReader *r, unsigned int slot);
    void EvalChildrenCounts();
    void SetupSampleCallbacks(TTreeReader *r, unsigned int slot);
@@ -181,7 +190,6 @@ public:
    RLoopManager(const RLoopManager &) = delete;
    RLoopManager &operator=(const RLoopManager &) = delete;
 
-   void JitDeclarations();
    void Jit();
    RLoopManager *GetLoopManagerUnchecked() final { return this; }
    void Run(bool jit = true);
@@ -238,6 +246,15 @@ public:
    void AddSampleCallback(void *nodePtr, ROOT::RDF::SampleCallback_t &&callback);
 
    void SetEmptyEntryRange(std::pair<ULong64_t, ULong64_t> &&newRange);
+
+
+   /// Identifier of the task currently running in the given slot.
+   ULong64_t GetSlotTaskId(unsigned int slot) const { return fSlotTaskIds[slot]; }
+
+   void EnableProfiling(bool enable);
+   /// Return the profiler the nodes report to, null if profiling is disabled.
+   RDFInternal::RLoopProfiler *GetProfiler() const { return fProfilingEnabled ? fProfiler.get() : nullptr; }
+   ROOT::RDF::Experimental::RProfileReport GetProfileReport() const;
 };
 
 } // ns RDF
@@ -71,6 +71,9 @@ public:
 
    virtual RLoopManager *GetLoopManagerUnchecked() { return fLoopManager; }
 
+   /// Number of nodes that will pull entries from this one in the next event loop, as set by TriggerChildrenCount.
+   unsigned int GetNChildren() const { return fNChildren; }
+
    const std::vector<std::string> &GetVariations() const { return fVariations; }
 
    /// Return a clone of this node that acts as a Filter working with values in the variationName "universe".
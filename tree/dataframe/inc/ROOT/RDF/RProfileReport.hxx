@@ -0,0 +1,68 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILEREPORT
+#define ROOT_RDF_RPROFILEREPORT
+
+#include "ROOT/RStringView.hxx"
+#include "RtypesCore.h"
+
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/// Profile of a Filter, Define or action of the computation graph.
+struct RNodeProfileInfo {
+   std::string fKind; ///< "Filter", "Define" or "Action"
+   std::string fName; ///< Filter name, defined column name or action name
+   double fTime;      ///< Wall time spent in the node, excluding nested nodes, summed over all slots, in seconds
+   ULong64_t fNCalls; ///< Number of evaluations
+};
+
+/// Entries read from a column of the dataset.
+struct RColumnProfileInfo {
+   std::string fName;
+   ULong64_t fNEntries; ///< Number of entries for which the column was read, summed over all slots
+   /// Uncompressed bytes read, estimated from the average entry size of the branch. Zero for data sources.
+   double fBytes;
+};
+
+/**
+\class ROOT::RDF::Experimental::RProfileReport
+\ingroup dataframe
+\brief Time spent in the nodes of a computation graph and entries read per column, see GetProfileReport().
+
+Nodes are sorted by decreasing time. All figures are accumulated over the event loops run with profiling enabled.
+**/
+class RProfileReport {
+   double fLoopTime = 0.;
+   std::vector<RNodeProfileInfo> fNodes;
+   std::vector<RColumnProfileInfo> fColumns;
+
+public:
+   RProfileReport(double loopTime, std::vector<RNodeProfileInfo> nodes, std::vector<RColumnProfileInfo> columns);
+
+   /// Wall time of the event loops, in seconds.
+   double GetLoopTime() const { return fLoopTime; }
+   const std::vector<RNodeProfileInfo> &GetNodes() const { return fNodes; }
+   const std::vector<RColumnProfileInfo> &GetColumns() const { return fColumns; }
+   /// Return the profile of the first node with the given name. Throws if there is no such node.
+   const RNodeProfileInfo &GetNode(std::string_view name) const;
+   void Print() const;
+   /// Return the report as a JSON object with the keys "loopTime", "nodes" and "columns".
+   std::string AsJSON() const;
+};
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RPROFILEREPORT
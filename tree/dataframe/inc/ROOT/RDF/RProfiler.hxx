@@ -0,0 +1,179 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILER
+#define ROOT_RDF_RPROFILER
+
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+using ProfileClock_t = std::chrono::steady_clock;
+
+/// Wall time spent in a node of the computation graph and number of calls, accumulated per processing slot.
+/// It is only filled while profiling is enabled, see ROOT::RDF::Experimental::EnableProfiling.
+class RNodeProfile {
+   struct RSlotProfile {
+      ProfileClock_t::duration fTime{0};
+      ULong64_t fNCalls = 0;
+   };
+   std::vector<RSlotProfile> fSlotProfiles;
+
+public:
+   RNodeProfile(unsigned int nSlots) : fSlotProfiles(nSlots * CacheLineStep<RSlotProfile>()) {}
+
+   void Add(unsigned int slot, ProfileClock_t::duration time)
+   {
+      auto &p = fSlotProfiles[slot * CacheLineStep<RSlotProfile>()];
+      p.fTime += time;
+      ++p.fNCalls;
+   }
+
+   /// Total time in seconds, summed over all slots.
+   double GetTime() const
+   {
+      ProfileClock_t::duration time{0};
+      for (auto i = 0u; i < fSlotProfiles.size(); i += CacheLineStep<RSlotProfile>())
+         time += fSlotProfiles[i].fTime;
+      return std::chrono::duration<double>(time).count();
+   }
+
+   ULong64_t GetNCalls() const
+   {
+      ULong64_t nCalls = 0;
+      for (auto i = 0u; i < fSlotProfiles.size(); i += CacheLineStep<RSlotProfile>())
+         nCalls += fSlotProfiles[i].fNCalls;
+      return nCalls;
+   }
+};
+
+/// The profiling state of a RLoopManager: the time spent in nested profiling scopes, per slot, and the entries read
+/// per dataset column.
+class RLoopProfiler {
+public:
+   struct RColumnProfile {
+      ULong64_t fNEntries = 0;
+      double fBytes = 0.;
+   };
+
+private:
+   std::vector<ProfileClock_t::duration> fNestedTimes;
+   std::mutex fColumnsMutex;
+   std::map<std::string, RColumnProfile> fColumnProfiles;
+   double fLoopTime = 0.; ///< Wall time of the event loops run with profiling enabled, in seconds
+
+public:
+   RLoopProfiler(unsigned int nSlots) : fNestedTimes(nSlots * CacheLineStep<ProfileClock_t::duration>()) {}
+
+   ProfileClock_t::duration &GetNestedTime(unsigned int slot)
+   {
+      return fNestedTimes[slot * CacheLineStep<ProfileClock_t::duration>()];
+   }
+
+   /// Thread-safe, called at the end of each task.
+   void AddColumnReads(const std::string &column, ULong64_t nEntries, double bytes)
+   {
+      std::lock_guard<std::mutex> lock(fColumnsMutex);
+      auto &p = fColumnProfiles[column];
+      p.fNEntries += nEntries;
+      p.fBytes += bytes;
+   }
+
+   const std::map<std::string, RColumnProfile> &GetColumnProfiles() const { return fColumnProfiles; }
+
+   void AddLoopTime(double seconds) { fLoopTime += seconds; }
+   double GetLoopTime() const { return fLoopTime; }
+};
+
+/// Wraps a dataset column reader and counts the distinct entries read through it.
+/// The RLoopManager only installs it for event loops run with profiling enabled, so that the column readers of
+/// unprofiled event loops do not pay for the bookkeeping.
+class R__CLING_PTRCHECK(off) RProfiledColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> fReader;
+   ULong64_t fNEntriesRead = 0; ///< Number of distinct entries read since the last call to TakeNEntriesRead
+   Long64_t fLastEntryRead = -1;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      if (entry != fLastEntryRead) {
+         ++fNEntriesRead;
+         fLastEntryRead = entry;
+      }
+      // the value type is irrelevant here, we only forward the address of the value
+      return &fReader->Get<char>(entry);
+   }
+
+public:
+   RProfiledColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader) : fReader(std::move(reader))
+   {
+   }
+
+   /// Return the wrapped reader, leaving this object empty.
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> Release() { return std::move(fReader); }
+
+   /// Return the number of distinct entries read since the last call, and reset the count.
+   ULong64_t TakeNEntriesRead()
+   {
+      const auto n = fNEntriesRead;
+      fNEntriesRead = 0;
+      return n;
+   }
+};
+
+/// Measures the exclusive wall time of a call of a node: the time spent in nested scopes of the same slot, e.g. in
+/// Defines that are evaluated when a Filter reads its inputs, is accounted to the nested nodes only.
+/// Does nothing if the profiler is null, i.e. if profiling is disabled.
+class RProfileScope {
+   RNodeProfile &fProfile;
+   RLoopProfiler *fProfiler;
+   unsigned int fSlot;
+   ProfileClock_t::duration fOuterNestedTime{0};
+   ProfileClock_t::time_point fStart;
+
+public:
+   RProfileScope(RNodeProfile &profile, RLoopProfiler *profiler, unsigned int slot)
+      : fProfile(profile), fProfiler(profiler), fSlot(slot)
+   {
+      if (!fProfiler)
+         return;
+      auto &nested = fProfiler->GetNestedTime(fSlot);
+      fOuterNestedTime = nested;
+      nested = ProfileClock_t::duration{0};
+      fStart = ProfileClock_t::now();
+   }
+
+   RProfileScope(const RProfileScope &) = delete;
+   RProfileScope &operator=(const RProfileScope &) = delete;
+
+   ~RProfileScope()
+   {
+      if (!fProfiler)
+         return;
+      const auto elapsed = ProfileClock_t::now() - fStart;
+      auto &nested = fProfiler->GetNestedTime(fSlot);
+      fProfile.Add(fSlot, elapsed - nested);
+      nested = fOuterNestedTime + elapsed;
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RPROFILER
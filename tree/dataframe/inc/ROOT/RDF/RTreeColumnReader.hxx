@@ -81,7 +81,10 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
       // Currently we need the first entry to have been loaded to perform the check
       // TODO Move check to constructor once ROOT-10823 is fixed and TTreeReaderArray itself exposes this information
       const auto readerArraySize = readerArray.GetSize();
-      if (EStorageType::kUnknown == fStorageType && readerArraySize > 1) {
+      if (EStorageType::kUnknown == fStorageType && readerArray.IsContiguous()) {
+         // The TTreeReaderArray reads the branch in bulk, into a contiguous buffer.
+         fStorageType = EStorageType::kContiguous;
+      } else if (EStorageType::kUnknown == fStorageType && readerArraySize > 1) {
          // We can decide since the array is long enough
          fStorageType = EStorageType::kContiguous;
          for (auto i = 0u; i < readerArraySize - 1; ++i) {
@@ -151,16 +154,18 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<bool>> final : public ROOT::
    /// We return a reference to this RVec to clients, to guarantee a stable address and contiguous memory layout
    RVec<bool> fRVec;
 
-   // We always copy the contents of TTreeReaderArray<bool> into an RVec<bool> (never take a view into the memory
+   // We copy the contents of TTreeReaderArray<bool> into an RVec<bool> (rather than taking a view into the memory
    // buffer) because the underlying memory buffer might be the one of a std::vector<bool>, which is not a contiguous
    // slab of bool values.
-   // Note that this also penalizes the case in which the column type is actually bool[], but the possible performance
-   // gains in this edge case is probably not worth the extra complication required to differentiate the two cases.
+   // The exception is a TTreeReaderArray<bool> that reads the branch in bulk, which always exposes contiguous bools.
    void *GetImpl(Long64_t) final
    {
       auto &readerArray = *fTreeArray;
       const auto readerArraySize = readerArray.GetSize();
-      if (readerArraySize > 0) {
+      if (readerArraySize > 0 && readerArray.IsContiguous()) {
+         RVec<bool> rvec(&readerArray.At(0), readerArraySize);
+         swap(fRVec, rvec);
+      } else if (readerArraySize > 0) {
          // always perform a copy
          RVec<bool> rvec(readerArray.begin(), readerArray.end());
          swap(fRVec, rvec);
@@ -0,0 +1,174 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_MULTIPROCESS
+#define ROOT_RDF_MULTIPROCESS
+
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDF/RDatasetSpec.hxx>
+#include <ROOT/RDF/RMergeableValue.hxx>
+#include <ROOT/RResultPtr.hxx>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility> // std::index_sequence
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/// Options for RunMultiProcess()
+struct RMultiProcessOptions {
+   /// Number of worker processes. 0 means one per core.
+   unsigned int fNWorkers = 0;
+   /// Number of parts in which the dataset is split. Each part is processed by one worker with a separate event loop,
+   /// workers pick up new parts as they finish the previous ones. 0 means one part per worker.
+   unsigned int fNTasks = 0;
+};
+
+} // namespace Experimental
+} // namespace RDF
+
+namespace Internal {
+namespace RDF {
+
+/// The results of one task: an error message, empty if the task succeeded, followed by the class name and the
+/// serialized content of the mergeable value of each result.
+using MultiProcessTaskResult_t = std::vector<std::string>;
+using MultiProcessTask_t = std::function<void(ROOT::RDF::RNode &, MultiProcessTaskResult_t &)>;
+
+/// Split the dataset in entry ranges and run the task on each of them in worker processes.
+/// Throws if a task fails or a worker process is lost.
+std::vector<MultiProcessTaskResult_t>
+RunMultiProcessTasks(const ROOT::RDF::Experimental::RDatasetSpec &spec,
+                     const ROOT::RDF::Experimental::RMultiProcessOptions &options, const MultiProcessTask_t &task);
+
+void SerializeMergeable(const ROOT::Detail::RDF::RMergeableValueBase &value, MultiProcessTaskResult_t &result);
+std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase>
+DeserializeMergeable(const std::string &className, const std::string &buffer);
+
+template <typename T>
+void MergeTaskResult(std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<T>> &merged, const std::string &className,
+                     const std::string &buffer)
+{
+   std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<T>> value{
+      static_cast<ROOT::Detail::RDF::RMergeableValue<T> *>(DeserializeMergeable(className, buffer).release())};
+   if (!merged)
+      merged = std::move(value);
+   else
+      ROOT::Detail::RDF::MergeValues(*merged, *value);
+}
+
+/// Whether the mergeable values of results of type T have a dictionary, i.e. can be sent back by the worker processes.
+/// It must be kept in sync with the RMergeable* classes selected in LinkDef.h.
+template <typename T>
+struct IsMultiProcessResult
+   : std::integral_constant<
+        bool, std::is_same<T, int>::value || std::is_same<T, unsigned int>::value || std::is_same<T, float>::value ||
+                 std::is_same<T, double>::value || std::is_same<T, Long64_t>::value ||
+                 std::is_same<T, ULong64_t>::value || std::is_same<T, TH1D>::value || std::is_same<T, TH2D>::value ||
+                 std::is_same<T, TH3D>::value || std::is_same<T, THnD>::value || std::is_same<T, TGraph>::value ||
+                 std::is_same<T, TStatistic>::value || std::is_same<T, TProfile>::value ||
+                 std::is_same<T, TProfile2D>::value> {
+};
+
+template <typename Results_t>
+struct MultiProcessTraits;
+
+template <typename... Ts>
+struct MultiProcessTraits<std::tuple<ROOT::RDF::RResultPtr<Ts>...>> {
+   using Merged_t = std::tuple<std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<Ts>>...>;
+
+   // true for all Ts if shifting the sequence of IsMultiProcessResult values by one does not change it
+   static_assert(std::is_same<std::integer_sequence<bool, true, IsMultiProcessResult<Ts>::value...>,
+                              std::integer_sequence<bool, IsMultiProcessResult<Ts>::value..., true>>::value,
+                 "RunMultiProcess: the supported result types are int, unsigned int, float, double, Long64_t, "
+                 "ULong64_t, TH1D, TH2D, TH3D, THnD, TGraph, TStatistic, TProfile and TProfile2D.");
+
+   template <typename F, std::size_t... S>
+   static Merged_t Run(const ROOT::RDF::Experimental::RDatasetSpec &spec, F &bookResults,
+                       const ROOT::RDF::Experimental::RMultiProcessOptions &options, std::index_sequence<S...>)
+   {
+      // executed in the worker processes
+      auto task = [&bookResults](ROOT::RDF::RNode &node, MultiProcessTaskResult_t &result) {
+         auto results = bookResults(node);
+         // the first call runs the event loop for all results
+         int expander[] = {
+            0, (SerializeMergeable(*ROOT::Detail::RDF::GetMergeableValue(std::get<S>(results)), result), 0)...};
+         (void)expander;
+      };
+
+      const auto taskResults = RunMultiProcessTasks(spec, options, task);
+
+      Merged_t merged;
+      for (const auto &r : taskResults) {
+         int expander[] = {0, (MergeTaskResult(std::get<S>(merged), r[1 + 2 * S], r[2 + 2 * S]), 0)...};
+         (void)expander;
+      }
+      return merged;
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+namespace Experimental {
+
+// clang-format off
+////////////////////////////////////////////////////////////////////////////
+/// \brief Process a dataset in several worker processes and merge the results.
+/// \param[in] spec The dataset to process.
+/// \param[in] bookResults A callable that takes the RNode of a RDataFrame and returns a `std::tuple` of the RResultPtrs
+///            booked on it.
+/// \param[in] options The number of worker processes and of parts in which the dataset is split.
+/// \return A `std::tuple` with the merged results, as RMergeableValues in the same order as the RResultPtrs.
+///
+/// The entries of the dataset are split in contiguous ranges, each processed by a worker process forked from the
+/// current one, via ROOT::TProcessExecutor. For each range, the worker constructs a RDataFrame from `spec`,
+/// restricted to the range, calls `bookResults` on it and runs the event loop. The partial results are sent back to
+/// this process, where they are merged.
+///
+/// Unlike implicit multi-threading, the workers share neither the interpreter nor the memory, so that jitting does not
+/// contend for locks and a misbehaving worker does not bring down the whole job: an exception in a worker, or the
+/// loss of a worker process, results in an exception in this process.
+///
+/// The workers run their event loops sequentially, and implicit multi-threading must be disabled in this process,
+/// as thread pools do not survive forking. The results must be counts, sums, minima, maxima, means, standard deviations,
+/// histograms, profiles, graphs or statistics, whose mergeable values have dictionaries to be sent back: other result
+/// types are rejected at compile time.
+///
+/// ~~~{.cpp}
+/// auto spec = ROOT::RDF::Experimental::RDatasetSpec().AddGroup({"data", "events", "data_*.root"});
+/// auto results = ROOT::RDF::Experimental::RunMultiProcess(spec, [](ROOT::RDF::RNode df) {
+///    auto sel = df.Filter("nMuon == 2");
+///    return std::make_tuple(sel.Count(), sel.Histo1D({"pt", "pt", 100, 0., 100.}, "Muon_pt"));
+/// });
+/// const auto nSelected = std::get<0>(results)->GetValue();
+/// const TH1D &pt = std::get<1>(results)->GetValue();
+/// ~~~
+// clang-format on
+template <typename F>
+auto RunMultiProcess(const RDatasetSpec &spec, F bookResults,
+                     const RMultiProcessOptions &options = RMultiProcessOptions())
+   -> typename ROOT::Internal::RDF::MultiProcessTraits<decltype(bookResults(std::declval<RNode &>()))>::Merged_t
+{
+   using Results_t = decltype(bookResults(std::declval<RNode &>()));
+   return ROOT::Internal::RDF::MultiProcessTraits<Results_t>::Run(
+      spec, bookResults, options, std::make_index_sequence<std::tuple_size<Results_t>::value>());
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_MULTIPROCESS
@@ -55,9 +55,20 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<std::string> fColumnTypes;
    std::vector<size_t> fActiveColumns;
 
+   /// A simple cut min <= value <= max on a field with one value per entry, used to skip clusters
+   struct RRangeFilter {
+      DescriptorId_t fFieldId = kInvalidDescriptorId;
+      double fMin = 0.;
+      double fMax = 0.;
+   };
+   std::vector<RRangeFilter> fRangeFilters;
+
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
+   /// With range filters, the entry ranges are the clusters that cannot be skipped based on the page statistics
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetFilteredEntryRanges();
+
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
    /// of fieldId. For instance, if fieldId refers to an `std::vector<Jet>`, with
@@ -83,6 +94,13 @@ public:
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
+   /// Restricts the event loop to the clusters that may contain entries with a value of the given column in the
+   /// closed interval [min, max], according to the page statistics stored in the RNTuple (see
+   /// RNTupleWriteOptions::SetEnablePageStatistics). Several range filters are combined with a logical AND.
+   /// The range filter is only an optimization: the entries of the remaining clusters are not filtered, so the
+   /// computation graph still needs a corresponding Filter(). Must be called before the event loop starts.
+   void AddRangeFilter(std::string_view colName, double min, double max);
+
    void Initialize() final;
    void Finalize() final;
 
@@ -0,0 +1,182 @@
+/// \file RPersistentCache.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2023-06-12
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RPersistentCache
+#define ROOT_RPersistentCache
+
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDF/InterfaceUtils.hxx>
+#include <ROOT/RDF/Utils.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/// Options for PersistentCache()
+struct RPersistentCacheOptions {
+   /// Directory in which the cache files are created and looked up
+   std::string fCacheDir = ".";
+   /// Additional string that is mixed into the cache key. The key is computed from the structure of the computation
+   /// graph and from the input dataset; it does not cover the code of user-provided callables. The user key should
+   /// therefore change whenever the code of Filters and Defines changes, e.g. a version tag or the jitted
+   /// expressions. It is required for inputs that cannot be identified across processes (data sources,
+   /// in-memory trees).
+   std::string fUserKey;
+   /// Write options of the cache file. The cluster size limits the memory needed to write the cache.
+   ROOT::Experimental::RNTupleWriteOptions fWriteOptions;
+};
+
+} // namespace Experimental
+} // namespace RDF
+
+namespace Internal {
+namespace RDF {
+
+/// Name of the RNTuple inside the persistent cache files
+constexpr const char *kPersistentCacheNTupleName = "rdfcache";
+
+/// Return the path of the cache file for the given computation graph, columns and options. Throws if the input dataset
+/// cannot be identified and no user key is given.
+std::string GetPersistentCachePath(const ROOT::RDF::RNode &node, const ColumnNames_t &columns,
+                                   const std::vector<std::string> &columnTypes,
+                                   const ROOT::RDF::Experimental::RPersistentCacheOptions &options);
+bool HasPersistentCache(const std::string &path);
+/// Return a path in the same directory as the cache file, unique to this process, to write the cache to
+std::string GetPersistentCacheTempPath(const std::string &path);
+/// Atomically move a completely written cache from the temporary path to its final path
+void CommitPersistentCache(const std::string &tempPath, const std::string &path);
+void RemovePersistentCacheTemp(const std::string &tempPath);
+ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager> OpenPersistentCache(const std::string &path);
+
+template <typename... ColumnTypes, std::size_t... S>
+ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>
+PersistentCacheImpl(ROOT::RDF::RNode node, const ColumnNames_t &columns,
+                    const ROOT::RDF::Experimental::RPersistentCacheOptions &options, std::index_sequence<S...>)
+{
+   CheckTypesAndPars(sizeof...(ColumnTypes), columns.size());
+   const std::vector<std::string> columnTypes{TypeID2TypeName(typeid(ColumnTypes))...};
+   const auto path = GetPersistentCachePath(node, columns, columnTypes, options);
+   if (HasPersistentCache(path))
+      return OpenPersistentCache(path);
+
+   auto model = ROOT::Experimental::RNTupleModel::Create();
+   int expander[] = {(model->MakeField<ColumnTypes>(columns[S]), 0)...};
+   (void)expander;
+
+   const auto tempPath = GetPersistentCacheTempPath(path);
+   try {
+      auto writer = ROOT::Experimental::RNTupleParallelWriter::Recreate(
+         std::move(model), kPersistentCacheNTupleName, tempPath, options.fWriteOptions);
+      // Every slot fills its own context; entries are streamed out cluster by cluster
+      const auto nSlots = node.GetNSlots();
+      std::vector<std::shared_ptr<ROOT::Experimental::RNTupleFillContext>> fillContexts(nSlots);
+      std::vector<std::unique_ptr<ROOT::Experimental::REntry>> entries(nSlots);
+      std::vector<std::tuple<ColumnTypes *...>> values(nSlots);
+      node.ForeachSlot(
+         [&](unsigned int slot, const ColumnTypes &...v) {
+            if (!fillContexts[slot]) {
+               fillContexts[slot] = writer->CreateFillContext();
+               entries[slot] = fillContexts[slot]->CreateEntry();
+               values[slot] = std::make_tuple(entries[slot]->Get<ColumnTypes>(columns[S])...);
+            }
+            int assign[] = {(*std::get<S>(values[slot]) = v, 0)...};
+            (void)assign;
+            fillContexts[slot]->Fill(*entries[slot]);
+         },
+         columns);
+      entries.clear();
+      fillContexts.clear();
+   } catch (...) {
+      RemovePersistentCacheTemp(tempPath);
+      throw;
+   }
+   CommitPersistentCache(tempPath, path);
+
+   return OpenPersistentCache(path);
+}
+
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+namespace Experimental {
+
+// clang-format off
+////////////////////////////////////////////////////////////////////////////
+/// \brief Save selected columns in a local RNTuple file that persists across processes.
+/// \tparam ColumnTypes variadic list of column types.
+/// \param[in] node The node whose entries are cached.
+/// \param[in] columns The columns to be cached.
+/// \param[in] options The cache directory, an optional user key and the write options of the cache file.
+/// \return a `RDataFrame` that reads the cached dataset.
+///
+/// Unlike RInterface::Cache(), the cached columns do not need to fit in memory: they are streamed into an RNTuple
+/// file in the cache directory, cluster by cluster, using one fill context per processing slot. The file name is
+/// derived from a hash of the computation graph leading to `node`, of the input dataset (including the size and
+/// modification time of local input files), of the cached columns and their types and of the user key.
+/// If a matching cache file exists already, e.g. from a previous run of the same analysis, it is used directly and
+/// the event loop of the upstream computation graph is not run at all.
+///
+/// The cache file is written to a temporary file first and renamed once complete, so that interrupted runs do not
+/// leave behind corrupt caches. Stale caches are not removed automatically.
+///
+/// \attention In multi-thread runs the clusters of the slots are appended to the cache file in the order in which
+/// they are completed, so the cached entries are not in the order of the input dataset, as for Snapshot. The cache
+/// key does not depend on the number of threads: a cache written by a multi-thread run is also used by
+/// single-thread runs. Cached columns that are used as friends of, or compared entry by entry with, the input dataset
+/// must be written by a single-thread run.
+///
+/// ~~~{.cpp}
+/// ROOT::RDF::Experimental::RPersistentCacheOptions options;
+/// options.fCacheDir = "/scratch/cache";
+/// options.fUserKey = "selection-v3";
+/// auto cached = ROOT::RDF::Experimental::PersistentCache<float, int>(df.Filter(expensiveCut), {"pt", "nJet"}, options);
+/// ~~~
+// clang-format on
+template <typename... ColumnTypes>
+RInterface<ROOT::Detail::RDF::RLoopManager>
+PersistentCache(RNode node, const ColumnNames_t &columns,
+                const RPersistentCacheOptions &options = RPersistentCacheOptions())
+{
+   return ROOT::Internal::RDF::PersistentCacheImpl<ColumnTypes...>(
+      std::move(node), columns, options, std::make_index_sequence<sizeof...(ColumnTypes)>());
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Save selected columns in a local RNTuple file that persists across processes.
+/// \param[in] node The node whose entries are cached.
+/// \param[in] columns The columns to be cached.
+/// \param[in] options The cache directory, an optional user key and the write options of the cache file.
+/// \return a `RDataFrame` that reads the cached dataset.
+///
+/// The column types are inferred; this invocation relies on jitting. See the previous overload for more information.
+RInterface<ROOT::Detail::RDF::RLoopManager>
+PersistentCache(RNode node, const ColumnNames_t &columns,
+                const RPersistentCacheOptions &options = RPersistentCacheOptions());
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif
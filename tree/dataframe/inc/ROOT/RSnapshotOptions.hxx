@@ -18,6 +18,14 @@
 namespace ROOT {
 
 namespace RDF {
+
+/// Data format of the output of a Snapshot
+enum class ESnapshotOutputFormat {
+   kDefault, ///< Currently TTree
+   kTTree,
+   kRNTuple ///< Requires ROOT to be built with root7=ON
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +45,7 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault; ///< Data format of the output dataset
 };
 } // ns RDF
 } // ns ROOT
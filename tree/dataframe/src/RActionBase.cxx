@@ -16,7 +16,7 @@ using namespace ROOT::Internal::RDF;
 
 RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RColumnRegister &colRegister,
                          const std::vector<std::string> &prevVariations)
-   : fLoopManager(lm), fNSlots(lm->GetNSlots()), fColumnNames(colNames),
+   : fLoopManager(lm), fProfile(lm->GetNSlots()), fNSlots(lm->GetNSlots()), fColumnNames(colNames),
      fVariations(Union(prevVariations, colRegister.GetVariationDeps(fColumnNames))), fColRegister(colRegister)
 {
 }
@@ -8,8 +8,23 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include "RConfigure.h" // R__HAS_ROOT7
 #include "ROOT/RDF/ActionHelpers.hxx"
 #include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDataSource.hxx"
+#include "TEnv.h"
+
+#ifdef R__HAS_ROOT7
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleDS.hxx" // FromRNTuple
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#endif
+
+#include <cmath> // std::abs
 
 namespace ROOT {
 namespace Internal {
@@ -235,6 +250,78 @@ template void StdDevHelper::Exec(unsigned int, const std::vector<char> &);
 template void StdDevHelper::Exec(unsigned int, const std::vector<int> &);
 template void StdDevHelper::Exec(unsigned int, const std::vector<unsigned int> &);
 
+bool UseSharedFill(const TH1 &h, unsigned int nSlots)
+{
+   if (nSlots < 2 || h.GetBufferSize() > 0)
+      return false;
+   const int dim = h.GetDimension();
+   if (h.GetXaxis()->CanExtend() || (dim > 1 && h.GetYaxis()->CanExtend()) || (dim > 2 && h.GetZaxis()->CanExtend()))
+      return false;
+
+   // memory taken by the copies of the histogram for the slots other than the first, in MB
+   const double perCopy = double(h.GetNcells()) * sizeof(double) * (h.GetSumw2N() > 0 ? 2 : 1);
+   const double copiesMB = perCopy * (nSlots - 1) / (1024. * 1024.);
+   return copiesMB > gEnv->GetValue("RDataFrame.SharedFillThreshold", 256.);
+}
+
+RSharedHistoFill::RSharedHistoFill(TH1 &h, unsigned int nSlots)
+   : fHist(&h),
+     fDim(h.GetDimension()),
+     fXaxis(h.GetXaxis()),
+     fYaxis(h.GetYaxis()),
+     fZaxis(h.GetZaxis()),
+     fNx(h.GetNbinsX()),
+     fNy(h.GetNbinsY()),
+     fNz(h.GetNbinsZ()),
+     fStatOverflows(h.GetStatOverflowsBehaviour()),
+     fNCells(h.GetNcells()),
+     fContents(new std::atomic<double>[fNCells]),
+     fSumw2(new std::atomic<double>[fNCells]),
+     fSlotStats(nSlots)
+{
+   // start from the current contents of the histogram, as filling it directly would
+   const bool hasSumw2 = h.GetSumw2N() > 0;
+   for (std::size_t i = 0; i < fNCells; ++i) {
+      const auto content = h.GetBinContent(i);
+      fContents[i].store(content, std::memory_order_relaxed);
+      fSumw2[i].store(hasSumw2 ? h.GetSumw2()->At(i) : std::abs(content), std::memory_order_relaxed);
+   }
+}
+
+void RSharedHistoFill::Finalize()
+{
+   std::array<double, TH1::kNstat> stats{};
+   fHist->GetStats(stats.data());
+   auto entries = fHist->GetEntries();
+   bool hasWeights = false;
+   for (const auto &slotStats : fSlotStats) {
+      for (std::size_t i = 0; i < stats.size(); ++i)
+         stats[i] += slotStats.fSums[i];
+      entries += slotStats.fNEntries;
+      hasWeights |= slotStats.fHasWeights;
+   }
+
+   // as in TH1::Fill, the sums of squares of the weights are stored only if needed
+   if (fHist->GetSumw2N() == 0 && hasWeights && !fHist->TestBit(TH1::kIsNotW))
+      fHist->Sumw2();
+   CopyContentsTo(*fHist);
+   fHist->PutStats(stats.data());
+   fHist->SetEntries(entries);
+}
+
+void RSharedHistoFill::CopyContentsTo(TH1 &h) const
+{
+   for (std::size_t i = 0; i < fNCells; ++i)
+      h.SetBinContent(i, fContents[i].load(std::memory_order_relaxed));
+   if (h.GetSumw2N() > 0) {
+      auto sumw2 = h.GetSumw2();
+      for (std::size_t i = 0; i < fNCells; ++i)
+         sumw2->SetAt(fSumw2[i].load(std::memory_order_relaxed), i);
+   }
+   // statistics are recomputed from the bin contents; Finalize() overrides them with the exact ones
+   h.ResetStats();
+}
+
 // External templates are disabled for gcc5 since this version wrongly omits the C++11 ABI attribute
 #if __GNUC__ > 5
 template class TakeHelper<bool, bool, std::vector<bool>>;
@@ -279,6 +366,148 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+#ifdef R__HAS_ROOT7
+
+class RNTupleSnapshotWriter {
+public:
+   /// The fill context of a slot and the entry that points to the values of the slot's column readers
+   struct RSlotContext {
+      std::shared_ptr<ROOT::Experimental::RNTupleFillContext> fFillContext;
+      std::unique_ptr<ROOT::Experimental::REntry> fEntry;
+      std::vector<void *> fAddresses;
+   };
+
+   std::string fFileName;
+   std::string fNTupleName;
+   ColumnNames_t fFieldNames;
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   std::vector<RSlotContext> fSlotContexts;
+};
+
+void ValidateRNTupleSnapshotOutput(const RSnapshotOptions &opts, const std::string &dirName)
+{
+   TString fileMode = opts.fMode;
+   fileMode.ToLower();
+   if (fileMode != "recreate")
+      throw std::invalid_argument("Snapshot: only the RECREATE mode is supported for RNTuple output");
+   if (!dirName.empty())
+      throw std::invalid_argument("Snapshot: RNTuple output cannot be written to a sub-directory");
+}
+
+std::shared_ptr<RNTupleSnapshotWriter>
+MakeRNTupleSnapshotWriter(const std::string &fileName, const std::string &ntupleName, const ColumnNames_t &fieldNames,
+                          const std::vector<std::string> &fieldTypes, const RSnapshotOptions &opts,
+                          unsigned int nSlots)
+{
+   auto model = ROOT::Experimental::RNTupleModel::Create();
+   for (std::size_t i = 0; i < fieldNames.size(); ++i) {
+      auto field = ROOT::Experimental::Detail::RFieldBase::Create(fieldNames[i], fieldTypes[i]);
+      if (!field)
+         throw std::runtime_error("Snapshot: cannot write column \"" + fieldNames[i] + "\" of type " + fieldTypes[i] +
+                                  " to RNTuple: " + field.GetError()->GetReport());
+      model->AddField(field.Unwrap());
+   }
+
+   ROOT::Experimental::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(ROOT::CompressionSettings(opts.fCompressionAlgorithm, opts.fCompressionLevel));
+
+   auto writer = std::make_shared<RNTupleSnapshotWriter>();
+   writer->fFileName = fileName;
+   writer->fNTupleName = ntupleName;
+   writer->fFieldNames = fieldNames;
+   writer->fWriter =
+      ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(model), ntupleName, fileName, writeOptions);
+   writer->fSlotContexts.resize(nSlots);
+   return writer;
+}
+
+void FillRNTupleSnapshot(RNTupleSnapshotWriter &writer, unsigned int slot, void *const *values)
+{
+   auto &context = writer.fSlotContexts[slot];
+   if (!context.fFillContext) {
+      context.fFillContext = writer.fWriter->CreateFillContext();
+      context.fEntry = context.fFillContext->GetModel()->CreateBareEntry();
+      context.fAddresses.resize(writer.fFieldNames.size(), nullptr);
+   }
+   // The addresses of the values change only when the column readers are recreated, e.g. at the start of a task
+   for (std::size_t i = 0; i < context.fAddresses.size(); ++i) {
+      if (context.fAddresses[i] != values[i]) {
+         context.fEntry->CaptureValueUnsafe(writer.fFieldNames[i], values[i]);
+         context.fAddresses[i] = values[i];
+      }
+   }
+   context.fFillContext->Fill(*context.fEntry);
+}
+
+void FinalizeRNTupleSnapshot(RNTupleSnapshotWriter &writer, ROOT::RDataFrame &outputDF)
+{
+   // All fill contexts must be destroyed before the writer, which then commits the dataset
+   writer.fSlotContexts.clear();
+   writer.fWriter.reset();
+   outputDF = ROOT::RDF::Experimental::FromRNTuple(writer.fNTupleName, writer.fFileName);
+}
+
+#else
+
+class RNTupleSnapshotWriter {
+};
+
+void ValidateRNTupleSnapshotOutput(const RSnapshotOptions &, const std::string &)
+{
+   throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7=ON");
+}
+
+std::shared_ptr<RNTupleSnapshotWriter> MakeRNTupleSnapshotWriter(const std::string &, const std::string &,
+                                                                 const ColumnNames_t &,
+                                                                 const std::vector<std::string> &,
+                                                                 const RSnapshotOptions &, unsigned int)
+{
+   throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7=ON");
+}
+
+void FillRNTupleSnapshot(RNTupleSnapshotWriter &, unsigned int, void *const *) {}
+
+void FinalizeRNTupleSnapshot(RNTupleSnapshotWriter &, ROOT::RDataFrame &) {}
+
+#endif // R__HAS_ROOT7
+
+namespace {
+/// The data source of the data frame returned by a Snapshot to RNTuple, until the RNTuple is written: every use throws.
+class RPendingRNTupleSnapshotDS final : public ROOT::RDF::RDataSource {
+   std::string fNTupleName;
+   std::string fFileName;
+
+   [[noreturn]] void ThrowNotWritten() const
+   {
+      throw std::runtime_error("Snapshot: the RNTuple \"" + fNTupleName + "\" in file \"" + fFileName +
+                               "\" has not been written yet, the data frame returned by Snapshot can only be used "
+                               "once the Snapshot action has run.");
+   }
+
+protected:
+   Record_t GetColumnReadersImpl(std::string_view, const std::type_info &) final { ThrowNotWritten(); }
+
+public:
+   RPendingRNTupleSnapshotDS(const std::string &ntupleName, const std::string &fileName)
+      : fNTupleName(ntupleName), fFileName(fileName)
+   {
+   }
+   void SetNSlots(unsigned int) final {}
+   const std::vector<std::string> &GetColumnNames() const final { ThrowNotWritten(); }
+   bool HasColumn(std::string_view) const final { ThrowNotWritten(); }
+   std::string GetTypeName(std::string_view) const final { ThrowNotWritten(); }
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final { ThrowNotWritten(); }
+   bool SetEntry(unsigned int, ULong64_t) final { ThrowNotWritten(); }
+   void Initialize() final { ThrowNotWritten(); }
+   std::string GetLabel() final { return "RNTupleSnapshot"; }
+};
+} // anonymous namespace
+
+std::shared_ptr<ROOT::RDataFrame> MakeRNTupleSnapshotOutputDF(const std::string &ntupleName, const std::string &fileName)
+{
+   return std::make_shared<ROOT::RDataFrame>(std::make_unique<RPendingRNTupleSnapshotDS>(ntupleName, fileName));
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
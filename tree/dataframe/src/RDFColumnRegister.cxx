@@ -28,18 +28,21 @@ RDefinesWithReaders::RDefinesWithReaders(std::shared_ptr<RDefineBase> define, un
    assert(fDefine != nullptr);
 }
 
-RDefineReader &RDefinesWithReaders::GetReader(unsigned int slot, const std::string &variationName)
+RDefineReader &RDefinesWithReaders::GetReader(unsigned int slot, TTreeReader *r, const std::string &variationName)
 {
+   auto *define = fDefine.get();
+   if (variationName != "nominal")
+      define = &define->GetVariedDefine(variationName);
+   // defines are not initialized by RLoopManager::InitNodeSlots: a define that nobody reads in this event loop does
+   // not create readers for its input columns
+   define->InitSlotOnDemand(r, slot);
+
    auto &defineReaders = fReadersPerVariation[slot];
 
    auto it = defineReaders.find(variationName);
    if (it != defineReaders.end())
       return *it->second;
 
-   auto *define = fDefine.get();
-   if (variationName != "nominal")
-      define = &define->GetVariedDefine(variationName);
-
 #if !defined(__clang__) && __GNUC__ >= 7 && __GNUC_MINOR__ >= 3
    const auto insertion = defineReaders.insert({variationName, std::make_unique<RDefineReader>(slot, *define)});
    return *insertion.first->second;
@@ -292,8 +295,8 @@ std::string RColumnRegister::ResolveAlias(std::string_view alias) const
 
 /// Return a RDefineReader or a RVariationReader, or nullptr if not available.
 /// If requestedType does not match the actual type of the Define or Variation, an exception is thrown.
-RDFDetail::RColumnReaderBase *RColumnRegister::GetReader(unsigned int slot, const std::string &colName,
-                                                         const std::string &variationName,
+RDFDetail::RColumnReaderBase *RColumnRegister::GetReader(unsigned int slot, TTreeReader *r,
+                                                         const std::string &colName, const std::string &variationName,
                                                          const std::type_info &requestedType)
 {
    // try variations first
@@ -311,7 +314,7 @@ RDFDetail::RColumnReaderBase *RColumnRegister::GetReader(unsigned int slot, cons
    if (it != fDefines->end()) {
       const auto &actualType = it->second->GetDefine().GetTypeId();
       CheckReaderTypeMatches(actualType, requestedType, colName);
-      return &it->second->GetReader(slot, variationName);
+      return &it->second->GetReader(slot, r, variationName);
    }
 
    return nullptr;
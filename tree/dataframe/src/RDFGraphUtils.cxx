@@ -10,13 +10,25 @@
 
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/GraphUtils.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 
 #include <algorithm> // std::find
+#include <cstdio>    // std::snprintf
 
 namespace ROOT {
 namespace Internal {
 namespace RDF {
 
+std::string GraphDrawing::FormatProfile(const RNodeProfile &profile)
+{
+   const auto nCalls = profile.GetNCalls();
+   if (nCalls == 0)
+      return "";
+   char buf[64];
+   std::snprintf(buf, sizeof(buf), "\\n%.3g s, %llu calls", profile.GetTime(), nCalls);
+   return buf;
+}
+
 std::shared_ptr<GraphDrawing::GraphNode>
 GraphDrawing::CreateDefineNode(const std::string &columnName, const ROOT::Detail::RDF::RDefineBase *columnPtr,
                                std::unordered_map<void *, std::shared_ptr<GraphNode>> &visitedMap)
@@ -28,6 +40,8 @@ GraphDrawing::CreateDefineNode(const std::string &columnName, const ROOT::Detail
       return duplicateDefineIt->second;
 
    auto node = std::make_shared<GraphNode>("Define\\n" + columnName, visitedMap.size(), ENodeType::kDefine);
+   if (columnPtr)
+      node->SetProfile(FormatProfile(columnPtr->GetProfile()));
    visitedMap[(void *)columnPtr] = node;
    return node;
 }
@@ -45,6 +59,7 @@ GraphDrawing::CreateFilterNode(const ROOT::Detail::RDF::RFilterBase *filterPtr,
 
    auto node = std::make_shared<GraphNode>((filterPtr->HasName() ? filterPtr->GetName() : "Filter"), visitedMap.size(),
                                            ENodeType::kFilter);
+   node->SetProfile(FormatProfile(filterPtr->GetProfile()));
    visitedMap[(void *)filterPtr] = node;
    return node;
 }
@@ -103,7 +118,7 @@ std::string GraphCreatorHelper::FromGraphLeafToDot(const GraphNode &start) const
    // Explore the graph bottom-up and store its dot representation.
    const GraphNode *leaf = &start;
    while (leaf) {
-      dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << leaf->GetName()
+      dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << GetLabel(*leaf)
                       << "\", style=\"filled\", fillcolor=\"" << leaf->GetColor() << "\", shape=\"" << leaf->GetShape()
                       << "\"];\n";
       if (leaf->GetPrevNode()) {
@@ -125,7 +140,7 @@ std::string GraphCreatorHelper::FromGraphActionsToDot(std::vector<std::shared_pt
    for (auto leafShPtr : leaves) {
       GraphNode *leaf = leafShPtr.get();
       while (leaf && !leaf->IsExplored()) {
-         dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << leaf->GetName()
+         dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << GetLabel(*leaf)
                          << "\", style=\"filled\", fillcolor=\"" << leaf->GetColor() << "\", shape=\""
                          << leaf->GetShape() << "\"];\n";
          if (leaf->GetPrevNode()) {
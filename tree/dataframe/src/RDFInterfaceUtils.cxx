@@ -24,12 +24,15 @@
 #include <TClass.h>
 #include <TClassEdit.h>
 #include <TDataType.h>
+#include <TEnv.h>
 #include <TError.h>
 #include <TLeaf.h>
+#include <TMD5.h>
 #include <TObjArray.h>
 #include <TPRegexp.h>
 #include <TROOT.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 #include <TVirtualMutex.h>
 
@@ -48,6 +51,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>  // for size_t
+#include <fstream>
 #include <iterator> // for back_insert_iterator
 #include <map>
 #include <memory>
@@ -299,8 +303,116 @@ BuildFunctionString(const std::string &expr, const ColumnNames_t &vars, const Co
    return ss.str();
 }
 
-/// Declare a function to the interpreter in namespace R_rdf, return the name of the jitted function.
+/// The functions returned by DeclareFunction that have not been passed to the interpreter yet: their full names and
+/// their code.
+static std::vector<std::pair<std::string, std::string>> &GetFunctionsToDeclare()
+{
+   static std::vector<std::pair<std::string, std::string>> functions;
+   return functions;
+}
+
+/// Keys are the names of the jitted functions, values are their return types as returned by RetTypeOfFunc.
+static std::unordered_map<std::string, std::string> &GetJittedRetTypes()
+{
+   static std::unordered_map<std::string, std::string> retTypes;
+   return retTypes;
+}
+
+/// An entry of the on-disk cache of the return types of jitted functions.
+struct RRetTypeCacheEntry {
+   std::string fFile; ///< The file that stores the return type
+   std::string fKey;  ///< The ROOT version and the code of the function, also stored in the file
+};
+
+/// Keys are the names of the jitted functions, values are their entries in the on-disk cache of return types.
+static std::unordered_map<std::string, RRetTypeCacheEntry> &GetRetTypeCacheEntries()
+{
+   static std::unordered_map<std::string, RRetTypeCacheEntry> cacheEntries;
+   return cacheEntries;
+}
+
+/// Names of the jitted functions whose return type has been read from the on-disk cache before the function was
+/// declared. The types are verified by DeclarePendingFunctions.
+static std::vector<std::string> &GetUnverifiedRetTypes()
+{
+   static std::vector<std::string> unverified;
+   return unverified;
+}
+
+/// The directory of the on-disk cache of the return types of jitted functions, empty if the cache is disabled.
+static std::string GetRetTypeCacheDir()
+{
+   return gEnv->GetValue("RDataFrame.JitTypeCacheDir", "");
+}
+
+/// The key of the cache entry of the function with the given code.
+/// Cached types are specific to the ROOT version as they can depend on ROOT's own headers.
+static std::string GetRetTypeCacheKey(const std::string &funcCode)
+{
+   return std::string(gROOT->GetVersion()) + "\n" + funcCode;
+}
+
+/// The file in the on-disk cache that stores the return type of the function with the given code.
+static std::string GetRetTypeCacheFileForKey(const std::string &key)
+{
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   return GetRetTypeCacheDir() + "/" + md5.AsString() + ".rettype";
+}
+
+/// Return the type stored in the cache entry, or an empty string if there is no valid entry.
+/// An entry is the type on the first line followed by the full key, which guards against hash collisions and
+/// against files that have been truncated or corrupted: such entries are removed, so that they are written again.
+static std::string ReadCachedRetType(const std::string &cacheFile, const std::string &key)
+{
+   std::ifstream f(cacheFile);
+   if (!f)
+      return "";
+   const std::string content{std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>()};
+   const auto endOfType = content.find('\n');
+   if (endOfType == 0 || endOfType == std::string::npos || content.compare(endOfType + 1, std::string::npos, key) != 0) {
+      gSystem->Unlink(cacheFile.c_str());
+      return "";
+   }
+   return content.substr(0, endOfType);
+}
+
+static void WriteCachedRetType(const std::string &cacheFile, const std::string &key, const std::string &type)
+{
+   // Write to a process-specific file and rename it so that concurrent jobs never see partially written entries
+   gSystem->mkdir(GetRetTypeCacheDir().c_str(), kTRUE);
+   const auto tmpFile = cacheFile + ".tmp" + std::to_string(gSystem->GetPid());
+   {
+      std::ofstream f(tmpFile);
+      f << type << '\n' << key;
+      if (!f)
+         return;
+   }
+   if (gSystem->Rename(tmpFile.c_str(), cacheFile.c_str()) != 0)
+      gSystem->Unlink(tmpFile.c_str());
+}
+
+/// Remove a function that failed to compile from the maps of jitted functions, so that its expression is declared
+/// again, under a new name, if it is booked again.
+static void ForgetFunction(const std::string &funcName)
+{
+   auto &exprMap = GetJittedExprs();
+   for (auto it = exprMap.begin(); it != exprMap.end(); ++it) {
+      if (it->second == funcName) {
+         exprMap.erase(it);
+         break;
+      }
+   }
+   GetJittedRetTypes().erase(funcName);
+   GetRetTypeCacheEntries().erase(funcName);
+}
+
+/// Book the declaration of a function in namespace R_rdf, return the name of the jitted function.
 /// If the function is already in GetJittedExprs, return the name for the function that has already been jitted.
+/// The declaration is deferred until DeclarePendingFunctions() is called, either because the return type of a function
+/// is needed (see RetTypeOfFunc) or right before the jitted code of the computation graph is executed. In this way,
+/// functions whose return types are known from the on-disk cache are all declared to the interpreter in one go.
 static std::string DeclareFunction(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
 {
    R__LOCKGUARD(gROOTMutex);
@@ -315,27 +427,59 @@ static std::string DeclareFunction(const std::string &expr, const ColumnNames_t
    }
 
    // new expression
-   const auto funcBaseName = "func" + std::to_string(exprMap.size());
+   // not exprMap.size(): the functions that fail to compile are removed from exprMap, their names are not reused
+   static unsigned int nFunctions = 0;
+   const auto funcBaseName = "func" + std::to_string(nFunctions++);
    const auto funcFullName = "R_rdf::" + funcBaseName;
 
-   const auto toDeclare = "namespace R_rdf {\nauto " + funcBaseName + funcCode + "\nusing " + funcBaseName +
-                          "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" + funcBaseName +
-                          ")>::ret_type;\n}";
-   ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
-
-   // InterpreterDeclare could throw. If it doesn't, mark the function as already jitted
+   GetFunctionsToDeclare().emplace_back(funcFullName, "namespace R_rdf {\nauto " + funcBaseName + funcCode +
+                                                         "\nusing " + funcBaseName +
+                                                         "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" +
+                                                         funcBaseName + ")>::ret_type;\n}\n");
    exprMap.insert({funcCode, funcFullName});
+   if (!GetRetTypeCacheDir().empty()) {
+      auto key = GetRetTypeCacheKey(funcCode);
+      auto file = GetRetTypeCacheFileForKey(key);
+      GetRetTypeCacheEntries()[funcFullName] = RRetTypeCacheEntry{std::move(file), std::move(key)};
+   }
 
    return funcFullName;
 }
 
 /// Each jitted function comes with a func_ret_t type alias for its return type.
-/// Resolve that alias and return the true type as string.
+/// Resolve that alias and return the true type as string. If the on-disk cache of return types is enabled
+/// (RDataFrame.JitTypeCacheDir in .rootrc), the type is looked up there first, in which case the function does not
+/// need to be declared yet. Only the types are cached: the functions are still compiled by the interpreter.
 static std::string RetTypeOfFunc(const std::string &funcName)
 {
-   const auto dt = gROOT->GetType((funcName + "_ret_t").c_str());
-   R__ASSERT(dt != nullptr);
-   const auto type = dt->GetFullTypeName();
+   R__LOCKGUARD(gROOTMutex);
+
+   auto &retTypes = GetJittedRetTypes();
+   const auto retTypeIt = retTypes.find(funcName);
+   if (retTypeIt != retTypes.end())
+      return retTypeIt->second;
+
+   const auto cacheIt = GetRetTypeCacheEntries().find(funcName);
+   const auto *cacheEntry = cacheIt != GetRetTypeCacheEntries().end() ? &cacheIt->second : nullptr;
+   auto type = cacheEntry ? ReadCachedRetType(cacheEntry->fFile, cacheEntry->fKey) : std::string();
+   if (!type.empty()) {
+      GetUnverifiedRetTypes().emplace_back(funcName);
+   } else {
+      ROOT::Internal::RDF::DeclarePendingFunctions();
+      const auto dt = gROOT->GetType((funcName + "_ret_t").c_str());
+      if (!dt) {
+         // the function failed to compile and has been forgotten by DeclarePendingFunctions
+         throw std::runtime_error(
+            "\nRDataFrame: An error occurred during just-in-time compilation. The lines above might indicate the cause "
+            "of the crash\n All RDF objects that have not run an event loop yet should be considered in an invalid "
+            "state.\n");
+      }
+      type = dt->GetFullTypeName();
+      if (cacheEntry)
+         WriteCachedRetType(cacheEntry->fFile, cacheEntry->fKey, type);
+   }
+
+   retTypes[funcName] = type;
    return type;
 }
 
@@ -630,6 +774,67 @@ ParsedTreePath ParseTreePath(std::string_view fullTreeName)
    return {std::string(treeName), std::string(dirName)};
 }
 
+void DeclarePendingFunctions()
+{
+   R__LOCKGUARD(gROOTMutex);
+
+   const auto functions = std::move(GetFunctionsToDeclare());
+   GetFunctionsToDeclare().clear();
+   if (functions.empty())
+      return;
+
+   std::string code;
+   for (const auto &function : functions)
+      code += function.second;
+   try {
+      InterpreterDeclare(code);
+   } catch (const std::runtime_error &) {
+      // The pending functions can belong to any computation graph. Declare them one by one, so that an invalid
+      // expression does not take down the valid ones: the functions that fail are forgotten, and only the graphs
+      // that use them throw, when they need them (see RetTypeOfFunc and RLoopManager::Jit).
+      for (const auto &function : functions) {
+         try {
+            InterpreterDeclare(function.second);
+         } catch (const std::runtime_error &) {
+            ForgetFunction(function.first);
+         }
+      }
+   }
+
+   // Types taken from the on-disk cache could be stale, e.g. if the expression calls a user function whose signature
+   // changed since the cache entry was written
+   for (const auto &funcName : GetUnverifiedRetTypes()) {
+      const auto dt = gROOT->GetType((funcName + "_ret_t").c_str());
+      if (!dt)
+         continue; // failed to compile, see above
+      const std::string type = dt->GetFullTypeName();
+      auto &retType = GetJittedRetTypes()[funcName];
+      if (type != retType) {
+         const auto &cacheFile = GetRetTypeCacheEntries()[funcName].fFile;
+         gSystem->Unlink(cacheFile.c_str());
+         GetUnverifiedRetTypes().clear();
+         // expressions booked from now on get the right type
+         retType = type;
+         throw std::runtime_error("RDataFrame: the return type of a jitted expression, " + type +
+                                  ", does not match the one stored in the cache of return types " + cacheFile +
+                                  ". The stale cache entry has been removed, please book the computation graph again.");
+      }
+   }
+   GetUnverifiedRetTypes().clear();
+}
+
+std::string GetJitTypeCacheFile(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
+{
+   return GetRetTypeCacheFileForKey(GetRetTypeCacheKey(BuildFunctionString(expr, vars, varTypes)));
+}
+
+void WriteJitTypeCacheEntry(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes,
+                            const std::string &type)
+{
+   const auto key = GetRetTypeCacheKey(BuildFunctionString(expr, vars, varTypes));
+   WriteCachedRetType(GetRetTypeCacheFileForKey(key), key, type);
+}
+
 std::string PrettyPrintAddr(const void *const addr)
 {
    std::stringstream s;
@@ -0,0 +1,137 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDFMultiProcess.hxx>
+#include <ROOT/RDF/Utils.hxx> // TypeID2TypeName
+#include <ROOT/TProcessExecutor.hxx>
+#include <TBufferFile.h>
+#include <TChain.h>
+#include <TClass.h>
+#include <TROOT.h> // IsImplicitMTEnabled
+
+#include <algorithm>
+#include <numeric> // std::iota
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using ROOT::Detail::RDF::RMergeableValueBase;
+using ROOT::RDF::Experimental::RDatasetSpec;
+using ROOT::RDF::Experimental::RMultiProcessOptions;
+
+namespace {
+/// Split the entries of the dataset, or of its global range if any, in nTasks contiguous ranges of similar size.
+std::vector<std::pair<Long64_t, Long64_t>> GetTaskRanges(const RDatasetSpec &spec, unsigned int nTasks)
+{
+   // as in RLoopManager, files are added as `<filename>?#<treename>`
+   TChain chain("");
+   const auto treeNames = spec.GetTreeNames();
+   const auto fileNames = spec.GetFileNameGlobs();
+   for (std::size_t i = 0; i < fileNames.size(); ++i)
+      chain.Add((fileNames[i] + "?#" + treeNames[i]).c_str());
+
+   const Long64_t nEntries = chain.GetEntries();
+   const auto begin = std::min(spec.GetEntryRangeBegin(), nEntries);
+   const auto end = std::min(spec.GetEntryRangeEnd(), nEntries);
+   const auto nRangeEntries = std::max(end - begin, Long64_t(0));
+   nTasks = std::max(1u, static_cast<unsigned int>(std::min<Long64_t>(nTasks, nRangeEntries)));
+
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   ranges.reserve(nTasks);
+   const auto nEntriesPerTask = nRangeEntries / nTasks;
+   auto remainder = nRangeEntries % nTasks;
+   Long64_t start = begin;
+   for (unsigned int i = 0; i < nTasks; ++i) {
+      auto stop = start + nEntriesPerTask;
+      if (remainder > 0) {
+         ++stop;
+         --remainder;
+      }
+      ranges.emplace_back(start, stop);
+      start = stop;
+   }
+   return ranges;
+}
+} // anonymous namespace
+
+std::vector<ROOT::Internal::RDF::MultiProcessTaskResult_t>
+ROOT::Internal::RDF::RunMultiProcessTasks(const RDatasetSpec &spec, const RMultiProcessOptions &options,
+                                          const MultiProcessTask_t &task)
+{
+   if (ROOT::IsImplicitMTEnabled()) {
+      throw std::runtime_error("RunMultiProcess: implicit multi-threading must be disabled, as the worker processes "
+                               "are forked from the current one.");
+   }
+
+   ROOT::TProcessExecutor pool(options.fNWorkers);
+   const auto nTasks = options.fNTasks > 0 ? options.fNTasks : pool.GetPoolSize();
+   const auto ranges = GetTaskRanges(spec, nTasks);
+
+   // executed in the worker processes
+   auto runTask = [&](unsigned int taskId) {
+      MultiProcessTaskResult_t result{""};
+      try {
+         auto taskSpec = spec;
+         taskSpec.WithGlobalRange({ranges[taskId].first, ranges[taskId].second});
+         ROOT::RDataFrame df(std::move(taskSpec));
+         ROOT::RDF::RNode node(df);
+         task(node, result);
+      } catch (const std::exception &e) {
+         result = {std::string("RunMultiProcess: the processing of entries [") +
+                   std::to_string(ranges[taskId].first) + ", " + std::to_string(ranges[taskId].second) +
+                   ") failed: " + e.what()};
+      }
+      return result;
+   };
+
+   std::vector<unsigned int> taskIds(ranges.size());
+   std::iota(taskIds.begin(), taskIds.end(), 0u);
+   auto results = pool.Map(runTask, taskIds);
+
+   if (results.size() != ranges.size()) {
+      throw std::runtime_error("RunMultiProcess: " + std::to_string(ranges.size() - results.size()) + " out of " +
+                               std::to_string(ranges.size()) + " tasks did not complete, worker processes were lost.");
+   }
+   for (const auto &r : results) {
+      if (r.empty())
+         throw std::runtime_error("RunMultiProcess: a worker process returned no results.");
+      if (!r[0].empty())
+         throw std::runtime_error(r[0]);
+   }
+   return results;
+}
+
+void ROOT::Internal::RDF::SerializeMergeable(const RMergeableValueBase &value, MultiProcessTaskResult_t &result)
+{
+   // only the RMergeable* classes selected in LinkDef.h can be sent back, an interpreted class would not be usable
+   // in the parent process
+   TClass *cl = TClass::GetClass(typeid(value));
+   if (!cl || !cl->HasDictionary()) {
+      throw std::runtime_error("RunMultiProcess: results of type " + TypeID2TypeName(typeid(value)) +
+                               " are not supported, as they have no dictionary.");
+   }
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteObjectAny(dynamic_cast<const void *>(&value), cl);
+   result.emplace_back(cl->GetName());
+   result.emplace_back(buf.Buffer(), buf.Length());
+}
+
+std::unique_ptr<RMergeableValueBase>
+ROOT::Internal::RDF::DeserializeMergeable(const std::string &className, const std::string &buffer)
+{
+   TClass *cl = TClass::GetClass(className.c_str());
+   if (!cl || !cl->HasDictionary())
+      throw std::runtime_error("RunMultiProcess: cannot find a dictionary for results of type " + className + ".");
+   TBufferFile buf(TBuffer::kRead, buffer.size(), const_cast<char *>(buffer.data()), /*adopt=*/false);
+   void *obj = buf.ReadObjectAny(cl);
+   auto value = static_cast<RMergeableValueBase *>(cl->DynamicCast(TClass::GetClass<RMergeableValueBase>(), obj));
+   if (!value)
+      throw std::runtime_error("RunMultiProcess: cannot read back results of type " + className + ".");
+   return std::unique_ptr<RMergeableValueBase>(value);
+}
@@ -814,6 +814,25 @@ Without this, two partial histograms resulting from two distributed tasks would
 to errors when merging them. Failing to pass a histogram model will raise an error on the client side, before starting
 the distributed execution.
 
+### Multi-process execution in C++
+
+On a single machine, the same split-run-merge scheme is available in C++ via
+ROOT::RDF::Experimental::RunMultiProcess(). The dataset described by an RDatasetSpec is divided in entry ranges that are
+processed by worker processes forked from the current one. Each worker books the results of the computation graph with
+a user-provided function and sends them back for merging:
+
+~~~{.cpp}
+ROOT::RDF::Experimental::RDatasetSpec spec;
+spec.AddGroup({"data", "events", "data_*.root"});
+auto results = ROOT::RDF::Experimental::RunMultiProcess(spec, [](ROOT::RDF::RNode df) {
+   return std::make_tuple(df.Filter("nMuon == 2").Histo1D({"pt", "pt", 100, 0., 100.}, "Muon_pt"));
+});
+const TH1D &pt = std::get<0>(results)->GetValue();
+~~~
+
+The workers do not share the interpreter, so just-in-time compilation does not contend for locks, and the failure of
+one worker is reported as an exception rather than terminating the whole application.
+
 
 \anchor parallel-execution
 ## Performance tips and parallel execution
@@ -890,7 +909,7 @@ Also make sure not to count the just-in-time compilation time (which happens onc
 
 ### Memory usage
 
-There are two reasons why RDataFrame may consume more memory than expected. Firstly, each result is duplicated for each worker thread, which e.g. in case of many (possibly multi-dimensional) histograms with fine binning can result in visible memory consumption during the event loop. The thread-local copies of the results are destroyed when the final result is produced. Reducing the number of threads or using coarser binning will reduce the memory usage.
+There are two reasons why RDataFrame may consume more memory than expected. Firstly, each result is duplicated for each worker thread, which e.g. in case of many (possibly multi-dimensional) histograms with fine binning can result in visible memory consumption during the event loop. The thread-local copies of the results are destroyed when the final result is produced. Reducing the number of threads or using coarser binning will reduce the memory usage. TH1D, TH2D and TH3D histograms with fixed axes are an exception: when the thread-local copies would take more than 256 MB (configurable via the `RDataFrame.SharedFillThreshold` option in `.rootrc`, in MB), all threads fill the same histogram, updating its bins with atomic operations.
 
 Secondly, just-in-time compilation of string expressions or non-templated actions (see the previous paragraph) causes Cling, ROOT's C++ interpreter, to allocate some memory for the generated code that is only released at the end of the application. This commonly results in memory usage creep in long-running applications that create many RDataFrames one after the other. Possible mitigations include creating and running each RDataFrame event loop in a sub-process, or booking all operations for all different RDataFrame computation graphs before the first event loop is triggered, so that the interpreter is invoked only once for all computation graphs:
 
@@ -1317,6 +1336,23 @@ $ dot -Tpng computation_graph.dot -ocomputation_graph.png
 
 \image html RDF_Graph2.png
 
+\anchor rdf-profiling
+### Profiling the computation graph
+To find out which parts of a computation graph are expensive, profiling can be enabled before running the event loop
+with ROOT::RDF::Experimental::EnableProfiling(). Every Filter, Define and action then records the wall time spent in
+its own evaluations and the number of evaluations, and the entries read from each column of the dataset are counted.
+The profile is returned by ROOT::RDF::Experimental::GetProfileReport(), which can be printed or exported as JSON,
+is shown in the output of Describe(), and annotates the nodes of the graph produced by SaveGraph():
+~~~{.cpp}
+ROOT::RDataFrame df("tree", "f.root");
+ROOT::RDF::Experimental::EnableProfiling(df);
+auto h = df.Define("pt", "sqrt(px*px + py*py)").Filter("pt > 10", "ptCut").Histo1D("pt");
+h->Draw();
+ROOT::RDF::Experimental::GetProfileReport(df).Print();
+std::ofstream("profile.json") << ROOT::RDF::Experimental::GetProfileReport(df).AsJSON();
+ROOT::RDF::SaveGraph(df, "profiled_graph.dot");
+~~~
+
 \anchor rdf-logging
 ### Activating RDataFrame execution logs
 
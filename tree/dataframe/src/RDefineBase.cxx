@@ -26,7 +26,8 @@ RDefineBase::RDefineBase(std::string_view name, std::string_view type, const RDF
                          const std::string &variationName)
    : fName(name), fType(type), fLastCheckedEntry(lm.GetNSlots() * RDFInternal::CacheLineStep<Long64_t>(), -1),
      fColRegister(colRegister), fLoopManager(&lm), fColumnNames(columnNames), fIsDefine(columnNames.size()),
-     fVariationDeps(fColRegister.GetVariationDeps(fColumnNames)), fVariation(variationName)
+     fVariationDeps(fColRegister.GetVariationDeps(fColumnNames)), fVariation(variationName),
+     fProfile(lm.GetNSlots()), fInitTaskIds(lm.GetNSlots() * RDFInternal::CacheLineStep<ULong64_t>())
 {
    const auto nColumns = fColumnNames.size();
    for (auto i = 0u; i < nColumns; ++i) {
@@ -48,3 +49,14 @@ std::string RDefineBase::GetTypeName() const
 {
    return fType;
 }
+
+void RDefineBase::InitSlotOnDemand(TTreeReader *r, unsigned int slot)
+{
+   // task ids start from 1, so a zero-initialized fInitTaskIds means "never initialized"
+   auto &initTaskId = fInitTaskIds[slot * RDFInternal::CacheLineStep<ULong64_t>()];
+   const auto taskId = fLoopManager->GetSlotTaskId(slot);
+   if (initTaskId == taskId)
+      return;
+   initTaskId = taskId;
+   InitSlot(r, slot);
+}
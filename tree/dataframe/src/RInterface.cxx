@@ -9,6 +9,12 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RInterface.hxx"
+#include "ROOT/InternalTreeUtils.hxx" // GetFileNamesFromTree
+#include "TChain.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include <string>
 
 void ROOT::Internal::RDF::ChangeEmptyEntryRange(const ROOT::RDF::RNode &node,
                                                 std::pair<ULong64_t, ULong64_t> &&newRange)
@@ -16,3 +22,36 @@ void ROOT::Internal::RDF::ChangeEmptyEntryRange(const ROOT::RDF::RNode &node,
    R__ASSERT(newRange.second >= newRange.first && "end is less than begin in the passed entry range!");
    node.GetLoopManager()->SetEmptyEntryRange(std::move(newRange));
 }
+
+void ROOT::RDF::Experimental::EnableProfiling(const ROOT::RDF::RNode &node, bool enable)
+{
+   node.GetLoopManager()->EnableProfiling(enable);
+}
+
+ROOT::RDF::Experimental::RProfileReport ROOT::RDF::Experimental::GetProfileReport(const ROOT::RDF::RNode &node)
+{
+   return node.GetLoopManager()->GetProfileReport();
+}
+
+/// Return a string that identifies the input dataset of the computation graph, including the size and modification
+/// time of local input files. Returns an empty string if the dataset cannot be identified across processes, e.g. for
+/// in-memory trees and for data sources.
+std::string ROOT::Internal::RDF::GetDatasetFingerprint(const ROOT::RDF::RNode &node)
+{
+   if (node.fDataSource)
+      return "";
+
+   auto fingerprint = node.DescribeDataset();
+   auto *tree = node.GetLoopManager()->GetTree();
+   if (tree) {
+      if (!dynamic_cast<TChain *>(tree) && !tree->GetCurrentFile())
+         return "";
+      for (const auto &fileName : ROOT::Internal::TreeUtils::GetFileNamesFromTree(*tree)) {
+         Long_t id, flags, modtime;
+         Long64_t size;
+         if (gSystem->GetPathInfo(fileName.c_str(), &id, &size, &flags, &modtime) == 0)
+            fingerprint += "\n" + fileName + " " + std::to_string(size) + " " + std::to_string(modtime);
+      }
+   }
+   return fingerprint;
+}
@@ -266,6 +266,25 @@ ROOT::RDF::RDFDescription ROOT::RDF::RInterfaceBase::Describe()
       if (i < nCols - 1)
          ss << '\n';
    }
+
+   // Build the profile table, if profiling was enabled, see ROOT::RDF::Experimental::EnableProfiling
+   const auto profile = fLoopManager->GetProfileReport();
+   if (!profile.GetNodes().empty()) {
+      std::vector<std::string> nodeNames{"Node"};
+      for (const auto &n : profile.GetNodes())
+         nodeNames.emplace_back(n.fKind + ' ' + n.fName);
+      const auto columnWidthNodes = RDFInternal::GetColumnWidth(nodeNames);
+      ss << "\n\n"
+         << std::left << std::setw(columnWidthNodes) << "Node" << std::setw(14) << "Time [s]"
+         << "Calls\n"
+         << std::setw(columnWidthNodes) << "----" << std::setw(14) << "--------"
+         << "-----";
+      for (auto i = 0u; i < profile.GetNodes().size(); i++) {
+         const auto &n = profile.GetNodes()[i];
+         ss << '\n'
+            << std::left << std::setw(columnWidthNodes) << nodeNames[i + 1] << std::setw(14) << n.fTime << n.fNCalls;
+      }
+   }
    // Use the string returned from DescribeDataset() as the 'brief' description
    // Use the converted to string stringstream ss as the 'full' description
    return RDFDescription(DescribeDataset(), ss.str());
@@ -68,3 +68,8 @@ RDefineBase &RJittedDefine::GetVariedDefine(const std::string &variationName)
    assert(fConcreteDefine != nullptr);
    return fConcreteDefine->GetVariedDefine(variationName);
 }
+
+const RDFInternal::RNodeProfile &RJittedDefine::GetProfile() const
+{
+   return fConcreteDefine ? fConcreteDefine->GetProfile() : fProfile;
+}
@@ -9,6 +9,7 @@
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RDataSource.hxx"
 #include "ROOT/RDF/GraphNode.hxx"
+#include "ROOT/RDF/InterfaceUtils.hxx" // DeclarePendingFunctions
 #include "ROOT/InternalTreeUtils.hxx" // GetTreeFullPaths
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
@@ -19,6 +20,7 @@
 #include "ROOT/RLogger.hxx"
 #include "RtypesCore.h" // Long64_t
 #include "TStopwatch.h"
+#include "TBranch.h"
 #include "TBranchElement.h"
 #include "TBranchObject.h"
 #include "TChain.h"
@@ -307,6 +309,27 @@ static auto MakeDatasetColReadersKey(const std::string &colName, const std::type
    //    df.Sum<RVecI>("stdVectorBranch");
    return colName + ':' + ti.name();
 }
+
+/// Return the average uncompressed size of the entries of the branch read for the column, zero if unknown.
+double GetAverageEntrySize(TTree *tree, const std::string &colName)
+{
+   if (tree == nullptr)
+      return 0.;
+   auto *branch = tree->GetBranch(colName.c_str());
+   if (branch == nullptr)
+      branch = tree->FindBranch(colName.c_str());
+   if (branch == nullptr || branch->GetEntries() == 0)
+      return 0.;
+   return static_cast<double>(branch->GetTotBytes("*")) / branch->GetEntries();
+}
+
+/// Action names are formatted for the computation graph drawing, with escaped line breaks
+std::string RemoveEscapedNewlines(std::string name)
+{
+   for (auto pos = name.find("\\n"); pos != std::string::npos; pos = name.find("\\n", pos))
+      name.replace(pos, 2, " ");
+   return name;
+}
 } // anonymous namespace
 
 namespace ROOT {
@@ -346,7 +369,8 @@ RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
      fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fSlotTaskIds(fNSlots)
 {
 }
 
@@ -356,14 +380,16 @@ RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles),
      fNewSampleNotifier(fNSlots),
      fSampleInfos(fNSlots),
-     fDatasetColumnReaders(fNSlots)
+     fDatasetColumnReaders(fNSlots),
+     fSlotTaskIds(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches)
    : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kDataSourceMT : ELoopType::kDataSource),
-     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fSlotTaskIds(fNSlots)
 {
    fDataSource->SetNSlots(fNSlots);
 }
@@ -372,7 +398,8 @@ RLoopManager::RLoopManager(ROOT::RDF::Experimental::RDatasetSpec &&spec)
    : fBeginEntry(spec.GetEntryRangeBegin()), fEndEntry(spec.GetEntryRangeEnd()),
      fDatasetGroups(spec.MoveOutDatasetGroups()), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fSlotTaskIds(fNSlots)
 {
    auto chain = std::make_shared<TChain>("");
    for (auto &group : fDatasetGroups) {
@@ -643,17 +670,23 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 }
 
 /// Build TTreeReaderValues for all nodes
-/// This method loops over all filters, actions and other booked objects and
+/// This method loops over all actions, filters and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
+/// Only the nodes that take part in this event loop are initialized, so that the TTreeReader does not read (and the
+/// TTreeCache does not prefetch) the branches of unused parts of the computation graph:
+/// - filters are initialized if they are named, as named filters always run, or if some booked action is downstream
+///   of them (children counts are evaluated by InitNodes before tasks start);
+/// - defines are initialized by RColumnRegister::GetReader when the first reader of their value is created in this
+///   task, see RDefineBase::InitSlotOnDemand.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
+   ++fSlotTaskIds[slot];
    SetupSampleCallbacks(r, slot);
    for (auto *ptr : fBookedActions)
       ptr->InitSlot(r, slot);
    for (auto *ptr : fBookedFilters)
-      ptr->InitSlot(r, slot);
-   for (auto *ptr : fBookedDefines)
-      ptr->InitSlot(r, slot);
+      if (ptr->HasName() || ptr->GetNChildren() > 0)
+         ptr->InitSlot(r, slot);
    for (auto *ptr : fBookedVariations)
       ptr->InitSlot(r, slot);
 
@@ -750,6 +783,19 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
    for (auto *ptr : fBookedDefines)
       ptr->FinalizeSlot(slot);
 
+   if (auto *profiler = GetProfiler()) {
+      TTree *tree = r != nullptr ? r->GetTree() : nullptr;
+      for (auto &v : fDatasetColumnReaders[slot]) {
+         auto *reader = dynamic_cast<RDFInternal::RProfiledColumnReader *>(v.second.get());
+         const auto nEntries = reader ? reader->TakeNEntriesRead() : 0ull;
+         if (nEntries == 0)
+            continue;
+         // strip the type name from the key, see MakeDatasetColReadersKey
+         const auto colName = v.first.substr(0, v.first.rfind(':'));
+         profiler->AddColumnReads(colName, nEntries, nEntries * GetAverageEntrySize(tree, colName));
+      }
+   }
+
    if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT) {
       // we are reading from a tree/chain and we need to re-create the RTreeColumnReaders at every task
       // because the TTreeReader object changes at every task
@@ -765,6 +811,9 @@ void RLoopManager::Jit()
    // TODO this should be a read lock unless we find GetCodeToJit non-empty
    R__LOCKGUARD(gROOTMutex);
 
+   // functions of string expressions whose return types came from the cache have not been declared yet
+   RDFInternal::DeclarePendingFunctions();
+
    const std::string code = std::move(GetCodeToJit());
    if (code.empty()) {
       R__LOG_INFO(RDFLogChannel()) << "Nothing to jit and execute.";
@@ -809,6 +858,7 @@ void RLoopManager::Run(bool jit)
    if (jit)
       Jit();
 
+   ProfileDataSourceColumnReaders(GetProfiler() != nullptr);
    InitNodes();
 
    TStopwatch s;
@@ -822,6 +872,8 @@ void RLoopManager::Run(bool jit)
    case ELoopType::kDataSource: RunDataSource(); break;
    }
    s.Stop();
+   if (auto *profiler = GetProfiler())
+      profiler->AddLoopTime(s.RealTime());
 
    CleanUpNodes();
 
@@ -842,6 +894,46 @@ TTree *RLoopManager::GetTree() const
    return fTree.get();
 }
 
+void RLoopManager::EnableProfiling(bool enable)
+{
+   if (enable && !fProfiler)
+      fProfiler = std::make_unique<RDFInternal::RLoopProfiler>(fNSlots);
+   fProfilingEnabled = enable;
+}
+
+/// Collect the profiles of the nodes that were evaluated at least once and of the dataset columns that were read.
+ROOT::RDF::Experimental::RProfileReport RLoopManager::GetProfileReport() const
+{
+   std::vector<ROOT::RDF::Experimental::RNodeProfileInfo> nodes;
+   auto addNode = [&nodes](const std::string &kind, std::string name, const std::string &variation,
+                           const RDFInternal::RNodeProfile &profile) {
+      // e.g. jitted filters forward all calls to their concrete filter, which is registered separately
+      const auto nCalls = profile.GetNCalls();
+      if (nCalls == 0)
+         return;
+      if (variation != "nominal")
+         name += ':' + variation;
+      nodes.push_back({kind, std::move(name), profile.GetTime(), nCalls});
+   };
+   for (auto *filterPtr : fBookedFilters)
+      addNode("Filter", filterPtr->HasName() ? filterPtr->GetName() : "Unnamed Filter", filterPtr->GetVariation(),
+              filterPtr->GetProfile());
+   for (auto *definePtr : fBookedDefines)
+      addNode("Define", definePtr->GetName(), definePtr->GetVariation(), definePtr->GetProfile());
+   for (auto *actionPtr : GetAllActions())
+      addNode("Action", RemoveEscapedNewlines(actionPtr->GetActionName()), "nominal", actionPtr->GetProfile());
+
+   std::vector<ROOT::RDF::Experimental::RColumnProfileInfo> columns;
+   double loopTime = 0.;
+   if (fProfiler) {
+      for (const auto &c : fProfiler->GetColumnProfiles())
+         columns.push_back({c.first, c.second.fNEntries, c.second.fBytes});
+      loopTime = fProfiler->GetLoopTime();
+   }
+
+   return ROOT::RDF::Experimental::RProfileReport(loopTime, std::move(nodes), std::move(columns));
+}
+
 void RLoopManager::Register(RDFInternal::RActionBase *actionPtr)
 {
    fBookedActions.emplace_back(actionPtr);
@@ -1030,11 +1122,30 @@ RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, const st
    const auto key = MakeDatasetColReadersKey(col, ti);
    // if a reader for this column and this slot was already there, we are doing something wrong
    assert(readers.find(key) == readers.end() || readers[key] == nullptr);
+   if (GetProfiler())
+      reader = std::make_unique<RDFInternal::RProfiledColumnReader>(std::move(reader));
    auto *rptr = reader.get();
    readers[key] = std::move(reader);
    return rptr;
 }
 
+/// Wrap the data source column readers in readers that count the entries read if `profile` is true, unwrap them
+/// otherwise. Tree column readers are wrapped when they are created, see AddTreeColumnReader.
+void RLoopManager::ProfileDataSourceColumnReaders(bool profile)
+{
+   if (fDataSource == nullptr)
+      return;
+   for (auto &readers : fDatasetColumnReaders) {
+      for (auto &v : readers) {
+         auto *profiled = dynamic_cast<RDFInternal::RProfiledColumnReader *>(v.second.get());
+         if (profile && v.second && !profiled)
+            v.second = std::make_unique<RDFInternal::RProfiledColumnReader>(std::move(v.second));
+         else if (!profile && profiled)
+            v.second = profiled->Release();
+      }
+   }
+}
+
 RColumnReaderBase *
 RLoopManager::GetDatasetColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const
 {
@@ -26,6 +26,8 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -73,7 +75,7 @@ public:
 
    const RColumnRepresentations &GetColumnRepresentations() const final
    {
-      static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+      static RColumnRepresentations representations({{EColumnType::kSplitIndex32}, {EColumnType::kIndex32}}, {{}});
       return representations;
    }
    // Field is only used for reading
@@ -303,6 +305,43 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
    return true;
 }
 
+void RNTupleDS::AddRangeFilter(std::string_view colName, double min, double max)
+{
+   if (!HasColumn(colName))
+      throw std::runtime_error("RNTupleDS: no column named '" + std::string(colName) + "'");
+   const auto fieldId = fSources[0]->GetSharedDescriptorGuard()->FindFieldId(colName);
+   if (fieldId == kInvalidDescriptorId) {
+      throw std::runtime_error("RNTupleDS: column '" + std::string(colName) +
+                               "' does not correspond to a field and cannot be used as a range filter");
+   }
+   fRangeFilters.push_back({fieldId, min, max});
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetFilteredEntryRanges()
+{
+   std::vector<std::pair<ULong64_t, ULong64_t>> clusterRanges;
+   std::vector<DescriptorId_t> clusterIds;
+   {
+      auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+      for (const auto &c : descriptorGuard->GetClusterIterable()) {
+         clusterRanges.emplace_back(c.GetFirstEntryIndex(), c.GetFirstEntryIndex() + c.GetNEntries());
+         clusterIds.emplace_back(c.GetId());
+      }
+   }
+
+   // One range per cluster: that keeps the clusters as the unit of parallelism
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   for (std::size_t i = 0; i < clusterIds.size(); ++i) {
+      const bool canSkip = std::any_of(fRangeFilters.begin(), fRangeFilters.end(), [&](const RRangeFilter &f) {
+         return fSources[0]->CanSkipCluster(clusterIds[i], f.fFieldId, f.fMin, f.fMax);
+      });
+      if (!canSkip)
+         ranges.emplace_back(clusterRanges[i]);
+   }
+   std::sort(ranges.begin(), ranges.end());
+   return ranges;
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
    // TODO(jblomer): use cluster boundaries for the entry ranges
@@ -310,6 +349,11 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
    if (fHasSeenAllRanges)
       return ranges;
 
+   if (!fRangeFilters.empty()) {
+      fHasSeenAllRanges = true;
+      return GetFilteredEntryRanges();
+   }
+
    auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
@@ -0,0 +1,112 @@
+/// \file RPersistentCache.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2023-06-12
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDF/GraphUtils.hxx>
+#include <ROOT/RDF/InterfaceUtils.hxx>
+#include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RPersistentCache.hxx>
+#include <TMD5.h>
+#include <TSystem.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+std::string ROOT::Internal::RDF::GetPersistentCachePath(const ROOT::RDF::RNode &node, const ColumnNames_t &columns,
+                                                        const std::vector<std::string> &columnTypes,
+                                                        const ROOT::RDF::Experimental::RPersistentCacheOptions &options)
+{
+   const auto datasetFingerprint = GetDatasetFingerprint(node);
+   if (datasetFingerprint.empty() && options.fUserKey.empty()) {
+      throw std::runtime_error("PersistentCache: the input dataset cannot be identified across processes, "
+                               "a user key is required in the cache options.");
+   }
+
+   // the graph is represented without profile annotations, which change from one event loop to the next
+   auto nodeCopy = node;
+   ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper graphHelper(/*withProfile=*/false);
+   const auto graph = graphHelper.RepresentGraph(nodeCopy);
+
+   std::stringstream key;
+   key << datasetFingerprint << '\n' << graph << '\n';
+   for (std::size_t i = 0; i < columns.size(); ++i)
+      key << columns[i] << ' ' << columnTypes[i] << '\n';
+   key << options.fUserKey;
+
+   const auto keyStr = key.str();
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(keyStr.data()), keyStr.size());
+   md5.Final();
+
+   return options.fCacheDir + "/rdfcache_" + md5.AsString() + ".root";
+}
+
+bool ROOT::Internal::RDF::HasPersistentCache(const std::string &path)
+{
+   // AccessPathName() returns false if the path exists
+   return !gSystem->AccessPathName(path.c_str());
+}
+
+std::string ROOT::Internal::RDF::GetPersistentCacheTempPath(const std::string &path)
+{
+   return path + ".tmp" + std::to_string(gSystem->GetPid());
+}
+
+void ROOT::Internal::RDF::CommitPersistentCache(const std::string &tempPath, const std::string &path)
+{
+   if (gSystem->Rename(tempPath.c_str(), path.c_str()) != 0) {
+      RemovePersistentCacheTemp(tempPath);
+      throw std::runtime_error("PersistentCache: cannot move the cache file to " + path);
+   }
+}
+
+void ROOT::Internal::RDF::RemovePersistentCacheTemp(const std::string &tempPath)
+{
+   gSystem->Unlink(tempPath.c_str());
+}
+
+ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>
+ROOT::Internal::RDF::OpenPersistentCache(const std::string &path)
+{
+   return ROOT::RDF::Experimental::FromRNTuple(kPersistentCacheNTupleName, path);
+}
+
+ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>
+ROOT::RDF::Experimental::PersistentCache(RNode node, const ColumnNames_t &columns,
+                                         const RPersistentCacheOptions &options)
+{
+   if (columns.empty())
+      throw std::runtime_error("PersistentCache: the list of columns to cache is empty.");
+
+   // build a string equivalent to
+   // "*(RInterface<RLoopManager>*)(&result) = PersistentCache<Ts...>(*(RNode*)(&node), ...)"
+   RInterface<ROOT::Detail::RDF::RLoopManager> result(std::make_shared<ROOT::Detail::RDF::RLoopManager>(0));
+   std::stringstream cacheCall;
+   cacheCall << "*reinterpret_cast<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>*>("
+             << ROOT::Internal::RDF::PrettyPrintAddr(&result)
+             << ") = ROOT::RDF::Experimental::PersistentCache<";
+   for (std::size_t i = 0; i < columns.size(); ++i) {
+      if (i > 0)
+         cacheCall << ", ";
+      cacheCall << node.GetColumnType(columns[i]);
+   }
+   cacheCall << ">(*reinterpret_cast<ROOT::RDF::RNode*>(" << ROOT::Internal::RDF::PrettyPrintAddr(&node)
+             << "), *reinterpret_cast<std::vector<std::string>*>(" << ROOT::Internal::RDF::PrettyPrintAddr(&columns)
+             << "), *reinterpret_cast<ROOT::RDF::Experimental::RPersistentCacheOptions*>("
+             << ROOT::Internal::RDF::PrettyPrintAddr(&options) << "));";
+   ROOT::Internal::RDF::InterpreterCalc(cacheCall.str(), "PersistentCache");
+
+   return result;
+}
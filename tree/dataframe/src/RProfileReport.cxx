@@ -0,0 +1,65 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "TString.h" // Printf
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+ROOT::RDF::Experimental::RProfileReport::RProfileReport(double loopTime, std::vector<RNodeProfileInfo> nodes,
+                                                        std::vector<RColumnProfileInfo> columns)
+   : fLoopTime(loopTime), fNodes(std::move(nodes)), fColumns(std::move(columns))
+{
+   std::stable_sort(fNodes.begin(), fNodes.end(),
+                    [](const RNodeProfileInfo &a, const RNodeProfileInfo &b) { return a.fTime > b.fTime; });
+}
+
+const ROOT::RDF::Experimental::RNodeProfileInfo &
+ROOT::RDF::Experimental::RProfileReport::GetNode(std::string_view name) const
+{
+   auto it = std::find_if(fNodes.begin(), fNodes.end(), [&name](const RNodeProfileInfo &n) { return n.fName == name; });
+   if (it == fNodes.end()) {
+      std::string err = "Cannot find a node called \"";
+      err += name;
+      err += "\" in the profile report.";
+      throw std::runtime_error(err);
+   }
+   return *it;
+}
+
+void ROOT::RDF::Experimental::RProfileReport::Print() const
+{
+   Printf("Event loop: %.3f s", fLoopTime);
+   for (const auto &n : fNodes) {
+      const double perCall = n.fNCalls > 0 ? 1e9 * n.fTime / n.fNCalls : 0.;
+      Printf("%-7s %-30s: time=%-10.3f s calls=%-12llu -- %.1f ns/call", n.fKind.c_str(), n.fName.c_str(), n.fTime,
+             n.fNCalls, perCall);
+   }
+   for (const auto &c : fColumns)
+      Printf("Column  %-30s: entries=%-12llu bytes=%.0f", c.fName.c_str(), c.fNEntries, c.fBytes);
+}
+
+std::string ROOT::RDF::Experimental::RProfileReport::AsJSON() const
+{
+   nlohmann::json nodes = nlohmann::json::array();
+   for (const auto &n : fNodes)
+      nodes.push_back({{"kind", n.fKind}, {"name", n.fName}, {"time", n.fTime}, {"calls", n.fNCalls}});
+   nlohmann::json columns = nlohmann::json::array();
+   for (const auto &c : fColumns)
+      columns.push_back({{"name", c.fName}, {"entries", c.fNEntries}, {"bytes", c.fBytes}});
+
+   nlohmann::json report;
+   report["loopTime"] = fLoopTime;
+   report["nodes"] = std::move(nodes);
+   report["columns"] = std::move(columns);
+   return report.dump();
+}
@@ -5,6 +5,10 @@
 #include <ROOT/RResultPtr.hxx>          // GetMergeableValue
 #include <ROOT/RDF/RMergeableValue.hxx> // MergeValues
 #include <ROOT/RDF/RResultMap.hxx>      // GetMergeableValue
+#ifndef _MSC_VER
+#include <ROOT/RDFMultiProcess.hxx>
+#endif
+#include <TSystem.h>
 
 #include <gtest/gtest.h>
 
@@ -401,3 +405,50 @@ TEST(RDataFrameMergeResults, MergeVariedHisto)
       EXPECT_EQ(histo.GetEntries(), 20);
    }
 }
+
+#ifndef _MSC_VER
+TEST(RDataFrameMergeResults, RunMultiProcess)
+{
+   const std::vector<std::string> fileNames{"dataframe_merge_results_mp_0.root", "dataframe_merge_results_mp_1.root"};
+   for (std::size_t i = 0; i < fileNames.size(); ++i) {
+      ROOT::RDataFrame(1000)
+         .Define("x", [i](ULong64_t e) { return double(e + 1000 * i); }, {"rdfentry_"})
+         .Snapshot<double>("t", fileNames[i], {"x"});
+   }
+
+   ROOT::RDF::Experimental::RDatasetSpec spec;
+   spec.AddGroup({"g", "t", fileNames});
+   auto bookResults = [](ROOT::RDF::RNode df) {
+      auto sel = df.Filter([](double x) { return int(x) % 2 == 0; }, {"x"});
+      return std::make_tuple(sel.Count(), sel.Sum<double>("x"), sel.Histo1D<double>({"h", "h", 20, 0., 2000.}, "x"),
+                             sel.Mean<double>("x"), sel.Max<double>("x"));
+   };
+
+   ROOT::RDF::Experimental::RMultiProcessOptions options;
+   options.fNWorkers = 2;
+   options.fNTasks = 5;
+   auto results = ROOT::RDF::Experimental::RunMultiProcess(spec, bookResults, options);
+   EXPECT_EQ(std::get<0>(results)->GetValue(), 1000ull);
+   EXPECT_DOUBLE_EQ(std::get<1>(results)->GetValue(), 999000.);
+   const auto &h = std::get<2>(results)->GetValue();
+   EXPECT_EQ(h.GetEntries(), 1000);
+   for (int bin = 1; bin <= 20; ++bin)
+      EXPECT_DOUBLE_EQ(h.GetBinContent(bin), 50.);
+   EXPECT_DOUBLE_EQ(std::get<3>(results)->GetValue(), 999.);
+   EXPECT_DOUBLE_EQ(std::get<4>(results)->GetValue(), 1998.);
+
+   // a failure in a worker is reported in the parent process
+   auto failingBookResults = [](ROOT::RDF::RNode df) {
+      auto sum = df.Define("y", [](double x) {
+                      if (x > 1500.)
+                         throw std::runtime_error("bad entry");
+                      return x;
+                   }, {"x"}).Sum<double>("y");
+      return std::make_tuple(sum);
+   };
+   EXPECT_THROW(ROOT::RDF::Experimental::RunMultiProcess(spec, failingBookResults, options), std::runtime_error);
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+#endif
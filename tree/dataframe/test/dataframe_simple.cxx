@@ -8,8 +8,10 @@
 
 #include <ROOT/TestSupport.hxx>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TChain.h>
+#include <TEnv.h>
 #include <TFile.h>
 #include <TGraph.h>
 #include <TInterpreter.h>
@@ -21,6 +23,8 @@
 #include <algorithm> // std::sort
 #include <array>
 #include <chrono>
+#include <fstream>
+#include <iterator>
 #include <thread>
 #include <set>
 #include <random>
@@ -849,6 +853,121 @@ TEST_P(RDFSimpleTests, HistosOneWeightPerEvent)
    EXPECT_DOUBLE_EQ(h3->GetMean(), 2.);
 }
 
+// Large histograms are filled concurrently in shared bins instead of per-slot copies, the results must not change
+TEST_P(RDFSimpleTests, SharedFillHistos)
+{
+   auto df = ROOT::RDataFrame(1000)
+                .Define("x", [](ULong64_t e) { return double(e % 37) - 3.; }, {"rdfentry_"})
+                .Define("y", [](ULong64_t e) { return float(e % 11); }, {"rdfentry_"})
+                .Define("z", [](ULong64_t e) { return int(e % 7); }, {"rdfentry_"})
+                .Define("w", [](ULong64_t e) { return 0.5 * (e % 3); }, {"rdfentry_"})
+                .Define("v", [](ULong64_t e) { return ROOT::RVecD{double(e % 5), double(e % 13)}; }, {"rdfentry_"});
+
+   auto fillHistos = [&df] {
+      std::vector<ROOT::RDF::RResultPtr<::TH1>> histos;
+      histos.emplace_back(df.Histo1D<double>({"h1", "h1", 30, 0., 30.}, "x"));
+      histos.emplace_back(df.Histo1D<ROOT::RVecD, double>({"h1v", "h1v", 10, 0., 10.}, "v", "w"));
+      histos.emplace_back(df.Histo2D<double, float, double>({"h2", "h2", 30, 0., 30., 5, 0., 10.}, "x", "y", "w"));
+      histos.emplace_back(df.Histo3D<double, float, int>({"h3", "h3", 30, 0., 30., 5, 0., 10., 3, 0., 6.}, "x", "y", "z"));
+      return histos;
+   };
+
+   auto expected = fillHistos();
+   gEnv->SetValue("RDataFrame.SharedFillThreshold", "-1");
+   auto shared = fillHistos();
+   gEnv->SetValue("RDataFrame.SharedFillThreshold", "256");
+
+   for (std::size_t i = 0; i < expected.size(); ++i) {
+      const auto &e = *expected[i];
+      const auto &s = *shared[i];
+      EXPECT_EQ(s.GetNcells(), e.GetNcells());
+      for (int bin = 0; bin < e.GetNcells(); ++bin) {
+         EXPECT_DOUBLE_EQ(s.GetBinContent(bin), e.GetBinContent(bin));
+         EXPECT_DOUBLE_EQ(s.GetBinError(bin), e.GetBinError(bin));
+      }
+      EXPECT_DOUBLE_EQ(s.GetEntries(), e.GetEntries());
+      EXPECT_EQ(s.GetSumw2N(), e.GetSumw2N());
+      for (int axis = 1; axis <= e.GetDimension(); ++axis) {
+         EXPECT_NEAR(s.GetMean(axis), e.GetMean(axis), 1e-9);
+         EXPECT_NEAR(s.GetStdDev(axis), e.GetStdDev(axis), 1e-9);
+      }
+   }
+}
+
+TEST_P(RDFSimpleTests, Profiling)
+{
+   const auto filename = std::string("rdf_profiling_") + (GetParam() ? "mt" : "st") + ".root";
+   ROOT::RDataFrame(100)
+      .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+      .Snapshot<int>("t", filename, {"x"});
+
+   ROOT::RDataFrame df("t", filename);
+   ROOT::RDF::Experimental::EnableProfiling(df);
+   auto sel = df.Define("y", [](int x) { return 2 * x; }, {"x"}).Filter([](int y) { return y < 100; }, {"y"}, "yCut");
+   auto count = sel.Count();
+   auto sum = df.Sum<int>("x");
+   EXPECT_EQ(*count, 50ull);
+   EXPECT_EQ(*sum, 4950);
+
+   const auto report = ROOT::RDF::Experimental::GetProfileReport(df);
+   EXPECT_EQ(report.GetNode("y").fNCalls, 100ull);
+   EXPECT_EQ(report.GetNode("yCut").fNCalls, 100ull);
+   EXPECT_EQ(report.GetNode("Count").fNCalls, 50ull);
+   EXPECT_EQ(report.GetNode("Sum").fNCalls, 100ull);
+   for (const auto &n : report.GetNodes())
+      EXPECT_GE(n.fTime, 0.);
+   ASSERT_EQ(report.GetColumns().size(), 1u);
+   EXPECT_EQ(report.GetColumns()[0].fName, "x");
+   EXPECT_EQ(report.GetColumns()[0].fNEntries, 100ull);
+   EXPECT_GT(report.GetColumns()[0].fBytes, 0.);
+   EXPECT_NE(report.AsJSON().find("\"yCut\""), std::string::npos);
+   EXPECT_NE(ROOT::RDF::SaveGraph(df).find(" calls"), std::string::npos);
+
+   // nothing is recorded while profiling is disabled
+   ROOT::RDF::Experimental::EnableProfiling(df, false);
+   df.Count().GetValue();
+   const auto nodes = ROOT::RDF::Experimental::GetProfileReport(df).GetNodes();
+   EXPECT_EQ(std::count_if(nodes.begin(), nodes.end(), [](const auto &n) { return n.fName == "Count"; }), 1);
+   EXPECT_EQ(ROOT::RDF::Experimental::GetProfileReport(df).GetNode("Sum").fNCalls, 100ull);
+
+   gSystem->Unlink(filename.c_str());
+}
+
+// Filters and Defines that no booked action depends on must not cause their input branches to be read
+TEST_P(RDFSimpleTests, DeadBranchesAreNotRead)
+{
+   const auto filename = std::string("rdf_deadbranches_") + (GetParam() ? "mt" : "st") + ".root";
+   ROOT::RDataFrame(1000)
+      .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+      .Define("v", [](ULong64_t e) { return std::vector<float>(100, e); }, {"rdfentry_"})
+      .Snapshot<int, std::vector<float>>("t", filename, {"x", "v"});
+
+   auto bytesRead = [&filename](bool withDeadNodes) {
+      const auto before = TFile::GetFileBytesRead();
+      ROOT::RDataFrame df("t", filename);
+      auto count = df.Filter([](int x) { return x < 10; }, {"x"}).Count();
+      if (withDeadNodes) {
+         auto vSum = df.Define("vSum", [](const std::vector<float> &v) { return v.size(); }, {"v"});
+         vSum.Filter([](std::size_t s) { return s > 0; }, {"vSum"});
+      }
+      EXPECT_EQ(*count, 10ull);
+      return TFile::GetFileBytesRead() - before;
+   };
+   EXPECT_EQ(bytesRead(true), bytesRead(false));
+
+   // a branch read in a previous event loop is not read again if the nodes that needed it are dead in this one
+   ROOT::RDataFrame df("t", filename);
+   auto vSize = df.Define("vSize", [](const std::vector<float> &v) { return v.size(); }, {"v"});
+   auto first = vSize.Filter([](std::size_t s) { return s == 100; }, {"vSize"}).Count();
+   EXPECT_EQ(*first, 1000ull);
+   const auto before = TFile::GetFileBytesRead();
+   auto second = df.Filter([](int x) { return x < 10; }, {"x"}).Count();
+   EXPECT_EQ(*second, 10ull);
+   EXPECT_EQ(TFile::GetFileBytesRead() - before, bytesRead(false));
+
+   gSystem->Unlink(filename.c_str());
+}
+
 TEST_P(RDFSimpleTests, ManyRangesPerWorker)
 {
    auto filename = "ManyRangesPerWorker_file.root";
@@ -1014,6 +1133,107 @@ TEST_P(RDFSimpleTests, FillWithCustomClassJitted)
    EXPECT_EQ(h.GetEntries(), 10);
 }
 
+/// Point RDataFrame.JitTypeCacheDir to the given directory, remove the directory and restore the previous value at the
+/// end of the scope
+class JitTypeCacheDirRAII {
+   std::string fDir;
+   std::string fOldDir;
+
+public:
+   JitTypeCacheDirRAII(const std::string &dir)
+      : fDir(dir), fOldDir(gEnv->GetValue("RDataFrame.JitTypeCacheDir", ""))
+   {
+      gEnv->SetValue("RDataFrame.JitTypeCacheDir", fDir.c_str());
+   }
+   ~JitTypeCacheDirRAII()
+   {
+      if (void *dir = gSystem->OpenDirectory(fDir.c_str())) {
+         while (const char *entry = gSystem->GetDirEntry(dir)) {
+            const std::string fileName = entry;
+            if (fileName != "." && fileName != "..")
+               gSystem->Unlink((fDir + "/" + fileName).c_str());
+         }
+         gSystem->FreeDirectory(dir);
+         gSystem->Unlink(fDir.c_str());
+      }
+      gEnv->SetValue("RDataFrame.JitTypeCacheDir", fOldDir.c_str());
+   }
+};
+
+static std::string ReadFile(const std::string &fileName)
+{
+   std::ifstream f(fileName);
+   return std::string{std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>()};
+}
+
+TEST(RDFSimpleTests, JitTypeCache)
+{
+   using ROOT::Internal::RDF::GetJitTypeCacheFile;
+   using ROOT::Internal::RDF::WriteJitTypeCacheEntry;
+
+   JitTypeCacheDirRAII cacheDir("RDFSimpleTests_JitTypeCache");
+   // each expression is used once: the types of functions that have already been jitted are not looked up again
+   auto df = ROOT::RDataFrame(10).Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+
+   // miss: the function is declared and its type is stored in the cache
+   auto y = df.Define("y", "x * 3 + 1729");
+   EXPECT_EQ(y.GetColumnType("y"), "int");
+   const auto missFile = GetJitTypeCacheFile("var0 * 3 + 1729", {"var0"}, {"int"});
+   EXPECT_EQ(ReadFile(missFile).substr(0, 4), "int\n");
+
+   // hit: the cached type is used and confirmed when the functions are declared, the entry is left untouched
+   WriteJitTypeCacheEntry("var0 * 3 + 1730", {"var0"}, {"int"}, "int");
+   const auto hitFile = GetJitTypeCacheFile("var0 * 3 + 1730", {"var0"}, {"int"});
+   const auto hitEntry = ReadFile(hitFile);
+   auto z = df.Define("z", "x * 3 + 1730");
+   EXPECT_EQ(z.GetColumnType("z"), "int");
+   auto sumY = y.Filter("y % 2 == 1729 % 2").Sum<int>("y");
+   auto sumZ = z.Sum<int>("z");
+   EXPECT_EQ(*sumY, 5 * 1729 + 3 * (0 + 2 + 4 + 6 + 8));
+   EXPECT_EQ(*sumZ, 10 * 1730 + 3 * 45);
+   EXPECT_EQ(ReadFile(hitFile), hitEntry);
+
+   // corrupt: an entry that does not store the key of the expression is ignored and written again
+   const auto corruptFile = GetJitTypeCacheFile("var0 * 3 + 1731", {"var0"}, {"int"});
+   {
+      std::ofstream f(corruptFile);
+      f << "double\ngarbage";
+   }
+   EXPECT_EQ(df.Define("w", "x * 3 + 1731").GetColumnType("w"), "int");
+   EXPECT_EQ(ReadFile(corruptFile).substr(0, 4), "int\n");
+
+   // stale: a wrong type is used at booking, detected when the functions are declared and removed from the cache
+   WriteJitTypeCacheEntry("var0 * 3 + 1732", {"var0"}, {"int"}, "double");
+   const auto staleFile = GetJitTypeCacheFile("var0 * 3 + 1732", {"var0"}, {"int"});
+   auto v = df.Define("v", "x * 3 + 1732");
+   EXPECT_EQ(v.GetColumnType("v"), "double");
+   auto sumV = v.Sum<double>("v");
+   EXPECT_THROW(*sumV, std::runtime_error);
+   EXPECT_TRUE(gSystem->AccessPathName(staleFile.c_str())); // kTRUE if the file does not exist
+   EXPECT_EQ(df.Define("v2", "x * 3 + 1732").GetColumnType("v2"), "int");
+}
+
+TEST(RDFSimpleTests, JitInvalidExpressionOfOtherGraph)
+{
+   using ROOT::Internal::RDF::WriteJitTypeCacheEntry;
+
+   JitTypeCacheDirRAII cacheDir("RDFSimpleTests_JitInvalidExpressionOfOtherGraph");
+   auto df1 = ROOT::RDataFrame(10).Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+   auto df2 = ROOT::RDataFrame(10).Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+
+   // the type of an expression that does not compile is taken from the cache, so its declaration is deferred
+   WriteJitTypeCacheEntry("var0 * 3 + rdfUndeclaredSymbol1733", {"var0"}, {"int"}, "int");
+   auto sumInvalid = df1.Define("y", "x * 3 + rdfUndeclaredSymbol1733").Sum<int>("y");
+
+   // a cache miss in another graph declares all pending functions: that graph is not affected by the invalid one
+   auto z = df2.Define("z", "x * 3 + 1733");
+   EXPECT_EQ(z.GetColumnType("z"), "int");
+   EXPECT_EQ(*z.Sum<int>("z"), 10 * 1733 + 3 * 45);
+
+   // the graph that uses the invalid expression fails when it is jitted
+   EXPECT_THROW(*sumInvalid, std::runtime_error);
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
@@ -1,13 +1,20 @@
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RPersistentCache.hxx>
 #include <ROOT/RVec.hxx>
 
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <TFile.h>
+#include <TTree.h>
+
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+
 using ROOT::Experimental::RNTupleDS;
 using ROOT::Experimental::RNTupleWriter;
 using ROOT::Experimental::RNTupleModel;
@@ -135,3 +142,190 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+static void SnapshotToRNTupleTest(const std::string &fileName)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto df = ROOT::RDataFrame(100)
+                .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                .Define("v", [](int x) { return ROOT::RVecF(x % 3, 1.f); }, {"x"})
+                .Filter([](int x) { return x % 2 == 0; }, {"x"});
+   auto snap = df.Snapshot<int, ROOT::RVecF>("ntuple", fileName, {"x", "v"}, opts);
+
+   EXPECT_EQ(50u, *snap->Count());
+   EXPECT_EQ(2450, *snap->Sum<int>("x"));
+   EXPECT_EQ(*df.Define("n", [](const ROOT::RVecF &v) { return v.size(); }, {"v"}).Sum<std::size_t>("n"),
+             *snap->Define("n", [](const ROOT::RVecF &v) { return v.size(); }, {"v"}).Sum<std::size_t>("n"));
+
+   auto reader = ROOT::Experimental::RNTupleReader::Open("ntuple", fileName);
+   EXPECT_EQ(50u, reader->GetNEntries());
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, SnapshotRNTuple)
+{
+   SnapshotToRNTupleTest("RNTupleDS_test_snapshot.root");
+
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   opts.fMode = "UPDATE";
+   EXPECT_THROW(ROOT::RDataFrame(1).Define("x", [] { return 1; }).Snapshot<int>("ntuple", "f.root", {"x"}, opts),
+                std::invalid_argument);
+
+   // a lazy Snapshot returns a data frame that reads the RNTuple once it is written
+   const std::string fileName = "RNTupleDS_test_snapshot_lazy.root";
+   opts.fMode = "RECREATE";
+   opts.fLazy = true;
+   auto snap = ROOT::RDataFrame(10).Define("x", [] { return 1; }).Snapshot<int>("ntuple", fileName, {"x"}, opts);
+   EXPECT_EQ(10, *snap->Sum<int>("x"));
+   std::remove(fileName.c_str());
+
+   // before, it throws
+   auto pending = ROOT::Internal::RDF::MakeRNTupleSnapshotOutputDF("ntuple", fileName);
+   EXPECT_THROW(pending->GetColumnNames(), std::runtime_error);
+   EXPECT_THROW(*pending->Count(), std::runtime_error);
+}
+
+TEST(RNTupleDS, SnapshotRNTupleMT)
+{
+   IMTRAII _;
+
+   SnapshotToRNTupleTest("RNTupleDS_test_snapshot_mt.root");
+}
+
+TEST(RNTupleDS, RangeFilter)
+{
+   const std::string fileName = "RNTupleDS_test_rangefilter.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto wrId = model->MakeField<int>("id");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetEnablePageStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int i = 0; i < 100; ++i) {
+         *wrId = i;
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", fileName));
+   EXPECT_THROW(ds->AddRangeFilter("nonexistent", 0, 1), std::runtime_error);
+   ds->AddRangeFilter("id", 25, 42);
+   ds->SetNSlots(1);
+   ds->Initialize();
+   auto ranges = ds->GetEntryRanges();
+   ASSERT_EQ(3u, ranges.size());
+   EXPECT_EQ(20u, ranges[0].first);
+   EXPECT_EQ(50u, ranges[2].second);
+   EXPECT_TRUE(ds->GetEntryRanges().empty());
+
+   ds = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", fileName));
+   ds->AddRangeFilter("id", 25, 42);
+   ROOT::RDataFrame df(std::move(ds));
+   EXPECT_EQ(18u, *df.Filter("id >= 25 && id <= 42").Count());
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, PersistentCache)
+{
+   const std::string fileName = "RNTupleDS_test_persistentcache.root";
+   {
+      TFile f(fileName.c_str(), "RECREATE");
+      TTree t("t", "t");
+      int id;
+      t.Branch("id", &id);
+      for (id = 0; id < 100; ++id)
+         t.Fill();
+      t.Write();
+   }
+
+   std::atomic<int> nCalls{0};
+   auto makeNode = [&](ROOT::RDataFrame &df) {
+      return ROOT::RDF::RNode(df.Filter([](int id) { return id % 2 == 0; }, {"id"}).Define("x", [&](int id) {
+         ++nCalls;
+         return 0.5f * id;
+      }, {"id"}));
+   };
+
+   ROOT::RDF::Experimental::RPersistentCacheOptions options;
+   options.fUserKey = "v1";
+   const ROOT::RDF::ColumnNames_t columns{"id", "x"};
+   const auto cachePath = ROOT::Internal::RDF::GetPersistentCachePath(
+      [&] {
+         ROOT::RDataFrame df("t", fileName);
+         return makeNode(df);
+      }(),
+      columns, {"int", "float"}, options);
+   EXPECT_FALSE(ROOT::Internal::RDF::HasPersistentCache(cachePath));
+
+   {
+      ROOT::RDataFrame df("t", fileName);
+      auto cached = ROOT::RDF::Experimental::PersistentCache<int, float>(makeNode(df), columns, options);
+      EXPECT_EQ(50, nCalls);
+      EXPECT_EQ(50u, *cached.Count());
+      EXPECT_FLOAT_EQ(1225.f, *cached.Sum<float>("x"));
+      // single-thread runs cache the entries in the input order
+      const auto ids = *cached.Take<int>("id");
+      for (std::size_t i = 0; i < ids.size(); ++i)
+         EXPECT_EQ(2 * int(i), ids[i]);
+   }
+   EXPECT_TRUE(ROOT::Internal::RDF::HasPersistentCache(cachePath));
+
+   {
+      ROOT::RDataFrame df("t", fileName);
+      auto cached = ROOT::RDF::Experimental::PersistentCache<int, float>(makeNode(df), columns, options);
+      // The second run reads from the cache file without running the upstream graph
+      EXPECT_EQ(50, nCalls);
+      EXPECT_EQ(50u, *cached.Count());
+      EXPECT_EQ(2450, *cached.Sum<int>("id"));
+   }
+
+   options.fUserKey = "v2";
+   {
+      ROOT::RDataFrame df("t", fileName);
+      auto cached = ROOT::RDF::Experimental::PersistentCache<int, float>(makeNode(df), columns, options);
+      EXPECT_EQ(100, nCalls);
+      std::remove(ROOT::Internal::RDF::GetPersistentCachePath(makeNode(df), columns, {"int", "float"}, options).c_str());
+   }
+
+   std::remove(cachePath.c_str());
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, PersistentCacheMT)
+{
+   IMTRAII _;
+
+   const std::string fileName = "RNTupleDS_test_persistentcache_mt.root";
+   {
+      TFile f(fileName.c_str(), "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(100);
+      int id;
+      t.Branch("id", &id);
+      for (id = 0; id < 10000; ++id)
+         t.Fill();
+      t.Write();
+   }
+
+   ROOT::RDF::Experimental::RPersistentCacheOptions options;
+   options.fUserKey = "mt";
+   ROOT::RDataFrame df("t", fileName);
+   const auto cachePath = ROOT::Internal::RDF::GetPersistentCachePath(df, {"id"}, {"int"}, options);
+   auto cached = ROOT::RDF::Experimental::PersistentCache<int>(df, {"id"}, options);
+
+   // all entries are cached, but their order depends on the order in which the slots commit their clusters
+   auto ids = *cached.Take<int>("id");
+   EXPECT_EQ(10000u, ids.size());
+   std::sort(ids.begin(), ids.end());
+   for (std::size_t i = 0; i < ids.size(); ++i)
+      EXPECT_EQ(int(i), ids[i]);
+
+   std::remove(cachePath.c_str());
+   std::remove(fileName.c_str());
+}
@@ -17,9 +17,13 @@
 #define ROOT7_RClusterPool
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -50,6 +54,11 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+
+The number of clusters per bunch is either fixed or adaptive (see RNTupleReadOptions). In adaptive mode, the pool
+evaluates its performance counters after every bunch of consumed clusters. If the reader had to wait for clusters
+from the pipeline, the bunch size is doubled. If the pipeline is idle most of the time, the bunch size is decreased
+by one. The bunch size never exceeds the configured maximum, nor the size that fits twice into the memory budget.
 */
 // clang-format on
 class RClusterPool {
@@ -96,6 +105,11 @@ private:
    unsigned int fWindowPre = 0;
    /// The number of clusters that are being read in a single vector read.
    unsigned int fClusterBunchSize;
+   /// If true, fClusterBunchSize is adjusted at run time between 1 and fMaxClusterBunchSize
+   bool fIsAdaptive = false;
+   unsigned int fMaxClusterBunchSize;
+   /// In adaptive mode, limits the bunch size such that two bunches of clusters fit in the given number of bytes
+   std::size_t fMemoryBudget = 0;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
@@ -117,6 +131,34 @@ private:
    /// The communication channel between the I/O thread and the unzip thread
    std::deque<RUnzipItem> fUnzipQueue;
 
+   /// I/O performance counters of the pipeline, registered in fMetrics. In adaptive mode, the counters are always
+   /// enabled because they steer the bunch size.
+   struct RCounters {
+      RNTupleAtomicCounter &fNClusterBunchSize;
+      RNTupleAtomicCounter &fNClusterLoaded;
+      RNTupleAtomicCounter &fSzLoaded;
+      RNTupleAtomicCounter &fTimeWallLoad;
+      RNTupleAtomicCounter &fTimeWallUnzip;
+      RNTupleAtomicCounter &fNStall;
+      RNTupleAtomicCounter &fTimeWallStall;
+   };
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+
+   /// Counter values at the beginning of the current adaptation window
+   struct RWindow {
+      std::chrono::steady_clock::time_point fStart;
+      std::int64_t fNClusterLoaded = 0;
+      std::int64_t fTimeWallLoad = 0;
+      std::int64_t fTimeWallUnzip = 0;
+      std::int64_t fTimeWallStall = 0;
+      /// Number of different clusters requested by GetCluster() in the window
+      unsigned int fNClustersConsumed = 0;
+   };
+   RWindow fWindow;
+   /// Used to detect when the reader moves on to the next cluster
+   DescriptorId_t fLastClusterId = kInvalidDescriptorId;
+
    /// The I/O thread calls RPageSource::LoadClusters() asynchronously.  The thread is mostly waiting for the
    /// data to arrive (blocked by the kernel) and therefore can safely run in addition to the application
    /// main threads.
@@ -140,10 +182,20 @@ private:
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
    RCluster *WaitFor(DescriptorId_t clusterId, const RCluster::ColumnSet_t &physicalColumns);
+   /// Called by GetCluster() when the reader requests a new cluster; in adaptive mode, evaluates the performance
+   /// counters after every bunch of consumed clusters and sets the bunch size for the following requests.
+   void AdaptClusterBunchSize(DescriptorId_t clusterId);
 
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
+   /// Stall times below this fraction of the adaptation window are considered noise
+   static constexpr double kStallThreshold = 0.05;
+   /// If the pipeline is busy less than this fraction of the reader's time, the bunch size is decreased
+   static constexpr double kIdleThreshold = 0.25;
+
    RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize);
+   /// Takes the fixed or initial cluster bunch size and the adaptive settings from the read options
+   RClusterPool(RPageSource &pageSource, const RNTupleReadOptions &options);
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultClusterBunchSize) {}
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
@@ -159,6 +211,9 @@ public:
 
    /// Used by the unit tests to drain the queue of clusters to be preloaded
    void WaitForInFlightClusters();
+
+   unsigned int GetClusterBunchSize() const { return fClusterBunchSize; }
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
 }; // class RClusterPool
 
 } // namespace Detail
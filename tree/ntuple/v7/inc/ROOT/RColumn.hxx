@@ -25,7 +25,10 @@
 
 #include <TError.h>
 
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace ROOT {
@@ -43,6 +46,12 @@ logical data layer.
 */
 // clang-format on
 class RColumn {
+public:
+   /// Computes the value statistics of a write page. For offset columns, the statistics are computed over the
+   /// collection sizes; `prevOffset` is the offset preceding the first element of the page and it is set to the
+   /// last offset of the page on return.
+   using StatisticsFunc_t = void (*)(const RPage &page, std::uint64_t &prevOffset, RColumnStatistics &statistics);
+
 private:
    RColumnModel fModel;
    /**
@@ -74,6 +83,34 @@ private:
    ColumnId_t fColumnIdSource = kInvalidColumnId;
    /// Used to pack and unpack pages on writing/reading
    std::unique_ptr<RColumnElementBase> fElement;
+   /// Set for columns of arithmetic and offset type; nullptr for columns without meaningful value statistics
+   StatisticsFunc_t fStatisticsFunc = nullptr;
+
+   template <typename CppT>
+   static void ComputeStatistics(const RPage &page, std::uint64_t &prevOffset, RColumnStatistics &statistics)
+   {
+      const auto values = reinterpret_cast<const CppT *>(page.GetBuffer());
+      const auto nElements = page.GetNElements();
+      if constexpr (std::is_same_v<CppT, ClusterSize_t>) {
+         for (std::uint32_t i = 0; i < nElements; ++i) {
+            const auto size = values[i] - prevOffset;
+            statistics.Update(static_cast<double>(size));
+            if (size == 0)
+               statistics.fNEmpty++;
+            prevOffset = values[i];
+         }
+      } else {
+         for (std::uint32_t i = 0; i < nElements; ++i)
+            statistics.Update(static_cast<double>(values[i]));
+         if constexpr (sizeof(CppT) == 8 && std::is_integral_v<CppT>) {
+            // Large 64bit integers are not exactly representable as doubles; keep the envelope conservative
+            if (statistics.IsValid()) {
+               statistics.fMin = std::nextafter(statistics.fMin, -std::numeric_limits<double>::infinity());
+               statistics.fMax = std::nextafter(statistics.fMax, std::numeric_limits<double>::infinity());
+            }
+         }
+      }
+   }
 
    RColumn(const RColumnModel &model, std::uint32_t index);
 
@@ -105,6 +142,10 @@ public:
    {
       auto column = std::unique_ptr<RColumn>(new RColumn(model, index));
       column->fElement = RColumnElementBase::Generate<CppT>(model.GetType());
+      if constexpr (std::is_same_v<CppT, ClusterSize_t> ||
+                    (std::is_arithmetic_v<CppT> && !std::is_same_v<CppT, char>)) {
+         column->fStatisticsFunc = ComputeStatistics<CppT>;
+      }
       return column;
    }
 
@@ -308,6 +349,7 @@ public:
    NTupleSize_t GetNElements() const { return fNElements; }
    RColumnElementBase *GetElement() const { return fElement.get(); }
    const RColumnModel &GetModel() const { return fModel; }
+   StatisticsFunc_t GetStatisticsFunc() const { return fStatisticsFunc; }
    std::uint32_t GetIndex() const { return fIndex; }
    ColumnId_t GetColumnIdSource() const { return fColumnIdSource; }
    RPageSource *GetPageSource() const { return fPageSource; }
@@ -114,6 +114,49 @@ static void UnsplitElementsBE(void *destination, const void *source, std::size_t
       }
    }
 }
+
+/// \brief Zigzag-encodes the array of N-byte signed integers and stores the result in columnar layout.
+///
+/// Zigzag encoding maps signed integers to unsigned ones such that values of small magnitude, including negative
+/// values, end up with leading zero bytes: 0, -1, 1, -2, 2, ... become 0, 1, 2, 3, 4, ...
+/// Like SplitElementsLE, the destination stores all the least significant bytes first, then all the second bytes, etc.
+/// The bytes are extracted arithmetically, so the routine is independent of the host endianess. Both the source and
+/// the destination are traversed linearly in the inner loop, which lets the compiler vectorize the loop.
+template <typename T>
+static void ZigzagSplitElements(void *destination, const void *source, std::size_t count)
+{
+   using UnsignedT = std::make_unsigned_t<T>;
+   constexpr std::size_t N = sizeof(T);
+   const T *src = reinterpret_cast<const T *>(source);
+   unsigned char *splitArray = reinterpret_cast<unsigned char *>(destination);
+   for (std::size_t b = 0; b < N; ++b) {
+      unsigned char *splitBytes = splitArray + b * count;
+      for (std::size_t i = 0; i < count; ++i) {
+         const UnsignedT zigzag =
+            (static_cast<UnsignedT>(src[i]) << 1) ^ static_cast<UnsignedT>(src[i] >> (8 * N - 1));
+         splitBytes[i] = static_cast<unsigned char>(zigzag >> (8 * b));
+      }
+   }
+}
+
+/// Reverse of ZigzagSplitElements. Stores the decoded values in the native byte order of the host.
+template <typename T>
+static void ZigzagUnsplitElements(void *destination, const void *source, std::size_t count)
+{
+   using UnsignedT = std::make_unsigned_t<T>;
+   constexpr std::size_t N = sizeof(T);
+   const unsigned char *splitArray = reinterpret_cast<const unsigned char *>(source);
+   UnsignedT *dst = reinterpret_cast<UnsignedT *>(destination);
+   for (std::size_t i = 0; i < count; ++i)
+      dst[i] = splitArray[i];
+   for (std::size_t b = 1; b < N; ++b) {
+      const unsigned char *splitBytes = splitArray + b * count;
+      for (std::size_t i = 0; i < count; ++i)
+         dst[i] |= static_cast<UnsignedT>(splitBytes[i]) << (8 * b);
+   }
+   for (std::size_t i = 0; i < count; ++i)
+      dst[i] = (dst[i] >> 1) ^ (UnsignedT(0) - (dst[i] & 1));
+}
 } // anonymous namespace
 
 namespace ROOT {
@@ -252,6 +295,21 @@ public:
    }
 }; // class RColumnElementSplitLE
 
+/**
+ * Base class for zigzag + split columns of signed integers.
+ * The implementation of `Pack` and `Unpack` is endianess agnostic.
+ */
+template <typename CppT>
+class RColumnElementZigzagSplitLE : public RColumnElementBase {
+public:
+   static_assert(std::is_signed_v<CppT>, "zigzag encoding requires signed integers");
+   static constexpr bool kIsMappable = false;
+   RColumnElementZigzagSplitLE(void *rawContent, std::size_t size) : RColumnElementBase(rawContent, size) {}
+
+   void Pack(void *dst, void *src, std::size_t count) const final { ZigzagSplitElements<CppT>(dst, src, count); }
+   void Unpack(void *dst, void *src, std::size_t count) const final { ZigzagUnsplitElements<CppT>(dst, src, count); }
+}; // class RColumnElementZigzagSplitLE
+
 /**
  * Pairs of C++ type and column type, like float and EColumnType::kReal32
  */
@@ -487,6 +545,16 @@ public:
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
 };
 
+template <>
+class RColumnElement<std::int16_t, EColumnType::kSplitZigzagInt16> : public RColumnElementZigzagSplitLE<std::int16_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int16_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int16_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
 template <>
 class RColumnElement<std::int32_t, EColumnType::kInt32> : public RColumnElementLE<std::int32_t> {
 public:
@@ -527,6 +595,16 @@ public:
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
 };
 
+template <>
+class RColumnElement<std::int32_t, EColumnType::kSplitZigzagInt32> : public RColumnElementZigzagSplitLE<std::int32_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int32_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
 template <>
 class RColumnElement<std::int64_t, EColumnType::kInt64> : public RColumnElementLE<std::int64_t> {
 public:
@@ -567,6 +645,16 @@ public:
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
 };
 
+template <>
+class RColumnElement<std::int64_t, EColumnType::kSplitZigzagInt64> : public RColumnElementZigzagSplitLE<std::int64_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int64_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
 template <>
 class RColumnElement<ClusterSize_t, EColumnType::kIndex32> : public RColumnElementBase {
 public:
@@ -581,6 +669,20 @@ public:
    void Unpack(void *dst, void *src, std::size_t count) const final;
 };
 
+template <>
+class RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(ClusterSize_t);
+   static constexpr std::size_t kBitsOnStorage = 32;
+   explicit RColumnElement(ClusterSize_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
 template <>
 class RColumnElement<RColumnSwitch, EColumnType::kSwitch> : public RColumnElementBase {
 public:
@@ -679,6 +781,13 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
    case EColumnType::kSplitInt64: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt64>>(nullptr);
    case EColumnType::kSplitInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt32>>(nullptr);
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt16>>(nullptr);
+   case EColumnType::kSplitIndex32: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitIndex32>>(nullptr);
+   case EColumnType::kSplitZigzagInt64:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kSplitZigzagInt64>>(nullptr);
+   case EColumnType::kSplitZigzagInt32:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kSplitZigzagInt32>>(nullptr);
+   case EColumnType::kSplitZigzagInt16:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kSplitZigzagInt16>>(nullptr);
    default: R__ASSERT(false);
    }
    // never here
@@ -62,6 +62,13 @@ enum class EColumnType {
    kSplitInt64,
    kSplitInt32,
    kSplitInt16,
+   // like kIndex32 but pages are stored in delta + split encoding
+   kSplitIndex32,
+   // like kSplitInt64/32/16 but values are zigzag encoded before splitting, such that small negative numbers
+   // have many leading zero bytes
+   kSplitZigzagInt64,
+   kSplitZigzagInt32,
+   kSplitZigzagInt16,
    kMax,
 };
 
@@ -79,7 +86,10 @@ private:
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
-   explicit RColumnModel(EColumnType type) : fType(type), fIsSorted(type == EColumnType::kIndex32) {}
+   explicit RColumnModel(EColumnType type)
+      : fType(type), fIsSorted(type == EColumnType::kIndex32 || type == EColumnType::kSplitIndex32)
+   {
+   }
    RColumnModel(EColumnType type, bool isSorted) : fType(type), fIsSorted(isSorted) {}
 
    EColumnType GetType() const { return fType; }
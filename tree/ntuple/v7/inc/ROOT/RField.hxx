@@ -35,10 +35,15 @@
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 #include <utility>
@@ -446,11 +451,14 @@ public:
 /// `PushProxy()`, `PopProxy()`, `GetFunctionCreateIterators()`, `GetFunctionNext()`, and
 /// `GetFunctionDeleteTwoIterators()`.
 ///
-/// The collection proxy for a given class can be set via `TClass::CopyCollectionProxy()`.
+/// The collection proxy for a given class can be set via `TClass::CopyCollectionProxy()`. Emulated collection proxies,
+/// i.e. of classes without dictionary, are not supported.
 class RCollectionClassField : public Detail::RFieldBase {
-private:
+protected:
    /// Allows for iterating over the elements of a proxied collection. RCollectionIterableOnce avoids an additional
    /// iterator copy (see `TVirtualCollectionProxy::GetFunctionCopyIterator`) and thus can only be iterated once.
+   /// If a stride is given, the elements are known to be stored contiguously (e.g., `std::vector` or the staging
+   /// area used to fill associative collections) and the iterator advances by pointer arithmetic.
    class RCollectionIterableOnce {
    public:
       struct RIteratorFuncs {
@@ -458,12 +466,25 @@ private:
          TVirtualCollectionProxy::DeleteTwoIterators_t fDeleteTwoIterators;
          TVirtualCollectionProxy::Next_t fNext;
       };
-      static RIteratorFuncs GetIteratorFuncs(TVirtualCollectionProxy *proxy, bool readOnly);
+      /// If `readFromDisk` is true, returns the functions used to fill a collection, which for associative
+      /// collections operate on the staging area returned by `TVirtualCollectionProxy::Allocate()`
+      static RIteratorFuncs GetIteratorFuncs(TVirtualCollectionProxy *proxy, bool readFromDisk);
    private:
       class RIterator {
          const RCollectionIterableOnce &fOwner;
          void *fIterator = nullptr;
          void *fElementPtr = nullptr;
+
+         void Advance()
+         {
+            if (fOwner.fStride == 0) {
+               fElementPtr = fOwner.fIFuncs.fNext(&fIterator, &fOwner.fEnd);
+               return;
+            }
+            fElementPtr = (fIterator == fOwner.fEnd) ? nullptr : fIterator;
+            fIterator = static_cast<unsigned char *>(fIterator) + fOwner.fStride;
+         }
+
       public:
          using iterator_category = std::forward_iterator_tag;
          using iterator = RIterator;
@@ -471,13 +492,10 @@ private:
          using pointer = void *;
 
          RIterator(const RCollectionIterableOnce &owner) : fOwner(owner) {}
-         RIterator(const RCollectionIterableOnce &owner, void *iter) : fOwner(owner), fIterator(iter)
-         {
-            fElementPtr = fOwner.fIFuncs.fNext(&fIterator, &fOwner.fEnd);
-         }
+         RIterator(const RCollectionIterableOnce &owner, void *iter) : fOwner(owner), fIterator(iter) { Advance(); }
          iterator operator++()
          {
-            fElementPtr = fOwner.fIFuncs.fNext(&fIterator, &fOwner.fEnd);
+            Advance();
             return *this;
          }
          pointer operator*() const { return fElementPtr; }
@@ -486,13 +504,15 @@ private:
       };
 
       const RIteratorFuncs &fIFuncs;
+      const std::size_t fStride;
       unsigned char fBeginSmallBuf[TVirtualCollectionProxy::fgIteratorArenaSize];
       unsigned char fEndSmallBuf[TVirtualCollectionProxy::fgIteratorArenaSize];
       void *fBegin = &fBeginSmallBuf;
       void *fEnd = &fEndSmallBuf;
    public:
-      RCollectionIterableOnce(void *collection, const RIteratorFuncs &ifuncs, TVirtualCollectionProxy *proxy)
-         : fIFuncs(ifuncs)
+      RCollectionIterableOnce(void *collection, const RIteratorFuncs &ifuncs, TVirtualCollectionProxy *proxy,
+                              std::size_t stride = 0U)
+         : fIFuncs(ifuncs), fStride(stride)
       {
          fIFuncs.fCreateIterators(collection, &fBegin, &fEnd, proxy);
       }
@@ -504,16 +524,20 @@ private:
 
    std::unique_ptr<TVirtualCollectionProxy> fProxy;
    Int_t fProperties;
+   Int_t fCollectionType;
    /// Two sets of functions to operate on iterators, to be used depending on the access type
    RCollectionIterableOnce::RIteratorFuncs fIFuncsRead;
    RCollectionIterableOnce::RIteratorFuncs fIFuncsWrite;
    std::size_t fItemSize;
    ClusterSize_t fNWritten;
 
+   /// Sets up the collection proxy; the item field is attached by the calling constructor
    RCollectionClassField(std::string_view fieldName, std::string_view className, TClass *classp);
+   /// Used by derived fields that construct the item field themselves, e.g. the `std::pair` item of `std::map`
+   RCollectionClassField(std::string_view fieldName, std::string_view className,
+                         std::unique_ptr<Detail::RFieldBase> itemField);
 
-protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const override;
    const RColumnRepresentations &GetColumnRepresentations() const final;
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
@@ -545,6 +569,33 @@ public:
    }
 };
 
+/// The generic field for `std::map<KeyType, ValueType>` and `std::unordered_map<KeyType, ValueType>`. The item
+/// field is an `std::pair<KeyType, ValueType>` record, so that keys and values are stored in separate columns.
+/// The collection proxy of the map type is used to iterate over and to fill the container, so the map type needs a
+/// dictionary: emulated collection proxies are rejected.
+class RMapField : public RCollectionClassField {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+
+public:
+   RMapField(std::string_view fieldName, std::string_view typeName, std::unique_ptr<Detail::RFieldBase> itemField);
+   RMapField(RMapField &&other) = default;
+   RMapField &operator=(RMapField &&other) = default;
+   ~RMapField() override = default;
+};
+
+/// The generic field for `std::set<Type>` and `std::unordered_set<Type>`
+class RSetField : public RCollectionClassField {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+
+public:
+   RSetField(std::string_view fieldName, std::string_view typeName, std::unique_ptr<Detail::RFieldBase> itemField);
+   RSetField(RSetField &&other) = default;
+   RSetField &operator=(RSetField &&other) = default;
+   ~RSetField() override = default;
+};
+
 /// The field for an untyped record. The subfields are stored consequitively in a memory block, i.e.
 /// the memory layout is identical to one that a C++ struct would have
 class RRecordField : public Detail::RFieldBase {
@@ -750,6 +801,92 @@ public:
    void CommitCluster() final;
 };
 
+/// The base class for fields of values that may be absent, i.e. `std::unique_ptr<T>` and `std::optional<T>`.
+/// On disk, such a value is a collection of zero or one items: an offset column and the sub field of the item type.
+class RNullableField : public Detail::RFieldBase {
+private:
+   ClusterSize_t fNWritten;
+
+protected:
+   const RColumnRepresentations &GetColumnRepresentations() const final;
+   void GenerateColumnsImpl() final;
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
+
+   /// Marks the current entry as empty; returns the number of bytes written
+   std::size_t AppendNull();
+   /// Writes the item of the current entry; returns the number of bytes written
+   std::size_t AppendValue(const Detail::RFieldValue &itemValue);
+   /// Given the index of the nullable field, returns the index of the item or an invalid index for an empty entry
+   RClusterIndex GetItemIndex(NTupleSize_t globalIndex);
+
+   RNullableField(std::string_view fieldName, std::string_view typeName, std::unique_ptr<Detail::RFieldBase> itemField);
+
+public:
+   RNullableField(RNullableField &&other) = default;
+   RNullableField &operator=(RNullableField &&other) = default;
+   ~RNullableField() override = default;
+
+   void CommitCluster() final;
+   void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+   void GetCollectionInfo(NTupleSize_t globalIndex, RClusterIndex *collectionStart, ClusterSize_t *size) const
+   {
+      fPrincipalColumn->GetCollectionInfo(globalIndex, collectionStart, size);
+   }
+   void GetCollectionInfo(const RClusterIndex &clusterIndex, RClusterIndex *collectionStart, ClusterSize_t *size) const
+   {
+      fPrincipalColumn->GetCollectionInfo(clusterIndex, collectionStart, size);
+   }
+};
+
+/// The generic field for `std::unique_ptr<T>`. Items read from disk are allocated with `operator new` so that they
+/// can be released by the default deleter.
+class RUniquePtrField : public RNullableField {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   std::size_t AppendImpl(const Detail::RFieldValue &value) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
+
+public:
+   RUniquePtrField(std::string_view fieldName, std::string_view typeName, std::unique_ptr<Detail::RFieldBase> itemField);
+   RUniquePtrField(RUniquePtrField &&other) = default;
+   RUniquePtrField &operator=(RUniquePtrField &&other) = default;
+   ~RUniquePtrField() override = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   Detail::RFieldValue GenerateValue(void *where) override;
+   void DestroyValue(const Detail::RFieldValue &value, bool dtorOnly = false) final;
+   Detail::RFieldValue CaptureValue(void *where) final;
+   std::vector<Detail::RFieldValue> SplitValue(const Detail::RFieldValue &value) const final;
+   size_t GetValueSize() const final { return sizeof(std::unique_ptr<char>); }
+   size_t GetAlignment() const final { return alignof(std::unique_ptr<char>); }
+};
+
+/// The generic field for `std::optional<T>`. The type-erased access assumes the layout used by the common standard
+/// library implementations, i.e. the item followed by the engagement flag.
+class ROptionalField : public RNullableField {
+private:
+   bool *GetEngagementPtr(void *optionalPtr) const;
+
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   std::size_t AppendImpl(const Detail::RFieldValue &value) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
+
+public:
+   ROptionalField(std::string_view fieldName, std::string_view typeName, std::unique_ptr<Detail::RFieldBase> itemField);
+   ROptionalField(ROptionalField &&other) = default;
+   ROptionalField &operator=(ROptionalField &&other) = default;
+   ~ROptionalField() override = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   Detail::RFieldValue GenerateValue(void *where) override;
+   void DestroyValue(const Detail::RFieldValue &value, bool dtorOnly = false) final;
+   Detail::RFieldValue CaptureValue(void *where) final;
+   std::vector<Detail::RFieldValue> SplitValue(const Detail::RFieldValue &value) const final;
+   size_t GetValueSize() const final;
+   size_t GetAlignment() const final { return fSubFields[0]->GetAlignment(); }
+};
+
 
 /// Classes with dictionaries that can be inspected by TClass
 template <typename T, typename=void>
@@ -2099,6 +2236,146 @@ public:
    }
 };
 
+template <typename KeyT, typename ValueT>
+class RField<std::map<KeyT, ValueT>> : public RMapField {
+   using ContainerT = typename std::map<KeyT, ValueT>;
+
+public:
+   static std::string TypeName()
+   {
+      return "std::map<" + RField<KeyT>::TypeName() + "," + RField<ValueT>::TypeName() + ">";
+   }
+   explicit RField(std::string_view name)
+      : RMapField(name, TypeName(), std::make_unique<RField<std::pair<KeyT, ValueT>>>("_0"))
+   {
+   }
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() override = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&...args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+   size_t GetValueSize() const final { return sizeof(ContainerT); }
+};
+
+template <typename KeyT, typename ValueT>
+class RField<std::unordered_map<KeyT, ValueT>> : public RMapField {
+   using ContainerT = typename std::unordered_map<KeyT, ValueT>;
+
+public:
+   static std::string TypeName()
+   {
+      return "std::unordered_map<" + RField<KeyT>::TypeName() + "," + RField<ValueT>::TypeName() + ">";
+   }
+   explicit RField(std::string_view name)
+      : RMapField(name, TypeName(), std::make_unique<RField<std::pair<KeyT, ValueT>>>("_0"))
+   {
+   }
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() override = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&...args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+   size_t GetValueSize() const final { return sizeof(ContainerT); }
+};
+
+template <typename ItemT>
+class RField<std::set<ItemT>> : public RSetField {
+   using ContainerT = typename std::set<ItemT>;
+
+public:
+   static std::string TypeName() { return "std::set<" + RField<ItemT>::TypeName() + ">"; }
+   explicit RField(std::string_view name) : RSetField(name, TypeName(), std::make_unique<RField<ItemT>>("_0")) {}
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() override = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&...args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+   size_t GetValueSize() const final { return sizeof(ContainerT); }
+};
+
+template <typename ItemT>
+class RField<std::unordered_set<ItemT>> : public RSetField {
+   using ContainerT = typename std::unordered_set<ItemT>;
+
+public:
+   static std::string TypeName() { return "std::unordered_set<" + RField<ItemT>::TypeName() + ">"; }
+   explicit RField(std::string_view name) : RSetField(name, TypeName(), std::make_unique<RField<ItemT>>("_0")) {}
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() override = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&...args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+   size_t GetValueSize() const final { return sizeof(ContainerT); }
+};
+
+template <typename ItemT>
+class RField<std::unique_ptr<ItemT>> : public RUniquePtrField {
+   using ContainerT = typename std::unique_ptr<ItemT>;
+
+public:
+   static std::string TypeName() { return "std::unique_ptr<" + RField<ItemT>::TypeName() + ">"; }
+   explicit RField(std::string_view name) : RUniquePtrField(name, TypeName(), std::make_unique<RField<ItemT>>("_0"))
+   {
+   }
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() override = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&...args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+};
+
+template <typename ItemT>
+class RField<std::optional<ItemT>> : public ROptionalField {
+   using ContainerT = typename std::optional<ItemT>;
+
+public:
+   static std::string TypeName() { return "std::optional<" + RField<ItemT>::TypeName() + ">"; }
+   explicit RField(std::string_view name) : ROptionalField(name, TypeName(), std::make_unique<RField<ItemT>>("_0"))
+   {
+   }
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() override = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&...args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
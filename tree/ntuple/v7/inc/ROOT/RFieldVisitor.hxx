@@ -67,6 +67,7 @@ public:
    virtual void VisitVectorField(const RVectorField &field) { VisitField(field); }
    virtual void VisitVectorBoolField(const RField<std::vector<bool>> &field) { VisitField(field); }
    virtual void VisitRVecField(const RRVecField &field) { VisitField(field); }
+   virtual void VisitNullableField(const RNullableField &field) { VisitField(field); }
 }; // class RFieldVisitor
 
 } // namespace Detail
@@ -216,6 +217,7 @@ public:
    void VisitVectorField(const RVectorField &field) final;
    void VisitVectorBoolField(const RField<std::vector<bool>> &field) final;
    void VisitRVecField(const RRVecField &field) final;
+   void VisitNullableField(const RNullableField &field) final;
 };
 
 
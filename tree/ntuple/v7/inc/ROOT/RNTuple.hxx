@@ -32,8 +32,10 @@
 
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -285,6 +287,12 @@ public:
    /// ~~~
    RNTupleGlobalRange GetEntryRange() { return RNTupleGlobalRange(0, GetNEntries()); }
 
+   /// Returns the entry ranges that may contain entries whose value of the given field is in the closed interval
+   /// [min, max]. Clusters are skipped based on the optional page statistics, see RPageSource::CanSkipCluster().
+   /// Without statistics, the full entry range is returned. Adjacent clusters are merged into a single range.
+   /// The entries in the returned ranges still need to be checked individually.
+   std::vector<RNTupleGlobalRange> GetEntryRanges(std::string_view fieldName, double min, double max);
+
    /// Provides access to an individual field that can contain either a scalar value or a collection, e.g.
    /// GetView<double>("particles.pt") or GetView<std::vector<double>>("particle").  It can as well be the index
    /// field of a collection itself, like GetView<NTupleSize_t>("particle").
@@ -355,17 +363,20 @@ public:
 
 // clang-format off
 /**
-\class ROOT::Experimental::RNTupleWriter
+\class ROOT::Experimental::RNTupleFillContext
 \ingroup NTuple
-\brief An RNTuple that gets filled with entries (data) and writes them to storage
+\brief A context for filling entries (data) into clusters of an RNTuple
 
-An output ntuple can be filled with entries. The caller has to make sure that the data that gets filled into an ntuple
-is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
-writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
-triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+A fill context holds its own copy of the model and the column page buffers.  It decides when to commit a cluster
+and commits it to the underlying page sink.  The RNTupleWriter uses a single fill context.  The RNTupleParallelWriter
+hands out one fill context per filling thread; the contexts commit their clusters to the shared page sink one at
+a time.  A fill context must not be used concurrently by multiple threads.
 */
 // clang-format on
-class RNTupleWriter {
+class RNTupleFillContext {
+   friend class RNTupleWriter;
+   friend class RNTupleParallelWriter;
+
 private:
    /// The page sink's parallel page compression scheduler if IMT is on.
    /// Needs to be destructed after the page sink is destructed and so declared before.
@@ -373,9 +384,7 @@ private:
    std::unique_ptr<Detail::RPageSink> fSink;
    /// Needs to be destructed before fSink
    std::unique_ptr<RNTupleModel> fModel;
-   Detail::RNTupleMetrics fMetrics;
    NTupleSize_t fLastCommitted = 0;
-   NTupleSize_t fLastCommittedClusterGroup = 0;
    NTupleSize_t fNEntries = 0;
    /// Keeps track of the number of bytes written into the current cluster
    std::size_t fUnzippedClusterSize = 0;
@@ -389,6 +398,64 @@ private:
    /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
    NTupleSize_t fUnzippedClusterSizeEst;
 
+   /// Throws an exception if the model or the sink is null.
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   /// Commits the entries filled since the last cluster
+   ~RNTupleFillContext();
+
+   /// The simplest user interface if the default entry that comes with the ntuple model is used.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill() { return Fill(*fModel->GetDefaultEntry()); }
+   /// Multiple entries can have been instantiated from the ntuple model.  This method will perform
+   /// a light check whether the entry comes from the ntuple's own model.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      std::size_t bytesWritten = 0;
+      for (auto &value : entry) {
+         bytesWritten += value.GetField()->Append(value);
+      }
+      fUnzippedClusterSize += bytesWritten;
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+      return bytesWritten;
+   }
+   /// Ensure that the data from the so far seen Fill calls has been written to storage
+   void CommitCluster();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+
+   /// Returns the number of entries filled into this context
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleWriter
+\ingroup NTuple
+\brief An RNTuple that gets filled with entries (data) and writes them to storage
+
+An output ntuple can be filled with entries. The caller has to make sure that the data that gets filled into an ntuple
+is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
+writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
+triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+*/
+// clang-format on
+class RNTupleWriter {
+private:
+   RNTupleFillContext fFillContext;
+   Detail::RNTupleMetrics fMetrics;
+   NTupleSize_t fLastCommittedClusterGroup = 0;
+
    // Helper function that is called from CommitCluster() when necessary
    void CommitClusterGroup();
 
@@ -411,28 +478,75 @@ public:
 
    /// The simplest user interface if the default entry that comes with the ntuple model is used.
    /// \return The number of uncompressed bytes written.
-   std::size_t Fill() { return Fill(*fModel->GetDefaultEntry()); }
+   std::size_t Fill() { return fFillContext.Fill(); }
    /// Multiple entries can have been instantiated from the ntuple model.  This method will perform
    /// a light check whether the entry comes from the ntuple's own model.
    /// \return The number of uncompressed bytes written.
-   std::size_t Fill(REntry &entry) {
-      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
-         throw RException(R__FAIL("mismatch between entry and model"));
-
-      std::size_t bytesWritten = 0;
-      for (auto& value : entry) {
-         bytesWritten += value.GetField()->Append(value);
-      }
-      fUnzippedClusterSize += bytesWritten;
-      fNEntries++;
-      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
-         CommitCluster();
-      return bytesWritten;
-   }
+   std::size_t Fill(REntry &entry) { return fFillContext.Fill(entry); }
    /// Ensure that the data from the so far seen Fill calls has been written to storage
    void CommitCluster(bool commitClusterGroup = false);
 
-   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   std::unique_ptr<REntry> CreateEntry() { return fFillContext.CreateEntry(); }
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fFillContext.GetModel(); }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that is filled concurrently by several threads, each using its own RNTupleFillContext
+
+Every filling thread obtains a fill context by CreateFillContext().  The contexts buffer and compress pages
+independently: with IMT, in tasks scheduled while filling, otherwise in the filling thread when a page is full.
+When a context commits a cluster, it appends the already compressed pages to the single shared page sink under a
+short critical section.  Consequently, the order of the clusters in the written ntuple depends on the timing of
+the threads; the entries of a single cluster stem from one context in the order they were filled.
+
+All fill contexts must be destructed before the parallel writer.
+~~~ {.cpp}
+auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", "data.root");
+// in every thread
+auto fillContext = writer->CreateFillContext();
+auto entry = fillContext->CreateEntry();
+// set values of entry
+fillContext->Fill(*entry);
+~~~
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   /// Serializes the commit of clusters by the fill contexts and the creation of new fill contexts
+   std::mutex fMutex;
+   /// The shared page sink, writing to storage
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The model used to create the shared page sink; the fill contexts use clones of it
+   std::unique_ptr<RNTupleModel> fModel;
+   Detail::RNTupleMetrics fMetrics;
+   /// The number of entries committed to fSink, protected by fMutex
+   NTupleSize_t fNEntries = 0;
+   std::vector<std::weak_ptr<RNTupleFillContext>> fFillContexts;
+
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   /// Throws an exception if the model is null.
+   static std::unique_ptr<RNTupleParallelWriter>
+   Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName, std::string_view storage,
+            const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model is null.
+   static std::unique_ptr<RNTupleParallelWriter> Append(std::unique_ptr<RNTupleModel> model,
+                                                        std::string_view ntupleName, TFile &file,
+                                                        const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Creates a new fill context for use by a single thread.  This method is thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext();
 
    void EnableMetrics() { fMetrics.Enable(); }
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
@@ -25,8 +25,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -185,6 +188,52 @@ public:
    bool HasAllColumns() const { return fPhysicalColumnIds.empty(); }
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RColumnStatistics
+\ingroup NTuple
+\brief Optional summary of the values stored in a page or in a column range of a cluster
+
+The minimum and the maximum are stored as doubles. For 64bit integer columns, the conversion is rounded outwards,
+so that the statistics are always a conservative envelope of the stored values. For offset (index) columns, the
+statistics refer to the collection sizes and fNEmpty counts the empty collections. Statistics are only recorded
+if enabled in the write options; an invalid (default constructed) object means that no statistics are available.
+*/
+// clang-format on
+struct RColumnStatistics {
+   double fMin = std::numeric_limits<double>::infinity();
+   double fMax = -std::numeric_limits<double>::infinity();
+   /// For offset columns, the number of empty collections
+   std::uint64_t fNEmpty = 0;
+
+   /// Returns false if there are no statistics or if the statistics were computed over zero elements
+   bool IsValid() const { return fMin <= fMax; }
+   void Update(double value)
+   {
+      // NaNs compare false with everything and thus are never used to narrow the envelope
+      if (value < fMin)
+         fMin = value;
+      if (value > fMax)
+         fMax = value;
+   }
+   void Merge(const RColumnStatistics &other)
+   {
+      fMin = std::min(fMin, other.fMin);
+      fMax = std::max(fMax, other.fMax);
+      fNEmpty += other.fNEmpty;
+   }
+   /// Returns true if it is certain that none of the summarized values is in the closed interval [min, max].
+   /// Without valid statistics, nothing is certain and the method returns false.
+   bool IsDisjoint(double min, double max) const { return IsValid() && (fMax < min || fMin > max); }
+
+   bool operator==(const RColumnStatistics &other) const
+   {
+      if (!IsValid() || !other.IsValid())
+         return IsValid() == other.IsValid();
+      return fMin == other.fMin && fMax == other.fMax && fNEmpty == other.fNEmpty;
+   }
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RClusterDescriptor
@@ -212,13 +261,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The merged statistics of the pages of the column range; only valid if all the pages have statistics
+      RColumnStatistics fStatistics;
 
       bool operator==(const RColumnRange &other) const {
          return fPhysicalColumnId == other.fPhysicalColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fStatistics == other.fStatistics;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -235,9 +284,11 @@ public:
          std::uint32_t fNElements = std::uint32_t(-1);
          /// The meaning of fLocator depends on the storage backend.
          RNTupleLocator fLocator;
+         /// Optional min/max summary of the page elements
+         RColumnStatistics fStatistics;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fStatistics == other.fStatistics;
          }
       };
       struct RPageInfoExtended : RPageInfo {
@@ -18,11 +18,22 @@
 
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
+
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
 
+namespace Detail {
+class RPageSink;
+class RPageSource;
+} // namespace Detail
+
 // clang-format off
 /**
 \class ROOT::Experimental::RFieldMerger
@@ -38,6 +49,70 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates the entries of several ntuples with the same schema into a single page sink
+
+The merger works on the level of sealed pages.  If the compression settings of an input cluster match the
+compression of the destination, its pages are copied byte-for-byte; otherwise they are decompressed and compressed
+again with the destination settings, but never unpacked.  With implicit multi-threading enabled, the inputs are
+attached and their clusters read as tasks of the thread pool, up to `nThreads` clusters ahead of the calling thread,
+which appends the clusters to the destination in input order; otherwise the calling thread does all the work.  Each
+input ntuple results in one cluster group in the output.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   /// A column of the output, identified by the qualified name of its field and its index within the field
+   struct RColumnInfo {
+      std::string fColumnName;
+      EColumnType fType = EColumnType::kUnknown;
+      DescriptorId_t fOutputId = kInvalidDescriptorId;
+   };
+   struct RSourceState;
+   struct RClusterTask;
+
+   struct RCounters {
+      Detail::RNTupleAtomicCounter &fNSources;
+      Detail::RNTupleAtomicCounter &fNClusters;
+      Detail::RNTupleAtomicCounter &fNPageCopied;
+      Detail::RNTupleAtomicCounter &fNPageResealed;
+      Detail::RNTupleAtomicCounter &fSzRead;
+      Detail::RNTupleAtomicCounter &fSzWritten;
+      Detail::RNTupleAtomicCounter &fTimeWallRead;
+      Detail::RNTupleAtomicCounter &fTimeWallWrite;
+      Detail::RNTupleAtomicCounter &fTimeWallMerge;
+   };
+
+   unsigned int fNThreads;
+   /// The output columns in the order of their physical column id in the destination
+   std::vector<RColumnInfo> fOutputColumns;
+   Detail::RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+
+   /// Returns, for every output column, the physical column id of the same column in the source. Throws if the schema
+   /// of the source does not match the schema of the output.
+   std::vector<DescriptorId_t> MapColumns(const RNTupleDescriptor &desc) const;
+   /// Loads the pages of the given cluster of the source and, if necessary, recompresses them
+   std::unique_ptr<RClusterTask> ReadCluster(RSourceState &source, DescriptorId_t clusterId, int outputCompression);
+
+public:
+   /// `nThreads` is the number of clusters read concurrently if implicit multi-threading is enabled; zero stands
+   /// for the size of the thread pool.  Without implicit multi-threading, the merge is sequential.
+   explicit RNTupleMerger(unsigned int nThreads = 0);
+   RNTupleMerger(const RNTupleMerger &other) = delete;
+   RNTupleMerger &operator=(const RNTupleMerger &other) = delete;
+   ~RNTupleMerger();
+
+   /// Attaches the unattached `sources`, creates the destination from the schema of the first source and appends all
+   /// the clusters of all the sources in order.  Throws an RException if the sources have different schemas.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+
+   Detail::RNTupleMetrics &GetMetrics() { return fMetrics; }
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -61,6 +61,9 @@ protected:
    /// fApproxUnzippedPageSize/2 and fApproxUnzippedPageSize * 1.5 in size.
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
    bool fUseBufferedWrite = true;
+   /// If set, the min/max of the values of every page are recorded in the page list and aggregated per cluster.
+   /// Readers can use the statistics to skip clusters that cannot pass a range filter.
+   bool fEnablePageStatistics = false;
 
 public:
    virtual ~RNTupleWriteOptions() = default;
@@ -86,6 +89,9 @@ public:
 
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+   bool GetEnablePageStatistics() const { return fEnablePageStatistics; }
+   void SetEnablePageStatistics(bool val) { fEnablePageStatistics = val; }
 };
 
 // clang-format off
@@ -140,12 +146,31 @@ public:
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// If set, the cluster pool tunes the cluster bunch size at run time, starting from fClusterBunchSize, such that
+   /// neither the reader nor the I/O pipeline stalls
+   bool fUseAdaptiveClusterBunchSize = false;
+   /// Upper limit for the adaptive cluster bunch size
+   unsigned int fMaxClusterBunchSize = 16;
+   /// Upper limit for the packed and compressed bytes of the clusters held in the pool and in flight, used
+   /// by the adaptive cluster bunch size
+   std::size_t fClusterPoolMemoryBudget = 1024 * 1024 * 1024;
+   /// If set and supported by the storage backend (e.g., local files), the ntuple data is memory mapped instead of
+   /// read into heap buffers.  Uncompressed pages of mappable columns are then served directly from the mapping.
+   bool fUseMmap = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   bool GetUseAdaptiveClusterBunchSize() const { return fUseAdaptiveClusterBunchSize; }
+   void SetUseAdaptiveClusterBunchSize(bool val) { fUseAdaptiveClusterBunchSize = val; }
+   unsigned int GetMaxClusterBunchSize() const { return fMaxClusterBunchSize; }
+   void SetMaxClusterBunchSize(unsigned int val) { fMaxClusterBunchSize = val; }
+   std::size_t GetClusterPoolMemoryBudget() const { return fClusterPoolMemoryBudget; }
+   void SetClusterPoolMemoryBudget(std::size_t val) { fClusterPoolMemoryBudget = val; }
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
 };
 
 } // namespace Experimental
@@ -18,8 +18,10 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -135,6 +137,8 @@ accessed by index. For top-level fields, the index refers to the entry number. F
 nested collections have global index numbers that are derived from their parent indexes.
 
 Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+For columnar processing, MapSpan() exposes the remainder of a page as a span and ReadBulk() copies a range of
+elements, possibly spanning several pages, into a caller-provided buffer.
 */
 // clang-format on
 template <typename T>
@@ -209,6 +213,47 @@ public:
    {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Zero-copy access to the elements from `globalIndex` up to the end of the page that contains `globalIndex`.
+   /// The span remains valid until the view maps or reads from another page.
+   template <typename C = T, std::enable_if_t<Internal::isMappable<FieldT>, C *> = nullptr>
+   std::span<const C> MapSpan(NTupleSize_t globalIndex)
+   {
+      NTupleSize_t nItems = 0;
+      const C *items = fField.MapV(globalIndex, nItems);
+      return std::span<const C>(items, nItems);
+   }
+
+   template <typename C = T, std::enable_if_t<Internal::isMappable<FieldT>, C *> = nullptr>
+   std::span<const C> MapSpan(const RClusterIndex &clusterIndex)
+   {
+      NTupleSize_t nItems = 0;
+      const C *items = fField.MapV(clusterIndex, nItems);
+      return std::span<const C>(items, nItems);
+   }
+
+   /// Copies the `count` elements starting at `globalIndex` into `buffer`, which must hold at least `count` objects.
+   /// Mappable fields are copied page-wise from the mapped pages. Other fields are deserialized into the existing
+   /// objects in `buffer`, which therefore need to be constructed.
+   void ReadBulk(NTupleSize_t globalIndex, NTupleSize_t count, T *buffer)
+   {
+      if constexpr (Internal::isMappable<FieldT>) {
+         while (count > 0) {
+            NTupleSize_t nItems = 0;
+            const T *items = fField.MapV(globalIndex, nItems);
+            nItems = std::min(nItems, count);
+            std::copy(items, items + nItems, buffer);
+            globalIndex += nItems;
+            buffer += nItems;
+            count -= nItems;
+         }
+      } else {
+         for (NTupleSize_t i = 0; i < count; ++i) {
+            auto value = fField.CaptureValue(&buffer[i]);
+            fField.Read(globalIndex + i, &value);
+         }
+      }
+   }
 };
 
 
@@ -35,6 +35,10 @@ namespace Detail {
 \ingroup NTuple
 \brief Wrapper sink that coalesces cluster column page writes
 *
+* If a task scheduler is set (e.g., by the RNTupleWriter if IMT is enabled), committed pages are sealed concurrently
+* by tasks that run in ROOT's task arena while the filling thread continues. The sealed pages are written
+* in commit order once the cluster is committed.
+*
 * TODO(jblomer): The interplay of derived class and RPageSink is not yet optimally designed for page storage wrapper
 * classes like this one. Header and footer serialization, e.g., are done twice.  To be revised.
 */
@@ -31,6 +31,7 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_set>
 #include <vector>
@@ -87,6 +88,8 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// Optional min/max summary of the page elements, passed on to the page list on commit
+      RColumnStatistics fStatistics;
 
       RSealedPage() = default;
       RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
@@ -200,6 +203,9 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// For offset columns with page statistics: the last offset committed in the currently open cluster.
+   /// Indexed by column id.
+   std::vector<std::uint64_t> fOpenPrevOffsets;
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
    virtual void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) = 0;
@@ -284,6 +290,12 @@ public:
    /// the page sink picks an appropriate size.
    virtual RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) = 0;
 
+   /// Sinks that are shared by several writers (see RNTupleParallelWriter) require that the pages of a cluster and
+   /// the cluster itself are committed while holding the returned lock.  By default, no lock is taken.
+   virtual std::unique_lock<std::mutex> GetSinkGuard() { return std::unique_lock<std::mutex>(); }
+   /// Whether GetSinkGuard() returns a lock.  Buffering sinks then compress pages before taking the lock.
+   virtual bool IsShared() const { return false; }
+
    /// Returns the default metrics object.  Subclasses might alternatively provide their own metrics object by overriding this.
    RNTupleMetrics &GetMetrics() override { return fMetrics; };
 };
@@ -454,6 +466,13 @@ public:
    NTupleSize_t GetNElements(ColumnHandle_t columnHandle);
    ColumnId_t GetColumnId(ColumnHandle_t columnHandle);
 
+   /// Uses the optional page statistics (see RNTupleWriteOptions::SetEnablePageStatistics()) of the principal column
+   /// of the given field to decide whether no entry of the given cluster has a value in the closed interval
+   /// [min, max]. For collection fields (including strings), the collection sizes are compared. Only fields that are
+   /// not part of a collection or a variant, i.e. fields with exactly one value per entry, can be used for skipping.
+   /// Returns false if there are no statistics.
+   bool CanSkipCluster(DescriptorId_t clusterId, DescriptorId_t fieldId, double min, double max);
+
    /// Allocates and fills a page that contains the index-th element
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
    /// Another version of PopulatePage that allows to specify cluster-relative indexes
@@ -476,6 +495,14 @@ public:
    /// concurrently to other methods of the page source.
    virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) = 0;
 
+   /// Receives the index of the cluster in the list of requested keys and the loaded cluster
+   using ClusterCallback_t = std::function<void(std::size_t, std::unique_ptr<RCluster>)>;
+   /// Like LoadClusters() but hands over every cluster to the callback as soon as its pages are read, so that
+   /// the caller can start working on the first clusters while the remaining ones are still in flight.  The callback
+   /// is invoked exactly once per cluster key, not necessarily in the order of the keys.  The default
+   /// implementation calls LoadClusters() and passes on the clusters in order.
+   virtual void LoadClustersIncrementally(std::span<RCluster::RKey> clusterKeys, const ClusterCallback_t &callback);
+
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
    /// unzip thread. It is an optional optimization, the method can safely do nothing. In particular, the
@@ -128,6 +128,19 @@ private:
       std::uint64_t fColumnOffset = 0;
    };
 
+   /// Memory mapping of the entire file, used if requested by the read options and supported by the raw file.
+   /// Owned jointly by the page source and by the zero-copy pages that point into the mapping.
+   struct RMappedFile {
+      std::shared_ptr<ROOT::Internal::RRawFile> fFile;
+      unsigned char *fBase = nullptr;
+      std::size_t fSize = 0;
+
+      RMappedFile(std::shared_ptr<ROOT::Internal::RRawFile> file);
+      RMappedFile(const RMappedFile &other) = delete;
+      RMappedFile &operator=(const RMappedFile &other) = delete;
+      ~RMappedFile();
+   };
+
    /// Populated pages might be shared; there memory buffer is managed by the RPageAllocatorFile
    std::unique_ptr<RPageAllocatorFile> fPageAllocator;
    /// The page pool might, at some point, be used by multiple page sources
@@ -135,9 +148,11 @@ private:
    /// The last cluster from which a page got populated.  Points into fClusterPool->fPool
    RCluster *fCurrentCluster = nullptr;
    /// An RRawFile is used to request the necessary byte ranges from a local or a remote file
-   std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+   std::shared_ptr<ROOT::Internal::RRawFile> fFile;
    /// Takes the fFile to read ntuple blobs from it
    Internal::RMiniFileReader fReader;
+   /// Set on attaching if RNTupleReadOptions::GetUseMmap() is true and fFile supports memory mapping
+   std::shared_ptr<RMappedFile> fMappedFile;
    /// The descriptor is created from the header and footer either in AttachImpl or in CreateFromAnchor
    RNTupleDescriptorBuilder fDescriptorBuilder;
    /// The cluster pool asynchronously preloads the next few clusters
@@ -156,7 +171,8 @@ private:
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
    /// the provided vector.  This way, requests can be collected for multiple clusters before
-   /// sending them to RRawFile::ReadV().
+   /// sending them to RRawFile::ReadV().  If the file is memory mapped, no read requests are added and
+   /// the page map points into the mapping.
    std::unique_ptr<RCluster> PrepareSingleCluster(
       const RCluster::RKey &clusterKey,
       std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests);
@@ -185,6 +201,9 @@ public:
    LoadSealedPage(DescriptorId_t physicalColumnId, const RClusterIndex &clusterIndex, RSealedPage &sealedPage) final;
 
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final;
+   /// Uses the asynchronous read interface of the raw file, if available, so that clusters are handed over
+   /// as soon as all their read requests completed
+   void LoadClustersIncrementally(std::span<RCluster::RKey> clusterKeys, const ClusterCallback_t &callback) final;
 };
 
 
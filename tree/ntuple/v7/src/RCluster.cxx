@@ -70,3 +70,11 @@ void ROOT::Experimental::Detail::RCluster::SetColumnAvailable(DescriptorId_t phy
 {
    fAvailPhysicalColumns.insert(physicalColumnId);
 }
+
+std::size_t ROOT::Experimental::Detail::RCluster::GetOnDiskPagesSize() const
+{
+   std::size_t size = 0;
+   for (const auto &kv : fOnDiskPages)
+      size += kv.second.GetSize();
+   return size;
+}
@@ -51,13 +51,43 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
 ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
    : fPageSource(pageSource)
    , fClusterBunchSize(clusterBunchSize)
+   , fMaxClusterBunchSize(clusterBunchSize)
    , fPool(2 * clusterBunchSize)
+   , fMetrics("RClusterPool")
+   , fCounters(std::unique_ptr<RCounters>(new RCounters{
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nClusterBunchSize", "", "current number of clusters per bunch"),
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nClusterLoaded", "",
+                                                      "number of clusters loaded by the I/O thread"),
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("szLoaded", "B", "volume of the loaded packed pages"),
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallLoad", "ns", "wall clock time spent loading clusters"),
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallUnzip", "ns",
+                                                      "wall clock time spent unzipping clusters"),
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nStall", "", "number of times the reader waited for a cluster"),
+        *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallStall", "ns",
+                                                      "wall clock time the reader waited for clusters")}))
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
    R__ASSERT(clusterBunchSize > 0);
 }
 
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, const RNTupleReadOptions &options)
+   : RClusterPool(pageSource,
+                  options.GetUseAdaptiveClusterBunchSize()
+                     ? std::max(options.GetClusterBunchSize(), options.GetMaxClusterBunchSize())
+                     : options.GetClusterBunchSize())
+{
+   if (!options.GetUseAdaptiveClusterBunchSize())
+      return;
+
+   // The pool has been sized for the maximum bunch size; start with the configured one
+   fIsAdaptive = true;
+   fClusterBunchSize = std::max(1u, std::min(options.GetClusterBunchSize(), fMaxClusterBunchSize));
+   fMemoryBudget = options.GetClusterPoolMemoryBudget();
+   fMetrics.Enable();
+   fCounters->fNClusterBunchSize.SetValue(fClusterBunchSize);
+}
+
 ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
 {
    {
@@ -95,7 +125,10 @@ void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
          if (!item.fCluster)
             return;
 
+         auto tStart = std::chrono::steady_clock::now();
          fPageSource.UnzipCluster(item.fCluster.get());
+         fCounters->fTimeWallUnzip.Add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tStart).count());
 
          // Afterwards the GetCluster() method in the main thread can pick-up the cluster
          item.fPromise.set_value(std::move(item.fCluster));
@@ -131,32 +164,37 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
             clusterKeys.emplace_back(item.fClusterKey);
          }
 
-         auto clusters = fPageSource.LoadClusters(clusterKeys);
-         bool unzipQueueDirty = false;
-         for (std::size_t i = 0; i < clusters.size(); ++i) {
+         // Clusters are handed over to the unzip thread one by one as soon as their pages arrived, so that
+         // decompression of the first clusters of the bunch overlaps with reading the remaining ones
+         auto tStart = std::chrono::steady_clock::now();
+         fPageSource.LoadClustersIncrementally(clusterKeys, [&](std::size_t idx, std::unique_ptr<RCluster> cluster) {
+            fCounters->fNClusterLoaded.Inc();
+            fCounters->fSzLoaded.Add(cluster->GetOnDiskPagesSize());
             // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
             // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
             bool discard;
             {
                std::unique_lock<std::mutex> lock(fLockWorkQueue);
                discard = std::any_of(fInFlightClusters.begin(), fInFlightClusters.end(),
-                                     [thisClusterId = clusters[i]->GetId()](auto &inFlight) {
+                                     [thisClusterId = cluster->GetId()](auto &inFlight) {
                                         return inFlight.fClusterKey.fClusterId == thisClusterId && inFlight.fIsExpired;
                                      });
             }
             if (discard) {
-               clusters[i].reset();
-               readItems[i].fPromise.set_value(std::move(clusters[i]));
+               cluster.reset();
+               readItems[idx].fPromise.set_value(std::move(cluster));
             } else {
                // Hand-over the loaded cluster pages to the unzip thread
-               std::unique_lock<std::mutex> lock(fLockUnzipQueue);
-               fUnzipQueue.emplace_back(RUnzipItem{std::move(clusters[i]), std::move(readItems[i].fPromise)});
-               unzipQueueDirty = true;
+               {
+                  std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+                  fUnzipQueue.emplace_back(RUnzipItem{std::move(cluster), std::move(readItems[idx].fPromise)});
+               }
+               fCvHasUnzipWork.notify_one();
             }
-         }
-         readItems.erase(readItems.begin(), readItems.begin() + clusters.size());
-         if (unzipQueueDirty)
-            fCvHasUnzipWork.notify_one();
+         });
+         fCounters->fTimeWallLoad.Add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tStart).count());
+         readItems.erase(readItems.begin(), readItems.begin() + clusterKeys.size());
       }
    } // while (true)
 }
@@ -238,10 +276,62 @@ public:
 
 } // anonymous namespace
 
+void ROOT::Experimental::Detail::RClusterPool::AdaptClusterBunchSize(DescriptorId_t clusterId)
+{
+   if (!fIsAdaptive || clusterId == fLastClusterId)
+      return;
+   fLastClusterId = clusterId;
+
+   const auto now = std::chrono::steady_clock::now();
+   auto fnStartWindow = [&]() {
+      fWindow.fStart = now;
+      fWindow.fNClusterLoaded = fCounters->fNClusterLoaded.GetValue();
+      fWindow.fTimeWallLoad = fCounters->fTimeWallLoad.GetValue();
+      fWindow.fTimeWallUnzip = fCounters->fTimeWallUnzip.GetValue();
+      fWindow.fTimeWallStall = fCounters->fTimeWallStall.GetValue();
+      fWindow.fNClustersConsumed = 1;
+   };
+   if (fWindow.fNClustersConsumed == 0) {
+      fnStartWindow();
+      return;
+   }
+   // A window spans the consumption of a full bunch of clusters
+   if (fWindow.fNClustersConsumed++ < fClusterBunchSize)
+      return;
+
+   const auto timeWindow = std::chrono::duration_cast<std::chrono::nanoseconds>(now - fWindow.fStart).count();
+   const auto timeStall = fCounters->fTimeWallStall.GetValue() - fWindow.fTimeWallStall;
+   const auto nLoaded = fCounters->fNClusterLoaded.GetValue() - fWindow.fNClusterLoaded;
+   // The load and unzip steps run concurrently; the slower one determines the pipeline throughput
+   const auto timePipeline = std::max(fCounters->fTimeWallLoad.GetValue() - fWindow.fTimeWallLoad,
+                                      fCounters->fTimeWallUnzip.GetValue() - fWindow.fTimeWallUnzip);
+   const auto timeReader = timeWindow - timeStall;
+
+   auto bunchSize = fClusterBunchSize;
+   if (timeStall > kStallThreshold * timeWindow) {
+      bunchSize = 2 * fClusterBunchSize;
+   } else if ((timeStall == 0) && (nLoaded > 0) && (timePipeline < kIdleThreshold * timeReader)) {
+      bunchSize = fClusterBunchSize - 1;
+   }
+
+   const auto nTotalLoaded = fCounters->fNClusterLoaded.GetValue();
+   if (nTotalLoaded > 0) {
+      const auto szAvgCluster = std::max<std::int64_t>(1, fCounters->fSzLoaded.GetValue() / nTotalLoaded);
+      const auto maxByMemory = fMemoryBudget / (2 * static_cast<std::size_t>(szAvgCluster));
+      bunchSize = static_cast<unsigned int>(std::min<std::size_t>(bunchSize, maxByMemory));
+   }
+   fClusterBunchSize = std::max(1u, std::min(bunchSize, fMaxClusterBunchSize));
+   fCounters->fNClusterBunchSize.SetValue(fClusterBunchSize);
+
+   fnStartWindow();
+}
+
 ROOT::Experimental::Detail::RCluster *
 ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
                                                      const RCluster::ColumnSet_t &physicalColumns)
 {
+   AdaptClusterBunchSize(clusterId);
+
    std::set<DescriptorId_t> keep;
    RProvides provide;
    {
@@ -413,6 +503,13 @@ ROOT::Experimental::Detail::RClusterPool::WaitFor(DescriptorId_t clusterId,
          // is released.  We need to release the lock before potentially blocking on the cluster future.
       }
 
+      if (itr->fFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+         fCounters->fNStall.Inc();
+         auto tStart = std::chrono::steady_clock::now();
+         itr->fFuture.wait();
+         fCounters->fTimeWallStall.Add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tStart).count());
+      }
       auto cptr = itr->fFuture.get();
       if (result) {
          result->Adopt(std::move(*cptr));
@@ -47,6 +47,14 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(EColumnType type)
       return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
    case EColumnType::kSplitInt16:
       return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>(nullptr);
+   case EColumnType::kSplitIndex32:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32>>(nullptr);
+   case EColumnType::kSplitZigzagInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitZigzagInt64>>(nullptr);
+   case EColumnType::kSplitZigzagInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitZigzagInt32>>(nullptr);
+   case EColumnType::kSplitZigzagInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitZigzagInt16>>(nullptr);
    default: R__ASSERT(false);
    }
    // never here
@@ -71,6 +79,10 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
    case EColumnType::kSplitInt64: return 64;
    case EColumnType::kSplitInt32: return 32;
    case EColumnType::kSplitInt16: return 16;
+   case EColumnType::kSplitIndex32: return 32;
+   case EColumnType::kSplitZigzagInt64: return 64;
+   case EColumnType::kSplitZigzagInt32: return 32;
+   case EColumnType::kSplitZigzagInt16: return 16;
    default: R__ASSERT(false);
    }
    // never here
@@ -95,6 +107,10 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
    case EColumnType::kSplitInt64: return "SplitInt64";
    case EColumnType::kSplitInt32: return "SplitInt32";
    case EColumnType::kSplitInt16: return "SplitInt16";
+   case EColumnType::kSplitIndex32: return "SplitIndex32";
+   case EColumnType::kSplitZigzagInt64: return "SplitZigzagInt64";
+   case EColumnType::kSplitZigzagInt32: return "SplitZigzagInt32";
+   case EColumnType::kSplitZigzagInt16: return "SplitZigzagInt16";
    default: return "UNKNOWN";
    }
 }
@@ -193,6 +209,44 @@ void ROOT::Experimental::Detail::RColumnElement<
    }
 }
 
+void ROOT::Experimental::Detail::RColumnElement<
+   ROOT::Experimental::ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex32>::Pack(void *dst, void *src,
+                                                                                            std::size_t count) const
+{
+   // Offsets are stored as differences to the previous offset of the page. The deltas are small for typical
+   // collections and split into mostly-zero byte streams, which compress much better than the raw offsets.
+   // The bytes are extracted arithmetically, which is endianess agnostic and keeps the inner loops vectorizable.
+   auto offsets = reinterpret_cast<const ClusterSize_t::ValueType *>(src);
+   auto splitArray = reinterpret_cast<unsigned char *>(dst);
+   if (count == 0)
+      return;
+   for (std::size_t b = 0; b < 4; ++b) {
+      unsigned char *splitBytes = splitArray + b * count;
+      splitBytes[0] = static_cast<unsigned char>(static_cast<std::uint32_t>(offsets[0]) >> (8 * b));
+      for (std::size_t i = 1; i < count; ++i) {
+         const auto delta = static_cast<std::uint32_t>(offsets[i] - offsets[i - 1]);
+         splitBytes[i] = static_cast<unsigned char>(delta >> (8 * b));
+      }
+   }
+}
+
+void ROOT::Experimental::Detail::RColumnElement<
+   ROOT::Experimental::ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex32>::Unpack(void *dst, void *src,
+                                                                                              std::size_t count) const
+{
+   auto splitArray = reinterpret_cast<const unsigned char *>(src);
+   auto offsets = reinterpret_cast<ClusterSize_t::ValueType *>(dst);
+   for (std::size_t i = 0; i < count; ++i)
+      offsets[i] = splitArray[i];
+   for (std::size_t b = 1; b < 4; ++b) {
+      const unsigned char *splitBytes = splitArray + b * count;
+      for (std::size_t i = 0; i < count; ++i)
+         offsets[i] |= static_cast<ClusterSize_t::ValueType>(splitBytes[i]) << (8 * b);
+   }
+   for (std::size_t i = 1; i < count; ++i)
+      offsets[i] += offsets[i - 1];
+}
+
 void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kInt32>::Pack(
   void *dst, void *src, std::size_t count) const
 {
@@ -160,6 +160,12 @@ std::string GetNormalizedType(const std::string &typeName) {
    if (normalizedType.substr(0, 8) == "variant<") normalizedType = "std::" + normalizedType;
    if (normalizedType.substr(0, 5) == "pair<") normalizedType = "std::" + normalizedType;
    if (normalizedType.substr(0, 6) == "tuple<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 4) == "map<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 14) == "unordered_map<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 4) == "set<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 14) == "unordered_set<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 9) == "optional<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 11) == "unique_ptr<") normalizedType = "std::" + normalizedType;
 
    return normalizedType;
 }
@@ -309,6 +315,39 @@ ROOT::Experimental::Detail::RFieldBase::Create(const std::string &fieldName, con
       }
       result = std::make_unique<RTupleField>(fieldName, items);
    }
+   if (normalizedType.substr(0, 9) == "std::map<" || normalizedType.substr(0, 19) == "std::unordered_map<") {
+      const auto prefixLength = normalizedType.find('<') + 1;
+      auto innerTypes =
+         TokenizeTypeList(normalizedType.substr(prefixLength, normalizedType.length() - prefixLength - 1));
+      if (innerTypes.size() != 2)
+         return R__FAIL("the type list for " + normalizedType.substr(0, prefixLength - 1) +
+                        " must have exactly two elements");
+      auto itemField = Create("_0", "std::pair<" + innerTypes[0] + "," + innerTypes[1] + ">").Unwrap();
+      // Use the normalized key and value type names of the item field
+      auto mapTypeName = normalizedType.substr(0, prefixLength) + itemField->GetSubFields()[0]->GetType() + "," +
+                         itemField->GetSubFields()[1]->GetType() + ">";
+      result = std::make_unique<RMapField>(fieldName, mapTypeName, std::move(itemField));
+   }
+   if (normalizedType.substr(0, 9) == "std::set<" || normalizedType.substr(0, 19) == "std::unordered_set<") {
+      const auto prefixLength = normalizedType.find('<') + 1;
+      std::string itemTypeName = normalizedType.substr(prefixLength, normalizedType.length() - prefixLength - 1);
+      auto itemField = Create("_0", itemTypeName).Unwrap();
+      auto setTypeName = normalizedType.substr(0, prefixLength) + itemField->GetType() + ">";
+      result = std::make_unique<RSetField>(fieldName, setTypeName, std::move(itemField));
+   }
+   if (normalizedType.substr(0, 14) == "std::optional<") {
+      std::string itemTypeName = normalizedType.substr(14, normalizedType.length() - 15);
+      auto itemField = Create("_0", itemTypeName).Unwrap();
+      auto optionalTypeName = "std::optional<" + itemField->GetType() + ">";
+      result = std::make_unique<ROptionalField>(fieldName, optionalTypeName, std::move(itemField));
+   }
+   if (normalizedType.substr(0, 16) == "std::unique_ptr<") {
+      // Ignore the deleter, if present; only the default deleter is supported
+      auto innerTypes = TokenizeTypeList(normalizedType.substr(16, normalizedType.length() - 17));
+      auto itemField = Create("_0", innerTypes[0]).Unwrap();
+      auto uniquePtrTypeName = "std::unique_ptr<" + itemField->GetType() + ">";
+      result = std::make_unique<RUniquePtrField>(fieldName, uniquePtrTypeName, std::move(itemField));
+   }
    // TODO: create an RCollectionField?
    if (normalizedType == ":Collection:")
      result = std::make_unique<RField<ClusterSize_t>>(fieldName);
@@ -477,18 +516,20 @@ void ROOT::Experimental::Detail::RFieldBase::ConnectPageSink(RPageSink &pageSink
 
    /// Fix-up default encoding: if the ntuple is uncompressed, the default encoding should be non-split
    if ((pageSink.GetWriteOptions().GetCompression() == 0) && HasDefaultColumnRepresentative()) {
-      const auto &rep = GetColumnRepresentative();
-      if (rep == ColumnRepresentation_t({EColumnType::kSplitReal64})) {
-         SetColumnRepresentative({EColumnType::kReal64});
-      } else if (rep == ColumnRepresentation_t({EColumnType::kSplitReal32})) {
-         SetColumnRepresentative({EColumnType::kReal32});
-      } else if (rep == ColumnRepresentation_t({EColumnType::kSplitInt64})) {
-         SetColumnRepresentative({EColumnType::kInt64});
-      } else if (rep == ColumnRepresentation_t({EColumnType::kSplitInt32})) {
-         SetColumnRepresentative({EColumnType::kInt32});
-      } else if (rep == ColumnRepresentation_t({EColumnType::kSplitInt16})) {
-         SetColumnRepresentative({EColumnType::kInt16});
+      ColumnRepresentation_t rep = GetColumnRepresentative();
+      for (auto &colType : rep) {
+         switch (colType) {
+         case EColumnType::kSplitIndex32: colType = EColumnType::kIndex32; break;
+         case EColumnType::kSplitReal64: colType = EColumnType::kReal64; break;
+         case EColumnType::kSplitReal32: colType = EColumnType::kReal32; break;
+         case EColumnType::kSplitInt64: colType = EColumnType::kInt64; break;
+         case EColumnType::kSplitInt32: colType = EColumnType::kInt32; break;
+         case EColumnType::kSplitInt16: colType = EColumnType::kInt16; break;
+         default: break;
+         }
       }
+      if (rep != GetColumnRepresentative())
+         SetColumnRepresentative(rep);
    }
 
    GenerateColumnsImpl();
@@ -589,7 +630,7 @@ void ROOT::Experimental::RFieldZero::AcceptVisitor(Detail::RFieldVisitor &visito
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex32}, {EColumnType::kIndex32}}, {{}});
    return representations;
 }
 
@@ -614,7 +655,7 @@ void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::AcceptVisito
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<ROOT::Experimental::RNTupleCardinality>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex32}, {EColumnType::kIndex32}}, {{}});
    return representations;
 }
 
@@ -787,7 +828,8 @@ void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &vi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int16_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt16}, {EColumnType::kInt16}}, {{}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt16}, {EColumnType::kInt16}, {EColumnType::kSplitZigzagInt16}}, {{}});
    return representations;
 }
 
@@ -837,7 +879,8 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt32}, {EColumnType::kInt32}}, {{}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt32}, {EColumnType::kInt32}, {EColumnType::kSplitZigzagInt32}}, {{}});
    return representations;
 }
 
@@ -912,8 +955,9 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt64}, {EColumnType::kInt64}},
-                                                 {{EColumnType::kInt32}, {EColumnType::kSplitInt32}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt64}, {EColumnType::kInt64}, {EColumnType::kSplitZigzagInt64}},
+      {{EColumnType::kInt32}, {EColumnType::kSplitInt32}});
    return representations;
 }
 
@@ -938,7 +982,8 @@ void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::string>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32, EColumnType::kChar}}, {{}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitIndex32, EColumnType::kChar}, {EColumnType::kIndex32, EColumnType::kChar}}, {{}});
    return representations;
 }
 
@@ -1188,12 +1233,12 @@ void ROOT::Experimental::RClassField::AcceptVisitor(Detail::RFieldVisitor &visit
 
 ROOT::Experimental::RCollectionClassField::RCollectionIterableOnce::RIteratorFuncs
 ROOT::Experimental::RCollectionClassField::RCollectionIterableOnce::GetIteratorFuncs(TVirtualCollectionProxy *proxy,
-                                                                                     bool readOnly)
+                                                                                     bool readFromDisk)
 {
    RIteratorFuncs ifuncs;
-   ifuncs.fCreateIterators = proxy->GetFunctionCreateIterators(readOnly);
-   ifuncs.fDeleteTwoIterators = proxy->GetFunctionDeleteTwoIterators(readOnly);
-   ifuncs.fNext = proxy->GetFunctionNext(readOnly);
+   ifuncs.fCreateIterators = proxy->GetFunctionCreateIterators(readFromDisk);
+   ifuncs.fDeleteTwoIterators = proxy->GetFunctionDeleteTwoIterators(readFromDisk);
+   ifuncs.fNext = proxy->GetFunctionNext(readFromDisk);
    R__ASSERT((ifuncs.fCreateIterators != nullptr) && (ifuncs.fDeleteTwoIterators != nullptr) &&
              (ifuncs.fNext != nullptr));
    return ifuncs;
@@ -1202,27 +1247,9 @@ ROOT::Experimental::RCollectionClassField::RCollectionIterableOnce::GetIteratorF
 ROOT::Experimental::RCollectionClassField::RCollectionClassField(std::string_view fieldName, std::string_view className)
    : RCollectionClassField(fieldName, className, TClass::GetClass(std::string(className).c_str()))
 {
-}
-
-ROOT::Experimental::RCollectionClassField::RCollectionClassField(std::string_view fieldName, std::string_view className,
-                                                                 TClass *classp)
-   : ROOT::Experimental::Detail::RFieldBase(fieldName, className, ENTupleStructure::kCollection, false /* isSimple */),
-     fNWritten(0)
-{
-   if (classp == nullptr)
-      throw RException(R__FAIL("RField: no I/O support for collection proxy type " + std::string(className)));
-   if (!classp->GetCollectionProxy())
-      throw RException(R__FAIL(std::string(className) + " has no associated collection proxy"));
-
-   fProxy.reset(classp->GetCollectionProxy()->Generate());
-   fProperties = fProxy->GetProperties();
-   if (fProxy->HasPointers())
-      throw RException(R__FAIL("collection proxies whose value type is a pointer are not supported"));
+   // Associative collections of the standard library are handled by RMapField and RSetField
    if (fProperties & TVirtualCollectionProxy::kIsAssociative)
-      throw RException(R__FAIL("associative collections not supported"));
-
-   fIFuncsRead = RCollectionIterableOnce::GetIteratorFuncs(fProxy.get(), true /* readOnly */);
-   fIFuncsWrite = RCollectionIterableOnce::GetIteratorFuncs(fProxy.get(), false /* readOnly */);
+      throw RException(R__FAIL("custom associative collection proxies not supported"));
 
    std::unique_ptr<ROOT::Experimental::Detail::RFieldBase> itemField;
    if (auto valueClass = fProxy->GetValueClass()) {
@@ -1255,18 +1282,50 @@ ROOT::Experimental::RCollectionClassField::RCollectionClassField(std::string_vie
    Attach(std::move(itemField));
 }
 
+ROOT::Experimental::RCollectionClassField::RCollectionClassField(std::string_view fieldName, std::string_view className,
+                                                                 std::unique_ptr<Detail::RFieldBase> itemField)
+   : RCollectionClassField(fieldName, className, TClass::GetClass(std::string(className).c_str()))
+{
+   fItemSize = itemField->GetValueSize();
+   Attach(std::move(itemField));
+}
+
+ROOT::Experimental::RCollectionClassField::RCollectionClassField(std::string_view fieldName, std::string_view className,
+                                                                 TClass *classp)
+   : ROOT::Experimental::Detail::RFieldBase(fieldName, className, ENTupleStructure::kCollection, false /* isSimple */),
+     fNWritten(0)
+{
+   if (classp == nullptr)
+      throw RException(R__FAIL("RField: no I/O support for collection proxy type " + std::string(className)));
+   if (!classp->GetCollectionProxy())
+      throw RException(R__FAIL(std::string(className) + " has no associated collection proxy"));
+
+   fProxy.reset(classp->GetCollectionProxy()->Generate());
+   fProperties = fProxy->GetProperties();
+   if (fProperties & TVirtualCollectionProxy::kIsEmulated)
+      throw RException(
+         R__FAIL("emulated collection proxy for " + std::string(className) + ", a dictionary is required"));
+   fCollectionType = fProxy->GetCollectionType();
+   if (fProxy->HasPointers())
+      throw RException(R__FAIL("collection proxies whose value type is a pointer are not supported"));
+
+   fIFuncsRead = RCollectionIterableOnce::GetIteratorFuncs(fProxy.get(), true /* readFromDisk */);
+   fIFuncsWrite = RCollectionIterableOnce::GetIteratorFuncs(fProxy.get(), false /* readFromDisk */);
+}
+
 std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
 ROOT::Experimental::RCollectionClassField::CloneImpl(std::string_view newName) const
 {
+   auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
    return std::unique_ptr<RCollectionClassField>(
-      new RCollectionClassField(newName, GetType(), fProxy->GetCollectionClass()));
+      new RCollectionClassField(newName, GetType(), std::move(newItemField)));
 }
 
 std::size_t ROOT::Experimental::RCollectionClassField::AppendImpl(const Detail::RFieldValue &value)
 {
    std::size_t nbytes = 0;
    unsigned count = 0;
-   for (auto ptr : RCollectionIterableOnce{value.GetRawPtr(), fIFuncsRead, fProxy.get()}) {
+   for (auto ptr : RCollectionIterableOnce{value.GetRawPtr(), fIFuncsWrite, fProxy.get()}) {
       auto itemValue = fSubFields[0]->CaptureValue(ptr);
       nbytes += fSubFields[0]->Append(itemValue);
       count++;
@@ -1288,8 +1347,9 @@ void ROOT::Experimental::RCollectionClassField::ReadGlobalImpl(NTupleSize_t glob
    void *obj =
       fProxy->Allocate(static_cast<std::uint32_t>(nItems), (fProperties & TVirtualCollectionProxy::kNeedDelete));
    unsigned i = 0;
-   // TODO(jalopezg): we might be able to further optimize this in case `GetCollectionType() == kSTLvector`
-   for (auto ptr : RCollectionIterableOnce{obj, fIFuncsWrite, fProxy.get()}) {
+   // Vectors and the staging area of associative collections (obj != value) store their items contiguously
+   const bool isContiguous = (fCollectionType == ROOT::kSTLvector) || (obj != value->GetRawPtr());
+   for (auto ptr : RCollectionIterableOnce{obj, fIFuncsRead, fProxy.get(), isContiguous ? fItemSize : 0U}) {
       auto itemValue = fSubFields[0]->CaptureValue(ptr);
       fSubFields[0]->Read(collectionStart + i, &itemValue);
       i++;
@@ -1301,7 +1361,7 @@ void ROOT::Experimental::RCollectionClassField::ReadGlobalImpl(NTupleSize_t glob
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RCollectionClassField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex32}, {EColumnType::kIndex32}}, {{}});
    return representations;
 }
 
@@ -1343,7 +1403,7 @@ std::vector<ROOT::Experimental::Detail::RFieldValue>
 ROOT::Experimental::RCollectionClassField::SplitValue(const Detail::RFieldValue &value) const
 {
    std::vector<Detail::RFieldValue> result;
-   for (auto ptr : RCollectionIterableOnce{value.GetRawPtr(), fIFuncsRead, fProxy.get()}) {
+   for (auto ptr : RCollectionIterableOnce{value.GetRawPtr(), fIFuncsWrite, fProxy.get()}) {
       result.emplace_back(fSubFields[0]->CaptureValue(ptr));
    }
    return result;
@@ -1361,6 +1421,45 @@ void ROOT::Experimental::RCollectionClassField::AcceptVisitor(Detail::RFieldVisi
 
 //------------------------------------------------------------------------------
 
+ROOT::Experimental::RMapField::RMapField(std::string_view fieldName, std::string_view typeName,
+                                         std::unique_ptr<Detail::RFieldBase> itemField)
+   : RCollectionClassField(fieldName, typeName, TClass::GetClass(std::string(typeName).c_str()))
+{
+   if (!dynamic_cast<RPairField *>(itemField.get()))
+      throw RException(R__FAIL("RMapField inner field type must be of RPairField"));
+   if (!(fProperties & TVirtualCollectionProxy::kIsAssociative))
+      throw RException(R__FAIL(std::string(typeName) + " is not an associative collection"));
+   // The proxy's value class is `std::pair<const KeyT, ValueT>`, which has the layout of the item field
+   fItemSize = fProxy->GetValueClass()->GetClassSize();
+   Attach(std::move(itemField));
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RMapField::CloneImpl(std::string_view newName) const
+{
+   auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
+   return std::make_unique<RMapField>(newName, GetType(), std::move(newItemField));
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RSetField::RSetField(std::string_view fieldName, std::string_view typeName,
+                                         std::unique_ptr<Detail::RFieldBase> itemField)
+   : RCollectionClassField(fieldName, typeName, std::move(itemField))
+{
+   if (!(fProperties & TVirtualCollectionProxy::kIsAssociative))
+      throw RException(R__FAIL(std::string(typeName) + " is not an associative collection"));
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RSetField::CloneImpl(std::string_view newName) const
+{
+   auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
+   return std::make_unique<RSetField>(newName, GetType(), std::move(newItemField));
+}
+
+//------------------------------------------------------------------------------
+
 ROOT::Experimental::RRecordField::RRecordField(std::string_view fieldName,
                                                std::vector<std::unique_ptr<Detail::RFieldBase>> &&itemFields,
                                                const std::vector<std::size_t> &offsets, std::string_view typeName)
@@ -1558,7 +1657,7 @@ void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex,
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RVectorField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex32}, {EColumnType::kIndex32}}, {{}});
    return representations;
 }
 
@@ -1729,7 +1828,7 @@ void ROOT::Experimental::RRVecField::ReadGlobalImpl(NTupleSize_t globalIndex, De
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RRVecField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex32}, {EColumnType::kIndex32}}, {{}});
    return representations;
 }
 
@@ -1916,7 +2015,7 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::vector<bool>>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex32}, {EColumnType::kIndex32}}, {{}});
    return representations;
 }
 
@@ -2201,6 +2300,239 @@ void ROOT::Experimental::RVariantField::CommitCluster()
 
 //------------------------------------------------------------------------------
 
+ROOT::Experimental::RNullableField::RNullableField(std::string_view fieldName, std::string_view typeName,
+                                                   std::unique_ptr<Detail::RFieldBase> itemField)
+   : ROOT::Experimental::Detail::RFieldBase(fieldName, typeName, ENTupleStructure::kCollection, false /* isSimple */),
+     fNWritten(0)
+{
+   Attach(std::move(itemField));
+}
+
+const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
+ROOT::Experimental::RNullableField::GetColumnRepresentations() const
+{
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex32}, {EColumnType::kIndex32}}, {{}});
+   return representations;
+}
+
+void ROOT::Experimental::RNullableField::GenerateColumnsImpl()
+{
+   fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
+}
+
+void ROOT::Experimental::RNullableField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
+{
+   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
+   fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(onDiskTypes[0]), 0));
+}
+
+std::size_t ROOT::Experimental::RNullableField::AppendNull()
+{
+   Detail::RColumnElement<ClusterSize_t> elemIndex(&fNWritten);
+   fColumns[0]->Append(elemIndex);
+   return sizeof(ClusterSize_t);
+}
+
+std::size_t ROOT::Experimental::RNullableField::AppendValue(const Detail::RFieldValue &itemValue)
+{
+   auto nbytesItem = fSubFields[0]->Append(itemValue);
+   fNWritten++;
+   Detail::RColumnElement<ClusterSize_t> elemIndex(&fNWritten);
+   fColumns[0]->Append(elemIndex);
+   return sizeof(ClusterSize_t) + nbytesItem;
+}
+
+ROOT::Experimental::RClusterIndex ROOT::Experimental::RNullableField::GetItemIndex(NTupleSize_t globalIndex)
+{
+   RClusterIndex collectionStart;
+   ClusterSize_t collectionSize;
+   fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &collectionSize);
+   return (collectionSize == 0) ? RClusterIndex() : collectionStart;
+}
+
+void ROOT::Experimental::RNullableField::CommitCluster()
+{
+   fNWritten = 0;
+}
+
+void ROOT::Experimental::RNullableField::AcceptVisitor(Detail::RFieldVisitor &visitor) const
+{
+   visitor.VisitNullableField(*this);
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RUniquePtrField::RUniquePtrField(std::string_view fieldName, std::string_view typeName,
+                                                     std::unique_ptr<Detail::RFieldBase> itemField)
+   : RNullableField(fieldName, typeName, std::move(itemField))
+{
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RUniquePtrField::CloneImpl(std::string_view newName) const
+{
+   auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
+   return std::make_unique<RUniquePtrField>(newName, GetType(), std::move(newItemField));
+}
+
+std::size_t ROOT::Experimental::RUniquePtrField::AppendImpl(const Detail::RFieldValue &value)
+{
+   auto typedValue = value.Get<std::unique_ptr<char>>();
+   if (!*typedValue)
+      return AppendNull();
+   auto itemValue = fSubFields[0]->CaptureValue(typedValue->get());
+   return AppendValue(itemValue);
+}
+
+void ROOT::Experimental::RUniquePtrField::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
+{
+   auto ptr = value->Get<std::unique_ptr<char>>();
+   const auto itemIndex = GetItemIndex(globalIndex);
+   const bool isValidItem = itemIndex.GetIndex() != kInvalidClusterIndex;
+   if (!isValidItem) {
+      if (*ptr) {
+         auto itemValue = fSubFields[0]->CaptureValue(ptr->release());
+         fSubFields[0]->DestroyValue(itemValue, true /* dtorOnly */);
+         operator delete(itemValue.GetRawPtr());
+      }
+      return;
+   }
+
+   if (!*ptr) {
+      // Allocate such that the default deleter of std::unique_ptr can release the item
+      void *where = operator new(fSubFields[0]->GetValueSize());
+      fSubFields[0]->GenerateValue(where);
+      ptr->reset(static_cast<char *>(where));
+   }
+   auto itemValue = fSubFields[0]->CaptureValue(ptr->get());
+   fSubFields[0]->Read(itemIndex, &itemValue);
+}
+
+ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RUniquePtrField::GenerateValue(void *where)
+{
+   return Detail::RFieldValue(this, static_cast<std::unique_ptr<char> *>(where));
+}
+
+void ROOT::Experimental::RUniquePtrField::DestroyValue(const Detail::RFieldValue &value, bool dtorOnly)
+{
+   auto ptr = value.Get<std::unique_ptr<char>>();
+   if (*ptr) {
+      auto itemValue = fSubFields[0]->CaptureValue(ptr->release());
+      fSubFields[0]->DestroyValue(itemValue, true /* dtorOnly */);
+      operator delete(itemValue.GetRawPtr());
+   }
+   ptr->~unique_ptr();
+   if (!dtorOnly)
+      free(ptr);
+}
+
+ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RUniquePtrField::CaptureValue(void *where)
+{
+   return Detail::RFieldValue(true /* captureFlag */, this, where);
+}
+
+std::vector<ROOT::Experimental::Detail::RFieldValue>
+ROOT::Experimental::RUniquePtrField::SplitValue(const Detail::RFieldValue &value) const
+{
+   std::vector<Detail::RFieldValue> result;
+   auto ptr = value.Get<std::unique_ptr<char>>();
+   if (*ptr)
+      result.emplace_back(fSubFields[0]->CaptureValue(ptr->get()));
+   return result;
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::ROptionalField::ROptionalField(std::string_view fieldName, std::string_view typeName,
+                                                   std::unique_ptr<Detail::RFieldBase> itemField)
+   : RNullableField(fieldName, typeName, std::move(itemField))
+{
+}
+
+bool *ROOT::Experimental::ROptionalField::GetEngagementPtr(void *optionalPtr) const
+{
+   return reinterpret_cast<bool *>(static_cast<unsigned char *>(optionalPtr) + fSubFields[0]->GetValueSize());
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::ROptionalField::CloneImpl(std::string_view newName) const
+{
+   auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
+   return std::make_unique<ROptionalField>(newName, GetType(), std::move(newItemField));
+}
+
+std::size_t ROOT::Experimental::ROptionalField::AppendImpl(const Detail::RFieldValue &value)
+{
+   if (!*GetEngagementPtr(value.GetRawPtr()))
+      return AppendNull();
+   auto itemValue = fSubFields[0]->CaptureValue(value.GetRawPtr());
+   return AppendValue(itemValue);
+}
+
+void ROOT::Experimental::ROptionalField::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
+{
+   auto optionalPtr = value->GetRawPtr();
+   auto isEngaged = GetEngagementPtr(optionalPtr);
+   const auto itemIndex = GetItemIndex(globalIndex);
+   if (itemIndex.GetIndex() == kInvalidClusterIndex) {
+      if (*isEngaged) {
+         auto itemValue = fSubFields[0]->CaptureValue(optionalPtr);
+         fSubFields[0]->DestroyValue(itemValue, true /* dtorOnly */);
+         *isEngaged = false;
+      }
+      return;
+   }
+
+   if (!*isEngaged) {
+      fSubFields[0]->GenerateValue(optionalPtr);
+      *isEngaged = true;
+   }
+   auto itemValue = fSubFields[0]->CaptureValue(optionalPtr);
+   fSubFields[0]->Read(itemIndex, &itemValue);
+}
+
+ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::ROptionalField::GenerateValue(void *where)
+{
+   *GetEngagementPtr(where) = false;
+   return Detail::RFieldValue(true /* captureFlag */, this, where);
+}
+
+void ROOT::Experimental::ROptionalField::DestroyValue(const Detail::RFieldValue &value, bool dtorOnly)
+{
+   auto optionalPtr = value.GetRawPtr();
+   if (*GetEngagementPtr(optionalPtr)) {
+      auto itemValue = fSubFields[0]->CaptureValue(optionalPtr);
+      fSubFields[0]->DestroyValue(itemValue, true /* dtorOnly */);
+   }
+   if (!dtorOnly)
+      free(optionalPtr);
+}
+
+ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::ROptionalField::CaptureValue(void *where)
+{
+   return Detail::RFieldValue(true /* captureFlag */, this, where);
+}
+
+std::vector<ROOT::Experimental::Detail::RFieldValue>
+ROOT::Experimental::ROptionalField::SplitValue(const Detail::RFieldValue &value) const
+{
+   std::vector<Detail::RFieldValue> result;
+   if (*GetEngagementPtr(value.GetRawPtr()))
+      result.emplace_back(fSubFields[0]->CaptureValue(value.GetRawPtr()));
+   return result;
+}
+
+size_t ROOT::Experimental::ROptionalField::GetValueSize() const
+{
+   // The item is followed by the engagement flag, padded to the alignment of the item
+   const auto alignment = GetAlignment();
+   const auto actualSize = fSubFields[0]->GetValueSize() + sizeof(bool);
+   const auto remainder = actualSize % alignment;
+   return (remainder == 0) ? actualSize : actualSize + alignment - remainder;
+}
+
+//------------------------------------------------------------------------------
+
 std::string ROOT::Experimental::RPairField::RPairField::GetTypeList(
    const std::array<std::unique_ptr<Detail::RFieldBase>, 2> &itemFields)
 {
@@ -2342,7 +2674,7 @@ ROOT::Experimental::RCollectionField::RCollectionField(
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RCollectionField::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kIndex32}}, {{}});
+   static RColumnRepresentations representations({{EColumnType::kSplitIndex32}, {EColumnType::kIndex32}}, {{}});
    return representations;
 }
 
@@ -347,6 +347,22 @@ void ROOT::Experimental::RPrintValueVisitor::VisitRVecField(const RRVecField &fi
    PrintCollection(field);
 }
 
+void ROOT::Experimental::RPrintValueVisitor::VisitNullableField(const RNullableField &field)
+{
+   PrintIndent();
+   PrintName(field);
+   auto elems = field.SplitValue(fValue);
+   if (elems.empty()) {
+      fOutput << "null";
+      return;
+   }
+   RPrintOptions options;
+   options.fPrintSingleLine = true;
+   options.fPrintName = false;
+   RPrintValueVisitor elemVisitor(elems[0], fOutput, 0 /* level */, options);
+   elems[0].GetField()->AcceptVisitor(elemVisitor);
+}
+
 //---------------------------- RNTupleFormatter --------------------------------
 
 
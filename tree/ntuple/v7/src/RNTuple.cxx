@@ -15,8 +15,10 @@
 
 #include <ROOT/RNTuple.hxx>
 
+#include <ROOT/RColumn.hxx>
 #include <ROOT/RFieldVisitor.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPageSourceFriends.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
@@ -35,6 +37,8 @@
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -263,6 +267,45 @@ void ROOT::Experimental::RNTupleReader::Show(NTupleSize_t index, const ENTupleSh
    }
 }
 
+std::vector<ROOT::Experimental::RNTupleGlobalRange>
+ROOT::Experimental::RNTupleReader::GetEntryRanges(std::string_view fieldName, double min, double max)
+{
+   DescriptorId_t fieldId;
+   // Pairs of first entry and cluster ID, sorted by first entry
+   std::vector<std::pair<NTupleSize_t, DescriptorId_t>> clusters;
+   std::unordered_map<DescriptorId_t, NTupleSize_t> clusterNEntries;
+   {
+      auto descriptorGuard = fSource->GetSharedDescriptorGuard();
+      fieldId = descriptorGuard->FindFieldId(fieldName);
+      if (fieldId == kInvalidDescriptorId) {
+         throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" +
+                                  descriptorGuard->GetName() + "'"));
+      }
+      for (const auto &c : descriptorGuard->GetClusterIterable()) {
+         clusters.emplace_back(c.GetFirstEntryIndex(), c.GetId());
+         clusterNEntries[c.GetId()] = c.GetNEntries();
+      }
+   }
+   std::sort(clusters.begin(), clusters.end());
+
+   std::vector<RNTupleGlobalRange> ranges;
+   NTupleSize_t start = kInvalidNTupleIndex;
+   NTupleSize_t end = kInvalidNTupleIndex;
+   for (const auto &[firstEntry, clusterId] : clusters) {
+      if (fSource->CanSkipCluster(clusterId, fieldId, min, max))
+         continue;
+      if (firstEntry != end) {
+         if (start != kInvalidNTupleIndex)
+            ranges.emplace_back(start, end);
+         start = firstEntry;
+      }
+      end = firstEntry + clusterNEntries[clusterId];
+   }
+   if (start != kInvalidNTupleIndex)
+      ranges.emplace_back(start, end);
+   return ranges;
+}
+
 const ROOT::Experimental::RNTupleDescriptor *ROOT::Experimental::RNTupleReader::GetDescriptor()
 {
    auto descriptorGuard = fSource->GetSharedDescriptorGuard();
@@ -273,9 +316,9 @@ const ROOT::Experimental::RNTupleDescriptor *ROOT::Experimental::RNTupleReader::
 
 //------------------------------------------------------------------------------
 
-ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
-                                                 std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
-   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleWriter")
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+                                                           std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
 {
    if (!fModel) {
       throw RException(R__FAIL("null model"));
@@ -291,7 +334,6 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimen
    }
 #endif
    fSink->Create(*fModel.get());
-   fMetrics.ObserveMetrics(fSink->GetMetrics());
 
    const auto &writeOpts = fSink->GetWriteOptions();
    fMaxUnzippedClusterSize = writeOpts.GetMaxUnzippedClusterSize();
@@ -300,10 +342,50 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimen
    fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
 }
 
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   try {
+      CommitCluster();
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing the last cluster: " << err.GetError().GetReport();
+   }
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted) {
+      return;
+   }
+   for (auto &field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fNBytesCommitted += fSink->CommitCluster(fNEntries);
+   fNBytesFilled += fUnzippedClusterSize;
+
+   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
+   const float compressionFactor =
+      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+   fUnzippedClusterSizeEst =
+      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+
+   fLastCommitted = fNEntries;
+   fUnzippedClusterSize = 0;
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+                                                 std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : fFillContext(std::move(model), std::move(sink)), fMetrics("RNTupleWriter")
+{
+   fMetrics.ObserveMetrics(fFillContext.fSink->GetMetrics());
+}
+
 ROOT::Experimental::RNTupleWriter::~RNTupleWriter()
 {
    CommitCluster(true /* commitClusterGroup */);
-   fSink->CommitDataset();
+   fFillContext.fSink->CommitDataset();
 }
 
 std::unique_ptr<ROOT::Experimental::RNTupleWriter>
@@ -327,37 +409,153 @@ ROOT::Experimental::RNTupleWriter::Append(std::unique_ptr<RNTupleModel> model, s
 
 void ROOT::Experimental::RNTupleWriter::CommitClusterGroup()
 {
-   if (fNEntries == fLastCommittedClusterGroup)
+   if (fFillContext.GetNEntries() == fLastCommittedClusterGroup)
       return;
-   fSink->CommitClusterGroup();
-   fLastCommittedClusterGroup = fNEntries;
+   fFillContext.fSink->CommitClusterGroup();
+   fLastCommittedClusterGroup = fFillContext.GetNEntries();
 }
 
 void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
 {
-   if (fNEntries == fLastCommitted) {
-      if (commitClusterGroup)
-         CommitClusterGroup();
-      return;
+   fFillContext.CommitCluster();
+   if (commitClusterGroup)
+      CommitClusterGroup();
+}
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+/// The page sink of a fill context of the RNTupleParallelWriter.  It forwards all the writes to the shared page sink.
+/// It is wrapped by an RPageSinkBuf, which buffers and compresses the pages of a cluster and, when the cluster is
+/// committed, holds the lock returned by GetSinkGuard() while committing the sealed pages and the cluster itself.
+class RPageSynchronizingSink : public ROOT::Experimental::Detail::RPageSink {
+   using DescriptorId_t = ROOT::Experimental::DescriptorId_t;
+   using NTupleSize_t = ROOT::Experimental::NTupleSize_t;
+   using RNTupleLocator = ROOT::Experimental::RNTupleLocator;
+   using RNTupleModel = ROOT::Experimental::RNTupleModel;
+   using RPage = ROOT::Experimental::Detail::RPage;
+
+private:
+   RPageSink &fInnerSink;
+   std::mutex &fMutex;
+   /// The number of entries committed to the inner sink by all fill contexts, protected by fMutex
+   NTupleSize_t &fNEntriesInner;
+
+protected:
+   // The shared sink has been created by the parallel writer
+   void CreateImpl(const RNTupleModel &, unsigned char *, std::uint32_t) final {}
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final
+   {
+      fInnerSink.CommitPage(columnHandle, page);
+      // The locators of this sink are never written out
+      return RNTupleLocator{};
    }
-   for (auto &field : *fModel->GetFieldZero()) {
-      field.Flush();
-      field.CommitCluster();
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t physicalColumnId, const RSealedPage &sealedPage) final
+   {
+      fInnerSink.CommitSealedPage(physicalColumnId, sealedPage);
+      return RNTupleLocator{};
+   }
+   std::vector<RNTupleLocator> CommitSealedPageVImpl(std::span<RSealedPageGroup> ranges) final
+   {
+      fInnerSink.CommitSealedPageV(ranges);
+      std::size_t nPages = 0;
+      for (const auto &range : ranges)
+         nPages += std::distance(range.fFirst, range.fLast);
+      return std::vector<RNTupleLocator>(nPages);
+   }
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final
+   {
+      // nEntries counts the entries of the fill context; the inner sink expects the entries of all contexts
+      fNEntriesInner += nEntries - fPrevClusterNEntries;
+      return fInnerSink.CommitCluster(fNEntriesInner);
+   }
+   // Cluster groups and the data set are committed by the parallel writer
+   RNTupleLocator CommitClusterGroupImpl(unsigned char *, std::uint32_t) final { return RNTupleLocator{}; }
+   void CommitDatasetImpl(unsigned char *, std::uint32_t) final {}
+
+public:
+   RPageSynchronizingSink(RPageSink &inner, std::mutex &mutex, NTupleSize_t &nEntriesInner)
+      : RPageSink(inner.GetNTupleName(), inner.GetWriteOptions()),
+        fInnerSink(inner),
+        fMutex(mutex),
+        fNEntriesInner(nEntriesInner)
+   {
    }
-   fNBytesCommitted += fSink->CommitCluster(fNEntries);
-   fNBytesFilled += fUnzippedClusterSize;
 
-   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
-   const float compressionFactor =
-      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
-   fUnzippedClusterSizeEst =
-      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final
+   {
+      if (nElements == 0)
+         throw ROOT::Experimental::RException(R__FAIL("invalid call: request empty page"));
+      auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+      return ROOT::Experimental::Detail::RPageAllocatorHeap::NewPage(columnHandle.fPhysicalId, elementSize, nElements);
+   }
+   void ReleasePage(RPage &page) final { ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(page); }
 
-   fLastCommitted = fNEntries;
-   fUnzippedClusterSize = 0;
+   std::unique_lock<std::mutex> GetSinkGuard() final { return std::unique_lock<std::mutex>(fMutex); }
+   bool IsShared() const final { return true; }
+};
 
-   if (commitClusterGroup)
-      CommitClusterGroup();
+} // anonymous namespace
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleParallelWriter")
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
+   }
+   fModel->Freeze();
+   fSink->Create(*fModel);
+   fMetrics.ObserveMetrics(fSink->GetMetrics());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   for (const auto &context : fFillContexts) {
+      if (!context.expired()) {
+         R__LOG_ERROR(NTupleLog()) << "RNTupleFillContext has not been destructed before the RNTupleParallelWriter";
+      }
+   }
+   // All the clusters are committed at this point
+   if (fNEntries > 0)
+      fSink->CommitClusterGroup();
+   fSink->CommitDataset();
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   // The fill contexts buffer the pages; the shared sink writes them directly
+   auto sinkOptions = options.Clone();
+   sinkOptions->SetUseBufferedWrite(false);
+   auto sink = Detail::RPageSink::Create(ntupleName, storage, *sinkOptions);
+   return std::unique_ptr<RNTupleParallelWriter>(new RNTupleParallelWriter(std::move(model), std::move(sink)));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Append(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                  TFile &file, const RNTupleWriteOptions &options)
+{
+   auto sink = std::make_unique<Detail::RPageSinkFile>(ntupleName, file, options);
+   return std::unique_ptr<RNTupleParallelWriter>(new RNTupleParallelWriter(std::move(model), std::move(sink)));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+
+   // The cloned model has the same structure as fModel, so that the fill context's columns have the same ids
+   // as the columns of the shared sink
+   auto model = fModel->Clone();
+   auto sink = std::make_unique<Detail::RPageSinkBuf>(std::make_unique<RPageSynchronizingSink>(*fSink, fMutex, fNEntries));
+   std::shared_ptr<RNTupleFillContext> context(new RNTupleFillContext(std::move(model), std::move(sink)));
+   fFillContexts.emplace_back(context);
+   return context;
 }
 
 //------------------------------------------------------------------------------
@@ -415,9 +415,17 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(DescriptorId_t
       return R__FAIL("column ID conflict");
    RClusterDescriptor::RColumnRange columnRange{physicalId, firstElementIndex, RClusterSize(0)};
    columnRange.fCompressionSettings = compressionSettings;
+   bool hasStatistics = !pageRange.fPageInfos.empty();
    for (const auto &pi : pageRange.fPageInfos) {
       columnRange.fNElements += pi.fNElements;
+      if (pi.fNElements == 0)
+         continue;
+      hasStatistics = hasStatistics && pi.fStatistics.IsValid();
+      columnRange.fStatistics.Merge(pi.fStatistics);
    }
+   // A single page without statistics renders the summary of the entire column range meaningless
+   if (!hasStatistics)
+      columnRange.fStatistics = RColumnStatistics();
    fCluster.fPageRanges[physicalId] = pageRange.Clone();
    fCluster.fColumnRanges[physicalId] = columnRange;
    return RResult<void>::Success();
@@ -13,17 +13,118 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
 
-Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
-   if (inputs == nullptr || mergeInfo == nullptr) {
+#include <TError.h>
+#include <TFile.h>
+#include <TFileMergeInfo.h>
+#include <TROOT.h> // for IsImplicitMTEnabled()
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+struct RSourceColumn {
+   ROOT::Experimental::DescriptorId_t fPhysicalId;
+   ROOT::Experimental::EColumnType fType;
+};
+
+/// Collects the columns of all the fields of the descriptor, keyed by "<qualified field name>.<column index>"
+std::unordered_map<std::string, RSourceColumn> CollectColumns(const ROOT::Experimental::RNTupleDescriptor &desc)
+{
+   std::unordered_map<std::string, RSourceColumn> columns;
+   std::vector<ROOT::Experimental::DescriptorId_t> fieldIds{desc.GetFieldZeroId()};
+   while (!fieldIds.empty()) {
+      const auto fieldId = fieldIds.back();
+      fieldIds.pop_back();
+      for (const auto &c : desc.GetColumnIterable(fieldId)) {
+         if (c.IsAliasColumn()) {
+            throw ROOT::Experimental::RException(
+               R__FAIL("merging ntuples with projected fields is unsupported: " + desc.GetQualifiedFieldName(fieldId)));
+         }
+         columns[desc.GetQualifiedFieldName(fieldId) + "." + std::to_string(c.GetIndex())] =
+            RSourceColumn{c.GetPhysicalId(), c.GetModel().GetType()};
+      }
+      for (const auto &f : desc.GetFieldIterable(fieldId))
+         fieldIds.emplace_back(f.GetId());
+   }
+   return columns;
+}
+
+std::int64_t GetElapsedNs(const std::chrono::steady_clock::time_point &start)
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // anonymous namespace
+
+Long64_t ROOT::Experimental::RNTuple::Merge(TCollection *inputs, TFileMergeInfo *mergeInfo)
+{
+   // As prepared by TFileMerger, the first entry of the inputs is the ntuple name, the second entry is the output file
+   // and the remaining entries are the input files
+   if (inputs == nullptr || mergeInfo == nullptr || inputs->GetEntries() < 3) {
       return -1;
    }
-   return -1;
+
+   TIter itr(inputs);
+   const std::string ntupleName = itr()->GetName();
+   auto outFile = dynamic_cast<TFile *>(itr());
+   if (!outFile) {
+      Error("RNTuple::Merge", "the second input parameter must be the output file");
+      return -1;
+   }
+   if (outFile->FindKey(ntupleName.c_str())) {
+      Error("RNTuple::Merge", "incremental merging into the existing ntuple '%s' is unsupported", ntupleName.c_str());
+      return -1;
+   }
+
+   std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   while (auto obj = itr()) {
+      auto inFile = dynamic_cast<TFile *>(obj);
+      std::unique_ptr<RNTuple> anchor(inFile ? inFile->Get<RNTuple>(ntupleName.c_str()) : nullptr);
+      if (!anchor) {
+         Error("RNTuple::Merge", "cannot find ntuple '%s' in %s", ntupleName.c_str(), obj->GetName());
+         return -1;
+      }
+      sources.emplace_back(anchor->MakePageSource());
+   }
+   std::vector<Detail::RPageSource *> sourcePtrs;
+   for (const auto &s : sources)
+      sourcePtrs.emplace_back(s.get());
+
+   // Using the compression of the output file allows for copying the compressed pages if the input files have
+   // the same compression setting
+   RNTupleWriteOptions options;
+   options.SetCompression(outFile->GetCompressionSettings());
+   try {
+      Detail::RPageSinkFile destination(ntupleName, *outFile, options);
+      RNTupleMerger merger;
+      merger.Merge(sourcePtrs, destination);
+   } catch (const RException &e) {
+      Error("RNTuple::Merge", "%s", e.what());
+      return -1;
+   }
+   return 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -36,3 +137,316 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct ROOT::Experimental::RNTupleMerger::RSourceState {
+   Detail::RPageSource *fSource = nullptr;
+   /// Serializes the access to the page source, which is not thread-safe for reading clusters
+   std::mutex fLock;
+   /// Created on first use, only needed for clusters whose compression differs from the output compression
+   std::unique_ptr<Detail::RNTupleDecompressor> fDecompressor;
+   std::vector<DescriptorId_t> fColumnMap;
+   /// The cluster ids and first entry numbers of the source in entry order
+   std::vector<std::pair<DescriptorId_t, NTupleSize_t>> fClusters;
+};
+
+struct ROOT::Experimental::RNTupleMerger::RClusterTask {
+   NTupleSize_t fNEntries = 0;
+   /// Owns the on-disk pages that are copied verbatim
+   std::unique_ptr<Detail::RCluster> fCluster;
+   /// Owns the recompressed pages
+   std::vector<std::unique_ptr<unsigned char[]>> fBuffers;
+   Detail::RPageStorage::SealedPageSequence_t fSealedPages;
+   std::vector<Detail::RPageStorage::RSealedPageGroup> fGroups;
+   std::uint64_t fSzSealedPages = 0;
+};
+
+ROOT::Experimental::RNTupleMerger::RNTupleMerger(unsigned int nThreads) : fNThreads(nThreads), fMetrics("RNTupleMerger")
+{
+   if (fNThreads == 0)
+      fNThreads = IsImplicitMTEnabled() ? std::max(1u, GetThreadPoolSize()) : 1;
+
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("nSources", "", "number of merged input ntuples"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("nClusters", "", "number of merged clusters"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("nPageCopied", "", "number of pages copied verbatim"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("nPageResealed", "",
+                                                            "number of pages recompressed with the output compression"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("szRead", "B", "volume of pages read from the inputs"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("szWritten", "B", "volume of pages written to the output"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("timeWallRead", "ns",
+                                                            "wall clock time spent reading, summed over all tasks"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("timeWallWrite", "ns", "wall clock time spent writing"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("timeWallMerge", "ns", "wall clock time of the merge")});
+   fMetrics.MakeCounter<Detail::RNTupleCalcPerf *>(
+      "bwMerge", "MB/s", "bandwidth of pages written per second of merging", fMetrics,
+      [](const Detail::RNTupleMetrics &metrics) -> std::pair<bool, double> {
+         if (const auto szWritten = metrics.GetLocalCounter("szWritten")) {
+            if (const auto timeWallMerge = metrics.GetLocalCounter("timeWallMerge")) {
+               if (auto walltime = timeWallMerge->GetValueAsInt()) {
+                  // unit: bytes / nanosecond = GB/s
+                  return {true, 1000. * szWritten->GetValueAsInt() / walltime};
+               }
+            }
+         }
+         return {false, -1.};
+      });
+}
+
+ROOT::Experimental::RNTupleMerger::~RNTupleMerger() = default;
+
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::RNTupleMerger::MapColumns(const RNTupleDescriptor &desc) const
+{
+   const auto sourceColumns = CollectColumns(desc);
+   if (sourceColumns.size() != fOutputColumns.size()) {
+      throw RException(R__FAIL("ntuple '" + desc.GetName() + "' has " + std::to_string(sourceColumns.size()) +
+                               " columns, expected " + std::to_string(fOutputColumns.size())));
+   }
+
+   std::vector<DescriptorId_t> columnMap;
+   for (const auto &c : fOutputColumns) {
+      auto itr = sourceColumns.find(c.fColumnName);
+      if (itr == sourceColumns.end())
+         throw RException(R__FAIL("ntuple '" + desc.GetName() + "' has no column " + c.fColumnName));
+      if (itr->second.fType != c.fType)
+         throw RException(R__FAIL("column type mismatch for column " + c.fColumnName));
+      columnMap.emplace_back(itr->second.fPhysicalId);
+   }
+   return columnMap;
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleMerger::RClusterTask>
+ROOT::Experimental::RNTupleMerger::ReadCluster(RSourceState &source, DescriptorId_t clusterId, int outputCompression)
+{
+   std::lock_guard<std::mutex> guard(source.fLock);
+   auto tStart = std::chrono::steady_clock::now();
+   auto task = std::make_unique<RClusterTask>();
+
+   Detail::RCluster::RKey key;
+   key.fClusterId = clusterId;
+   {
+      auto descriptorGuard = source.fSource->GetSharedDescriptorGuard();
+      const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+      task->fNEntries = clusterDesc.GetNEntries();
+      for (auto physicalId : source.fColumnMap) {
+         if (clusterDesc.ContainsColumn(physicalId))
+            key.fPhysicalColumnSet.insert(physicalId);
+      }
+   }
+   task->fCluster = std::move(source.fSource->LoadClusters(std::span<Detail::RCluster::RKey>(&key, 1))[0]);
+
+   // Index range in fSealedPages per output column; the groups are created at the end because the deque iterators
+   // are invalidated by adding pages
+   std::vector<std::pair<std::size_t, std::size_t>> pageRanges;
+   auto descriptorGuard = source.fSource->GetSharedDescriptorGuard();
+   const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+   for (std::size_t i = 0; i < source.fColumnMap.size(); ++i) {
+      const auto physicalId = source.fColumnMap[i];
+      const auto firstPage = task->fSealedPages.size();
+      pageRanges.emplace_back(firstPage, firstPage);
+      if (!clusterDesc.ContainsColumn(physicalId))
+         continue;
+
+      const bool isVerbatim = clusterDesc.GetColumnRange(physicalId).fCompressionSettings == outputCompression;
+      std::unique_ptr<Detail::RColumnElementBase> element;
+      if (!isVerbatim) {
+         element =
+            Detail::RColumnElementBase::Generate(descriptorGuard->GetColumnDescriptor(physicalId).GetModel().GetType());
+         if (!source.fDecompressor)
+            source.fDecompressor = std::make_unique<Detail::RNTupleDecompressor>();
+      }
+
+      std::uint64_t pageNo = 0;
+      for (const auto &pi : clusterDesc.GetPageRange(physicalId).fPageInfos) {
+         auto onDiskPage = task->fCluster->GetOnDiskPage(Detail::ROnDiskPage::Key(physicalId, pageNo++));
+         R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
+         fCounters->fSzRead.Add(onDiskPage->GetSize());
+
+         Detail::RPageStorage::RSealedPage sealedPage(onDiskPage->GetAddress(), onDiskPage->GetSize(), pi.fNElements);
+         if (isVerbatim) {
+            fCounters->fNPageCopied.Inc();
+         } else {
+            // Packed pages are recompressed without unpacking them into their in-memory representation
+            const auto packedSize = element->GetPackedSize(pi.fNElements);
+            auto packedBuffer = std::make_unique<unsigned char[]>(packedSize);
+            source.fDecompressor->Unzip(onDiskPage->GetAddress(), onDiskPage->GetSize(), packedSize,
+                                        packedBuffer.get());
+            auto zipBuffer = std::make_unique<unsigned char[]>(packedSize);
+            sealedPage.fBuffer = zipBuffer.get();
+            sealedPage.fSize =
+               Detail::RNTupleCompressor::Zip(packedBuffer.get(), packedSize, outputCompression, zipBuffer.get());
+            task->fBuffers.emplace_back(std::move(zipBuffer));
+            fCounters->fNPageResealed.Inc();
+         }
+         sealedPage.fStatistics = pi.fStatistics;
+         task->fSzSealedPages += sealedPage.fSize;
+         task->fSealedPages.emplace_back(std::move(sealedPage));
+      }
+      pageRanges.back().second = task->fSealedPages.size();
+   }
+
+   for (std::size_t i = 0; i < pageRanges.size(); ++i) {
+      if (pageRanges[i].first == pageRanges[i].second)
+         continue;
+      task->fGroups.emplace_back(fOutputColumns[i].fOutputId, task->fSealedPages.cbegin() + pageRanges[i].first,
+                                 task->fSealedPages.cbegin() + pageRanges[i].second);
+   }
+
+   fCounters->fTimeWallRead.Add(GetElapsedNs(tStart));
+   return task;
+}
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no input ntuples to merge"));
+
+   auto tStart = std::chrono::steady_clock::now();
+   std::vector<std::unique_ptr<RSourceState>> sourceStates;
+   for (auto s : sources) {
+      sourceStates.emplace_back(std::make_unique<RSourceState>());
+      sourceStates.back()->fSource = s;
+   }
+
+   // Without implicit multi-threading, the inputs are read by the calling thread.  Two task groups let the clusters
+   // of the next batch be read while the clusters of the current batch are written.
+   std::array<std::unique_ptr<Detail::RPageStorage::RTaskScheduler>, 2> taskSchedulers;
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled()) {
+      taskSchedulers[0] = std::make_unique<RNTupleImtTaskScheduler>();
+      taskSchedulers[1] = std::make_unique<RNTupleImtTaskScheduler>();
+   }
+#endif
+
+   // Reading the header and footer of the inputs in parallel helps for many small inputs
+   if (taskSchedulers[0]) {
+      std::vector<std::exception_ptr> errors(sourceStates.size());
+      for (std::size_t i = 0; i < sourceStates.size(); ++i) {
+         taskSchedulers[0]->AddTask([&sourceStates, &errors, i] {
+            try {
+               sourceStates[i]->fSource->Attach();
+            } catch (...) {
+               errors[i] = std::current_exception();
+            }
+         });
+      }
+      taskSchedulers[0]->Wait();
+      taskSchedulers[0]->Reset();
+      for (auto &e : errors) {
+         if (e)
+            std::rethrow_exception(e);
+      }
+   } else {
+      for (auto &s : sourceStates)
+         s->fSource->Attach();
+   }
+
+   {
+      auto model = sources[0]->GetSharedDescriptorGuard()->GenerateModel();
+      destination.Create(*model);
+
+      // The page sink assigns the physical column ids in the order of the field traversal, see RPageSink::Create()
+      const auto firstColumns = CollectColumns(sources[0]->GetSharedDescriptorGuard().GetRef());
+      fOutputColumns.clear();
+      for (auto &f : *model->GetFieldZero()) {
+         const auto fieldName = f.GetQualifiedFieldName();
+         for (std::uint32_t idx = 0;; ++idx) {
+            auto itr = firstColumns.find(fieldName + "." + std::to_string(idx));
+            if (itr == firstColumns.end())
+               break;
+            fOutputColumns.emplace_back(RColumnInfo{itr->first, itr->second.fType, fOutputColumns.size()});
+         }
+      }
+      if (fOutputColumns.size() != firstColumns.size())
+         throw RException(R__FAIL("cannot map the columns of the first input ntuple to the output"));
+   }
+
+   for (auto &s : sourceStates) {
+      auto descriptorGuard = s->fSource->GetSharedDescriptorGuard();
+      s->fColumnMap = MapColumns(descriptorGuard.GetRef());
+      for (const auto &c : descriptorGuard->GetClusterIterable())
+         s->fClusters.emplace_back(c.GetId(), c.GetFirstEntryIndex());
+      std::sort(s->fClusters.begin(), s->fClusters.end(),
+                [](const auto &a, const auto &b) { return a.second < b.second; });
+   }
+
+   // The clusters of all the sources in output order, as pairs of source index and cluster id
+   std::vector<std::pair<std::size_t, DescriptorId_t>> clusters;
+   for (std::size_t i = 0; i < sourceStates.size(); ++i) {
+      if (sourceStates[i]->fClusters.empty())
+         fCounters->fNSources.Inc();
+      for (const auto &c : sourceStates[i]->fClusters)
+         clusters.emplace_back(i, c.first);
+   }
+
+   // With implicit multi-threading, the clusters are read and recompressed in batches of fNThreads tasks.  Clusters
+   // of the same source are read sequentially because page sources do not support concurrent reads.
+   const auto outputCompression = destination.GetWriteOptions().GetCompression();
+   std::vector<std::unique_ptr<RClusterTask>> tasks(clusters.size());
+   std::vector<std::exception_ptr> errors(clusters.size());
+   auto fnRead = [&](std::size_t i) {
+      try {
+         tasks[i] = ReadCluster(*sourceStates[clusters[i].first], clusters[i].second, outputCompression);
+      } catch (...) {
+         errors[i] = std::current_exception();
+      }
+   };
+   auto fnCommit = [&](std::size_t i) {
+      if (errors[i])
+         std::rethrow_exception(errors[i]);
+      auto task = std::move(tasks[i]);
+
+      auto tStartWrite = std::chrono::steady_clock::now();
+      destination.CommitSealedPageV(task->fGroups);
+      destination.CommitCluster(task->fNEntries);
+      fCounters->fTimeWallWrite.Add(GetElapsedNs(tStartWrite));
+      fCounters->fSzWritten.Add(task->fSzSealedPages);
+      fCounters->fNClusters.Inc();
+
+      // Every input ntuple results in one cluster group of the output
+      if ((i + 1 == clusters.size()) || (clusters[i + 1].first != clusters[i].first)) {
+         destination.CommitClusterGroup();
+         fCounters->fNSources.Inc();
+      }
+   };
+
+   if (taskSchedulers[0]) {
+      // The tasks refer to the local state, so they must be finished before it goes away, also on errors
+      struct RWaitGuard {
+         decltype(taskSchedulers) &fTaskSchedulers;
+         ~RWaitGuard()
+         {
+            for (auto &t : fTaskSchedulers)
+               t->Wait();
+         }
+      } waitGuard{taskSchedulers};
+
+      auto fnSchedule = [&](std::size_t first, Detail::RPageStorage::RTaskScheduler &scheduler) {
+         const auto last = std::min(first + fNThreads, clusters.size());
+         for (std::size_t i = first; i < last; ++i)
+            scheduler.AddTask([&fnRead, i] { fnRead(i); });
+         return last;
+      };
+
+      std::size_t first = 0;
+      std::size_t last = fnSchedule(first, *taskSchedulers[0]);
+      for (unsigned int current = 0; first < clusters.size(); current = 1 - current) {
+         taskSchedulers[current]->Wait();
+         taskSchedulers[current]->Reset();
+         const auto next = fnSchedule(last, *taskSchedulers[1 - current]);
+         for (std::size_t i = first; i < last; ++i)
+            fnCommit(i);
+         first = last;
+         last = next;
+      }
+   } else {
+      for (std::size_t i = 0; i < clusters.size(); ++i) {
+         fnRead(i);
+         fnCommit(i);
+      }
+   }
+   destination.CommitDataset();
+   fCounters->fTimeWallMerge.Add(GetElapsedNs(tStart));
+}
@@ -22,6 +22,7 @@
 #include <RVersion.h>
 #include <RZip.h> // for R__crc32
 
+#include <algorithm>
 #include <cstring> // for memcpy
 #include <deque>
 #include <set>
@@ -195,7 +196,8 @@ std::uint32_t SerializeColumnListV1(
          if (c.GetModel().GetIsSorted())
             flags |= RNTupleSerializer::kFlagSortAscColumn;
          // TODO(jblomer): fix for unsigned integer types
-         if (type == ROOT::Experimental::EColumnType::kIndex32)
+         if (type == ROOT::Experimental::EColumnType::kIndex32 ||
+             type == ROOT::Experimental::EColumnType::kSplitIndex32)
             flags |= RNTupleSerializer::kFlagNonNegativeColumn;
          pos += RNTupleSerializer::SerializeUInt32(flags, *where);
 
@@ -520,11 +522,15 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
    case EColumnType::kInt32: return SerializeUInt16(0x0B, buffer);
    case EColumnType::kInt16: return SerializeUInt16(0x0C, buffer);
    case EColumnType::kInt8: return SerializeUInt16(0x0D, buffer);
+   case EColumnType::kSplitIndex32: return SerializeUInt16(0x0F, buffer);
    case EColumnType::kSplitReal64: return SerializeUInt16(0x10, buffer);
    case EColumnType::kSplitReal32: return SerializeUInt16(0x11, buffer);
    case EColumnType::kSplitInt64: return SerializeUInt16(0x13, buffer);
    case EColumnType::kSplitInt32: return SerializeUInt16(0x14, buffer);
    case EColumnType::kSplitInt16: return SerializeUInt16(0x15, buffer);
+   case EColumnType::kSplitZigzagInt64: return SerializeUInt16(0x16, buffer);
+   case EColumnType::kSplitZigzagInt32: return SerializeUInt16(0x17, buffer);
+   case EColumnType::kSplitZigzagInt16: return SerializeUInt16(0x18, buffer);
    default: throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
 }
@@ -549,11 +555,15 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
    case 0x0B: type = EColumnType::kInt32; break;
    case 0x0C: type = EColumnType::kInt16; break;
    case 0x0D: type = EColumnType::kInt8; break;
+   case 0x0F: type = EColumnType::kSplitIndex32; break;
    case 0x10: type = EColumnType::kSplitReal64; break;
    case 0x11: type = EColumnType::kSplitReal32; break;
    case 0x13: type = EColumnType::kSplitInt64; break;
    case 0x14: type = EColumnType::kSplitInt32; break;
    case 0x15: type = EColumnType::kSplitInt16; break;
+   case 0x16: type = EColumnType::kSplitZigzagInt64; break;
+   case 0x17: type = EColumnType::kSplitZigzagInt32; break;
+   case 0x18: type = EColumnType::kSplitZigzagInt16; break;
    default: return R__FAIL("unexpected on-disk column type");
    }
    return result;
@@ -1071,6 +1081,20 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
 
+         // Optional page statistics, appended to the frame only if there are any. Older readers skip them.
+         const bool hasStatistics = std::any_of(pageRange.fPageInfos.begin(), pageRange.fPageInfos.end(),
+                                                [](const auto &pi) { return pi.fStatistics.IsValid(); });
+         if (hasStatistics) {
+            for (const auto &pi : pageRange.fPageInfos) {
+               std::uint64_t bits;
+               std::memcpy(&bits, &pi.fStatistics.fMin, sizeof(bits));
+               pos += SerializeUInt64(bits, *where);
+               std::memcpy(&bits, &pi.fStatistics.fMax, sizeof(bits));
+               pos += SerializeUInt64(bits, *where);
+               pos += SerializeUInt64(pi.fStatistics.fNEmpty, *where);
+            }
+         }
+
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
       pos += SerializeFramePostscript(buffer ? outerFrame : nullptr, pos - outerFrame);
@@ -1485,6 +1509,18 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
+         constexpr std::uint32_t kStatisticsSize = 3 * sizeof(std::uint64_t);
+         if (nPages > 0 && fnInnerFrameSizeLeft() >= static_cast<int>(nPages * kStatisticsSize)) {
+            for (auto &pi : pageRange.fPageInfos) {
+               std::uint64_t bits;
+               bytes += DeserializeUInt64(bytes, bits);
+               std::memcpy(&pi.fStatistics.fMin, &bits, sizeof(bits));
+               bytes += DeserializeUInt64(bytes, bits);
+               std::memcpy(&pi.fStatistics.fMax, &bits, sizeof(bits));
+               bytes += DeserializeUInt64(bytes, pi.fStatistics.fNEmpty);
+            }
+         }
+
          clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
          bytes = innerFrame + innerFrameSize;
       }
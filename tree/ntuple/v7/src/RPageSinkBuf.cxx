@@ -55,20 +55,33 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHa
    // valid until the return value of DrainBufferedPages() goes out of scope in
    // CommitCluster().
    RColumnBuf::iterator zipItem = fBufferedColumns.at(columnHandle.fPhysicalId).BufferPage(columnHandle, bufPage);
-   if (!fTaskScheduler) {
+   // Without a task scheduler, the inner sink compresses the pages when the cluster is committed, unless it is shared
+   // by several writers: then the pages are compressed here, such that the sink guard only covers the writes
+   if (!fTaskScheduler && !fInnerSink->IsShared()) {
       return RNTupleLocator{};
    }
-   fCounters->fParallelZip.SetValue(1);
    // Thread safety: Each thread works on a distinct zipItem which owns its
    // compression buffer.
-   zipItem->AllocateSealedPageBuf();
-   R__ASSERT(zipItem->fBuf);
+   // The sealed page slot is registered by the filling thread, such that the on-disk page order is the order
+   // in which the pages were committed, independent of the order in which the tasks finish.
    auto sealedPage = fBufferedColumns.at(columnHandle.fPhysicalId).RegisterSealedPage();
-   fTaskScheduler->AddTask([this, zipItem, sealedPage, colId = columnHandle.fPhysicalId] {
+   // The page info has already been registered by RPageSink::CommitPage()
+   const auto statistics = fOpenPageRanges.at(columnHandle.fPhysicalId).fPageInfos.back().fStatistics;
+   auto sealPage = [this, zipItem, sealedPage, statistics, colId = columnHandle.fPhysicalId] {
+      // Allocating the compression buffer in the task keeps the filling thread free for the next entries
+      zipItem->AllocateSealedPageBuf();
+      R__ASSERT(zipItem->fBuf);
       *sealedPage = SealPage(zipItem->fPage, *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
                              GetWriteOptions().GetCompression(), zipItem->fBuf.get());
+      sealedPage->fStatistics = statistics;
       zipItem->fSealedPage = &(*sealedPage);
-   });
+   };
+   if (fTaskScheduler) {
+      fCounters->fParallelZip.SetValue(1);
+      fTaskScheduler->AddTask(sealPage);
+   } else {
+      sealPage();
+   }
 
    // we're feeding bad locators to fOpenPageRanges but it should not matter
    // because they never get written out
@@ -93,6 +106,9 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
       fTaskScheduler->Reset();
    }
 
+   // If the inner sink is shared with other writers, the pages of this cluster must not interleave with theirs
+   auto sinkGuard = fInnerSink->GetSinkGuard();
+
    // If we have only sealed pages in all buffered columns, commit them in a single `CommitSealedPageV()` call
    bool singleCommitCall = std::all_of(fBufferedColumns.begin(), fBufferedColumns.end(),
                                        [](auto &bufColumn) { return bufColumn.HasSealedPagesOnly(); });
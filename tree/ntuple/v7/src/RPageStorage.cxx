@@ -127,6 +127,37 @@ ROOT::Experimental::NTupleSize_t ROOT::Experimental::Detail::RPageSource::GetNEn
    return GetSharedDescriptorGuard()->GetNEntries();
 }
 
+void ROOT::Experimental::Detail::RPageSource::LoadClustersIncrementally(std::span<RCluster::RKey> clusterKeys,
+                                                                        const ClusterCallback_t &callback)
+{
+   auto clusters = LoadClusters(clusterKeys);
+   for (std::size_t i = 0; i < clusters.size(); ++i)
+      callback(i, std::move(clusters[i]));
+}
+
+bool ROOT::Experimental::Detail::RPageSource::CanSkipCluster(DescriptorId_t clusterId, DescriptorId_t fieldId,
+                                                             double min, double max)
+{
+   auto descriptorGuard = GetSharedDescriptorGuard();
+   const auto fieldZeroId = descriptorGuard->GetFieldZeroId();
+   if (fieldId == fieldZeroId)
+      return false;
+   // The values of fields in collections cannot be mapped to entries
+   for (auto parentId = descriptorGuard->GetFieldDescriptor(fieldId).GetParentId(); parentId != fieldZeroId;
+        parentId = descriptorGuard->GetFieldDescriptor(parentId).GetParentId()) {
+      if (descriptorGuard->GetFieldDescriptor(parentId).GetStructure() != ENTupleStructure::kRecord)
+         return false;
+   }
+
+   const auto physicalId = descriptorGuard->FindPhysicalColumnId(fieldId, 0);
+   if (physicalId == kInvalidDescriptorId)
+      return false;
+   const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+   if (!clusterDesc.HasPageLocations() || !clusterDesc.ContainsColumn(physicalId))
+      return false;
+   return clusterDesc.GetColumnRange(physicalId).fStatistics.IsDisjoint(min, max);
+}
+
 ROOT::Experimental::NTupleSize_t ROOT::Experimental::Detail::RPageSource::GetNElements(ColumnHandle_t columnHandle)
 {
    return GetSharedDescriptorGuard()->GetNElements(columnHandle.fPhysicalId);
@@ -349,6 +380,7 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
       RClusterDescriptor::RPageRange pageRange;
       pageRange.fPhysicalColumnId = i;
       fOpenPageRanges.emplace_back(std::move(pageRange));
+      fOpenPrevOffsets.emplace_back(0);
    }
 
    fSerializationContext = Internal::RNTupleSerializer::SerializeHeaderV1(nullptr, descriptor);
@@ -361,12 +393,26 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 
 void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
-   fOpenColumnRanges.at(columnHandle.fPhysicalId).fNElements += page.GetNElements();
+   auto &columnRange = fOpenColumnRanges.at(columnHandle.fPhysicalId);
+   auto &pageInfos = fOpenPageRanges.at(columnHandle.fPhysicalId).fPageInfos;
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
-   pageInfo.fLocator = CommitPageImpl(columnHandle, page);
-   fOpenPageRanges.at(columnHandle.fPhysicalId).fPageInfos.emplace_back(pageInfo);
+   RColumn::StatisticsFunc_t statisticsFunc = nullptr;
+   if (GetWriteOptions().GetEnablePageStatistics())
+      statisticsFunc = columnHandle.fColumn->GetStatisticsFunc();
+   if (statisticsFunc) {
+      // Offsets are cluster-local, so the first collection of a cluster starts at zero
+      auto &prevOffset = fOpenPrevOffsets.at(columnHandle.fPhysicalId);
+      if (columnRange.fNElements == 0)
+         prevOffset = 0;
+      statisticsFunc(page, prevOffset, pageInfo.fStatistics);
+   }
+   columnRange.fNElements += page.GetNElements();
+   // The page info is registered before calling into the concrete sink so that decorators such as RPageSinkBuf can
+   // pass on the page statistics
+   pageInfos.emplace_back(pageInfo);
+   pageInfos.back().fLocator = CommitPageImpl(columnHandle, page);
 }
 
 void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
@@ -377,6 +423,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fStatistics = sealedPage.fStatistics;
    pageInfo.fLocator = CommitSealedPageImpl(physicalColumnId, sealedPage);
    fOpenPageRanges.at(physicalColumnId).fPageInfos.emplace_back(pageInfo);
 }
@@ -403,6 +450,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(std::span<RPageSto
 
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->fNElements;
+         pageInfo.fStatistics = sealedPageIt->fStatistics;
          pageInfo.fLocator = locators[i++];
          fOpenPageRanges.at(range.fPhysicalColumnId).fPageInfos.emplace_back(pageInfo);
       }
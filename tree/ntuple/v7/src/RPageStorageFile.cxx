@@ -31,6 +31,7 @@
 #include <TError.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
@@ -43,6 +44,57 @@
 #include <thread>
 #include <queue>
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/// An on-disk page map whose pages point into the memory mapped file.  The mapping itself is owned by the page
+/// source.  The page map announces the byte ranges of its pages to the kernel as soon as the cluster is scheduled
+/// for loading and releases the resident memory again when the cluster is evicted from the cluster pool.
+class ROnDiskPageMapMmap : public ROOT::Experimental::Detail::ROnDiskPageMap {
+public:
+   using Range_t = std::pair<unsigned char *, std::size_t>;
+
+private:
+   std::vector<Range_t> fRanges;
+
+#ifndef _WIN32
+   static void Advise(const Range_t &range, int advice)
+   {
+      static const std::uintptr_t szPageBitmap = sysconf(_SC_PAGESIZE) - 1;
+      const auto begin = reinterpret_cast<std::uintptr_t>(range.first) & ~szPageBitmap;
+      const auto end = reinterpret_cast<std::uintptr_t>(range.first) + range.second;
+      // Errors are ignored, the advice is merely a hint
+      madvise(reinterpret_cast<void *>(begin), end - begin, advice);
+   }
+#endif
+
+public:
+   explicit ROnDiskPageMapMmap(std::vector<Range_t> ranges) : fRanges(std::move(ranges))
+   {
+#ifndef _WIN32
+      for (const auto &r : fRanges)
+         Advise(r, MADV_WILLNEED);
+#endif
+   }
+   ROnDiskPageMapMmap(const ROnDiskPageMapMmap &other) = delete;
+   ROnDiskPageMapMmap &operator=(const ROnDiskPageMapMmap &other) = delete;
+   ~ROnDiskPageMapMmap() override
+   {
+#ifndef _WIN32
+      // The mapping is read-only, so dropped pages are transparently faulted in again from the file in case
+      // other clusters or zero-copy pages still refer to them
+      for (const auto &r : fRanges)
+         Advise(r, MADV_DONTNEED);
+#endif
+   }
+};
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntupleName,
    const RNTupleWriteOptions &options)
    : RPageSink(ntupleName, options)
@@ -209,15 +261,30 @@ void ROOT::Experimental::Detail::RPageAllocatorFile::DeletePage(const RPage& pag
 ////////////////////////////////////////////////////////////////////////////////
 
 
+ROOT::Experimental::Detail::RPageSourceFile::RMappedFile::RMappedFile(std::shared_ptr<ROOT::Internal::RRawFile> file)
+   : fFile(file), fSize(file->GetSize())
+{
+   std::uint64_t mapdOffset;
+   fBase = static_cast<unsigned char *>(fFile->Map(fSize, 0, mapdOffset));
+   R__ASSERT(mapdOffset == 0);
+}
+
+ROOT::Experimental::Detail::RPageSourceFile::RMappedFile::~RMappedFile()
+{
+   fFile->Unmap(fBase, fSize);
+}
+
+
 ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view ntupleName,
    const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options)
    , fPageAllocator(std::make_unique<RPageAllocatorFile>())
    , fPagePool(std::make_shared<RPagePool>())
-   , fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+   , fClusterPool(std::make_unique<RClusterPool>(*this, options))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceFile");
+   fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
 }
 
 
@@ -271,6 +338,9 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
 
    auto ntplDesc = fDescriptorBuilder.MoveDescriptor();
 
+   if (fOptions.GetUseMmap() && !fMappedFile && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap))
+      fMappedFile = std::make_shared<RMappedFile>(fFile);
+
    for (const auto &cgDesc : ntplDesc.GetClusterGroupIterable()) {
       auto buffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLength());
       auto zipBuffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLocator().fBytesOnStorage);
@@ -326,7 +396,11 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
    const void *sealedPageBuffer = nullptr; // points either to directReadBuffer or to a read-only page in the cluster
    std::unique_ptr<unsigned char []> directReadBuffer; // only used if cluster pool is turned off
 
-   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
+   if (fMappedFile && (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff)) {
+      fCounters->fNPageLoaded.Inc();
+      fCounters->fSzReadPayload.Add(bytesOnStorage);
+      sealedPageBuffer = fMappedFile->fBase + pageInfo.fLocator.GetPosition<std::uint64_t>();
+   } else if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
       directReadBuffer = std::make_unique<unsigned char[]>(bytesOnStorage);
       fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
       fCounters->fNPageLoaded.Inc();
@@ -348,21 +422,36 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       sealedPageBuffer = onDiskPage->GetAddress();
    }
 
-   std::unique_ptr<unsigned char []> pageBuffer;
-   {
-      RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
-      fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
+   RPage newPage;
+   RPageDeleter pageDeleter;
+   const bool isZeroCopy = fMappedFile && element->IsMappable() &&
+                           (bytesOnStorage == element->GetPackedSize(pageInfo.fNElements)) &&
+                           (reinterpret_cast<std::uintptr_t>(sealedPageBuffer) % elementSize == 0);
+   if (isZeroCopy) {
+      // Uncompressed pages of mappable columns are served directly from the memory mapped file.  The page deleter
+      // keeps the mapping alive as long as the page is in use.
+      newPage = fPageAllocator->NewPage(columnId, const_cast<void *>(sealedPageBuffer), elementSize,
+                                        pageInfo.fNElements);
+      pageDeleter = RPageDeleter(
+         [](const RPage & /*page*/, void *userData) { delete static_cast<std::shared_ptr<RMappedFile> *>(userData); },
+         new std::shared_ptr<RMappedFile>(fMappedFile));
+   } else {
+      std::unique_ptr<unsigned char []> pageBuffer;
+      {
+         RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+         pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
+         fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
+      }
+      newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), elementSize, pageInfo.fNElements);
+      pageDeleter = RPageDeleter([](const RPage &page, void * /*userData*/)
+      {
+         RPageAllocatorFile::DeletePage(page);
+      }, nullptr);
    }
 
-   auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), elementSize, pageInfo.fNElements);
    newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
                      RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
-   fPagePool->RegisterPage(newPage,
-      RPageDeleter([](const RPage &page, void * /*userData*/)
-      {
-         RPageAllocatorFile::DeletePage(page);
-      }, nullptr));
+   fPagePool->RegisterPage(newPage, pageDeleter);
    fCounters->fNPagePopulated.Inc();
    return newPage;
 }
@@ -530,16 +619,33 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    fCounters->fSzReadOverhead.Add(szOverhead);
 
    // Register the on disk pages in a page map
-   auto buffer = new unsigned char[reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize];
-   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer));
-   for (const auto &s : onDiskPages) {
-      ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
-      pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
+   std::unique_ptr<ROnDiskPageMap> pageMap;
+   if (fMappedFile) {
+      // The coalesced read requests are not issued; they are turned into the byte ranges that are announced to the
+      // kernel for the memory mapped file
+      std::vector<ROnDiskPageMapMmap::Range_t> ranges;
+      for (auto i = currentReadRequestIdx; i < readRequests.size(); ++i) {
+         if (readRequests[i].fSize > 0)
+            ranges.emplace_back(fMappedFile->fBase + readRequests[i].fOffset, readRequests[i].fSize);
+      }
+      readRequests.resize(currentReadRequestIdx);
+      pageMap = std::make_unique<ROnDiskPageMapMmap>(std::move(ranges));
+      for (const auto &s : onDiskPages) {
+         ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
+         pageMap->Register(key, ROnDiskPage(fMappedFile->fBase + s.fOffset, s.fSize));
+      }
+   } else {
+      auto buffer = new unsigned char[reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize];
+      pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer));
+      for (const auto &s : onDiskPages) {
+         ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
+         pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
+      }
+      for (auto i = currentReadRequestIdx; i < readRequests.size(); ++i) {
+         readRequests[i].fBuffer = buffer + reinterpret_cast<intptr_t>(readRequests[i].fBuffer);
+      }
    }
    fCounters->fNPageLoaded.Add(onDiskPages.size());
-   for (auto i = currentReadRequestIdx; i < readRequests.size(); ++i) {
-      readRequests[i].fBuffer = buffer + reinterpret_cast<intptr_t>(readRequests[i].fBuffer);
-   }
 
    auto cluster = std::make_unique<RCluster>(clusterKey.fClusterId);
    cluster->Adopt(std::move(pageMap));
@@ -561,6 +667,8 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
    }
 
    auto nReqs = readRequests.size();
+   if (nReqs == 0)
+      return clusters;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
       fFile->ReadV(&readRequests[0], nReqs);
@@ -571,6 +679,61 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
    return clusters;
 }
 
+void ROOT::Experimental::Detail::RPageSourceFile::LoadClustersIncrementally(std::span<RCluster::RKey> clusterKeys,
+                                                                            const ClusterCallback_t &callback)
+{
+   if (!(fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasAsyncIo)) {
+      RPageSource::LoadClustersIncrementally(clusterKeys, callback);
+      return;
+   }
+
+   fCounters->fNClusterLoaded.Add(clusterKeys.size());
+
+   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>> clusters;
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   // For every read request, the index of the cluster it belongs to
+   std::vector<std::size_t> requestToCluster;
+   // Number of outstanding read requests per cluster
+   std::vector<std::size_t> nPending;
+
+   for (std::size_t i = 0; i < clusterKeys.size(); ++i) {
+      const auto nReqsBefore = readRequests.size();
+      clusters.emplace_back(PrepareSingleCluster(clusterKeys[i], readRequests));
+      nPending.emplace_back(readRequests.size() - nReqsBefore);
+      requestToCluster.resize(readRequests.size(), i);
+   }
+
+   // Clusters without read requests are complete right away
+   for (std::size_t i = 0; i < clusters.size(); ++i) {
+      if (nPending[i] == 0)
+         callback(i, std::move(clusters[i]));
+   }
+
+   auto nReqs = readRequests.size();
+   if (nReqs == 0)
+      return;
+   {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+      fFile->SubmitReadV(&readRequests[0], nReqs);
+   }
+   fCounters->fNReadV.Inc();
+   fCounters->fNRead.Add(nReqs);
+
+   std::size_t nCompleted = 0;
+   while (nCompleted < nReqs) {
+      std::vector<ROOT::Internal::RRawFile::RIOVec *> completed;
+      {
+         RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+         completed = fFile->ReapReadV(1);
+      }
+      nCompleted += completed.size();
+      for (auto req : completed) {
+         const auto idxCluster = requestToCluster[req - &readRequests[0]];
+         if (--nPending[idxCluster] == 0)
+            callback(idxCluster, std::move(clusters[idxCluster]));
+      }
+   }
+}
 
 void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *cluster)
 {
@@ -2,7 +2,9 @@
 #define ROOT7_RNTuple_Test_CustomStruct
 
 #include <cstdint>
+#include <map>
 #include <string>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
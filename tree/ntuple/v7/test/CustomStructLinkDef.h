@@ -27,6 +27,9 @@
 #pragma link C++ class StructUsingCollectionProxy<StructUsingCollectionProxy<float>> + ;
 #pragma link C++ class StructUsingCollectionProxy<int> + ;
 
+#pragma link C++ class std::map<std::string, float>+;
+#pragma link C++ class std::unordered_map<std::int32_t, double>+;
+
 #pragma link C++ class TrivialTraitsBase + ;
 #pragma link C++ class TrivialTraits + ;
 #pragma link C++ class TransientTraits + ;
@@ -14,8 +14,10 @@
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -55,6 +57,8 @@ public:
    /// Records the cluster IDs requests by LoadClusters() calls
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RCluster::ColumnSet_t> fReqsColumns;
+   /// Simulates storage latency
+   std::chrono::milliseconds fLoadDelay{0};
 
    RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
       ROOT::Experimental::RNTupleDescriptorBuilder descBuilder;
@@ -78,6 +82,8 @@ public:
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final
    {
       std::vector<std::unique_ptr<RCluster>> result;
+      if (fLoadDelay.count() > 0)
+         std::this_thread::sleep_for(fLoadDelay);
       for (auto key : clusterKeys) {
          fReqsClusterIds.emplace_back(key.fClusterId);
          fReqsColumns.emplace_back(key.fPhysicalColumnSet);
@@ -281,6 +287,45 @@ TEST(ClusterPool, GetClusterIncrementally)
 }
 
 
+TEST(ClusterPool, AdaptiveBunchSize)
+{
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetUseAdaptiveClusterBunchSize(true);
+   options.SetMaxClusterBunchSize(4);
+
+   // The reader consumes clusters much faster than the storage delivers them: the bunch size must grow
+   RPageSourceMock p1;
+   p1.fLoadDelay = std::chrono::milliseconds(20);
+   RClusterPool c1(p1, options);
+   EXPECT_EQ(1U, c1.GetClusterBunchSize());
+   for (unsigned i = 0; i <= 5; ++i)
+      c1.GetCluster(i, {0});
+   c1.WaitForInFlightClusters();
+   EXPECT_GT(c1.GetClusterBunchSize(), 1U);
+   EXPECT_LE(c1.GetClusterBunchSize(), 4U);
+   EXPECT_GT(c1.GetMetrics().GetCounter("RClusterPool.nStall")->GetValueAsInt(), 0);
+
+   // A memory budget that holds only two clusters pins the bunch size to one
+   options.SetClusterPoolMemoryBudget(2);
+   RPageSourceMock p2;
+   p2.fLoadDelay = std::chrono::milliseconds(20);
+   RClusterPool c2(p2, options);
+   for (unsigned i = 0; i <= 5; ++i)
+      c2.GetCluster(i, {0});
+   c2.WaitForInFlightClusters();
+   EXPECT_EQ(1U, c2.GetClusterBunchSize());
+
+   // Without the adaptive mode, the bunch size is fixed
+   RPageSourceMock p3;
+   p3.fLoadDelay = std::chrono::milliseconds(20);
+   RClusterPool c3(p3, 1);
+   for (unsigned i = 0; i <= 5; ++i)
+      c3.GetCluster(i, {0});
+   c3.WaitForInFlightClusters();
+   EXPECT_EQ(1U, c3.GetClusterBunchSize());
+}
+
+
 TEST(PageStorageFile, LoadClusters)
 {
    FileRaii fileGuard("test_pagestoragefile_loadclusters.root");
@@ -340,3 +385,53 @@ TEST(PageStorageFile, LoadClusters)
    EXPECT_EQ(1U, clusters[1]->GetId());
    EXPECT_EQ(1U, clusters[1]->GetNOnDiskPages());
 }
+
+
+TEST(PageStorageFile, Mmap)
+{
+   FileRaii fileGuard("test_pagestoragefile_mmap.root");
+
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::int32_t>("tag");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto writer = ROOT::Experimental::RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(),
+                                                                options);
+      for (int i = 0; i < 1000; ++i) {
+         *wrPt = i;
+         *wrTag = -i;
+         writer->Fill();
+         if (i % 100 == 99)
+            writer->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache :
+        {ROOT::Experimental::RNTupleReadOptions::kOn, ROOT::Experimental::RNTupleReadOptions::kOff}) {
+      ROOT::Experimental::RNTupleReadOptions options;
+      options.SetUseMmap(true);
+      options.SetClusterCache(clusterCache);
+      auto reader = ROOT::Experimental::RNTupleReader::Open("myNTuple", fileGuard.GetPath(), options);
+      reader->EnableMetrics();
+      auto viewPt = reader->GetView<float>("pt");
+      auto viewTag = reader->GetView<std::int32_t>("tag");
+      for (auto i : reader->GetEntryRange()) {
+         EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+         EXPECT_EQ(-static_cast<std::int32_t>(i), viewTag(i));
+      }
+      // Uncompressed pages of mappable columns are not copied unless they are misaligned in the file
+      std::int64_t szCopied = 0;
+      for (const auto &clusterDesc : reader->GetDescriptor()->GetClusterIterable()) {
+         for (auto columnId : clusterDesc.GetColumnIds()) {
+            for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+               if (pageInfo.fLocator.GetPosition<std::uint64_t>() % sizeof(float) != 0)
+                  szCopied += pageInfo.fNElements * sizeof(float);
+            }
+         }
+      }
+      EXPECT_EQ(szCopied, reader->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.szUnzip")->GetValueAsInt());
+      EXPECT_GT(reader->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPagePopulated")->GetValueAsInt(), 0);
+   }
+}
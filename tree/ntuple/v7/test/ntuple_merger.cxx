@@ -79,3 +79,86 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+TEST(RNTupleMerger, MergeSymmetric)
+{
+   FileRaii fileGuard1("test_ntuple_merge_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_out.root");
+
+   // The first input shares the output compression, the second one needs to be recompressed
+   for (auto compression : {505, 0}) {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto fieldTracks = model->MakeField<std::vector<std::int32_t>>("tracks");
+      const auto &path = (compression == 505) ? fileGuard1.GetPath() : fileGuard2.GetPath();
+      RNTupleWriteOptions options;
+      options.SetCompression(compression);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path, options);
+      for (int i = 0; i < 10; ++i) {
+         *fieldPt = (compression == 505) ? i : 10 + i;
+         fieldTracks->assign(i % 3, i);
+         ntuple->Fill();
+         if (i == 4)
+            ntuple->CommitCluster();
+      }
+   }
+
+   {
+      auto source1 = std::make_unique<RPageSourceFile>("ntuple", fileGuard1.GetPath(), RNTupleReadOptions());
+      auto source2 = std::make_unique<RPageSourceFile>("ntuple", fileGuard2.GetPath(), RNTupleReadOptions());
+      std::vector<RPageSource *> sources{source1.get(), source2.get()};
+      RNTupleWriteOptions options;
+      options.SetCompression(505);
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), options);
+
+      RNTupleMerger merger(2);
+      merger.GetMetrics().Enable();
+      merger.Merge(sources, *destination);
+      EXPECT_EQ(2, merger.GetMetrics().GetCounter("RNTupleMerger.nSources")->GetValueAsInt());
+      EXPECT_EQ(4, merger.GetMetrics().GetCounter("RNTupleMerger.nClusters")->GetValueAsInt());
+      EXPECT_GT(merger.GetMetrics().GetCounter("RNTupleMerger.nPageCopied")->GetValueAsInt(), 0);
+      EXPECT_GT(merger.GetMetrics().GetCounter("RNTupleMerger.nPageResealed")->GetValueAsInt(), 0);
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   EXPECT_EQ(20U, ntuple->GetNEntries());
+   EXPECT_EQ(2U, ntuple->GetDescriptor()->GetNClusterGroups());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewTracks = ntuple->GetView<std::vector<std::int32_t>>("tracks");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(std::vector<std::int32_t>(i % 10 % 3, i % 10), viewTracks(i));
+   }
+}
+
+TEST(RNTupleMerger, MergeMismatch)
+{
+   FileRaii fileGuard1("test_ntuple_merge_mismatch_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_mismatch_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_mismatch_out.root");
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard1.GetPath());
+      ntuple->Fill();
+   }
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard2.GetPath());
+      ntuple->Fill();
+   }
+
+   auto source1 = std::make_unique<RPageSourceFile>("ntuple", fileGuard1.GetPath(), RNTupleReadOptions());
+   auto source2 = std::make_unique<RPageSourceFile>("ntuple", fileGuard2.GetPath(), RNTupleReadOptions());
+   std::vector<RPageSource *> sources{source1.get(), source2.get()};
+   auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), RNTupleWriteOptions());
+   RNTupleMerger merger;
+   try {
+      merger.Merge(sources, *destination);
+      FAIL() << "merging ntuples with different schemas should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("column type mismatch"));
+   }
+}
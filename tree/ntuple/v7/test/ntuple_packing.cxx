@@ -30,7 +30,10 @@ using PackingIntTypes = ::testing::Types<Helper<std::int64_t, ROOT::Experimental
                                          Helper<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>,
                                          Helper<std::uint32_t, ROOT::Experimental::EColumnType::kSplitInt32>,
                                          Helper<std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>,
-                                         Helper<std::uint16_t, ROOT::Experimental::EColumnType::kSplitInt16>>;
+                                         Helper<std::uint16_t, ROOT::Experimental::EColumnType::kSplitInt16>,
+                                         Helper<std::int64_t, ROOT::Experimental::EColumnType::kSplitZigzagInt64>,
+                                         Helper<std::int32_t, ROOT::Experimental::EColumnType::kSplitZigzagInt32>,
+                                         Helper<std::int16_t, ROOT::Experimental::EColumnType::kSplitZigzagInt16>>;
 TYPED_TEST_CASE(PackingInt, PackingIntTypes);
 
 using PackingRealTypes = ::testing::Types<Helper<double, ROOT::Experimental::EColumnType::kSplitReal64>,
@@ -88,6 +91,44 @@ TEST(Packing, RColumnSwitch)
    EXPECT_EQ(0x55, s2.GetTag());
 }
 
+TEST(Packing, SplitIndex32)
+{
+   using ClusterSize_t = ROOT::Experimental::ClusterSize_t;
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex32> element(
+      nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   std::array<ClusterSize_t, 5> mem{ClusterSize_t{7}, ClusterSize_t{7}, ClusterSize_t{9}, ClusterSize_t{0x10009},
+                                    ClusterSize_t{0xffffffff}};
+   std::array<std::uint32_t, 5> packed;
+   std::array<ClusterSize_t, 5> cmp;
+
+   element.Pack(packed.data(), mem.data(), 5);
+   // Deltas 7, 0, 2, 0x10000, 0xfffefff6 in split encoding
+   unsigned char expPacked[] = {0x07, 0x00, 0x02, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xff,
+                                0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xff};
+   EXPECT_EQ(memcmp(packed.data(), expPacked, sizeof(expPacked)), 0);
+
+   element.Unpack(cmp.data(), packed.data(), 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(mem[i], cmp[i]);
+   }
+}
+
+TEST(Packing, SplitZigzag)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitZigzagInt32>
+      element(nullptr);
+
+   std::array<std::int32_t, 4> mem{0, -1, 1, -2};
+   std::array<std::int32_t, 4> packed;
+   element.Pack(packed.data(), mem.data(), 4);
+   unsigned char expPacked[] = {0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00,
+                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+   EXPECT_EQ(memcmp(packed.data(), expPacked, sizeof(expPacked)), 0);
+}
+
 TYPED_TEST(PackingReal, SplitReal)
 {
    using Pod_t = typename TestFixture::Helper_t::Pod_t;
@@ -154,6 +195,7 @@ TEST(Packing, OnDiskEncoding)
    AddField<std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>(*model, "int16");
    AddField<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>(*model, "int32");
    AddField<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>(*model, "int64");
+   AddField<std::int32_t, ROOT::Experimental::EColumnType::kSplitZigzagInt32>(*model, "zigzag");
    AddField<float, ROOT::Experimental::EColumnType::kSplitReal32>(*model, "float");
    AddField<double, ROOT::Experimental::EColumnType::kSplitReal64>(*model, "double");
    {
@@ -165,6 +207,7 @@ TEST(Packing, OnDiskEncoding)
       *e->Get<std::int16_t>("int16") = 1;
       *e->Get<std::int32_t>("int32") = 0x00010203;
       *e->Get<std::int64_t>("int64") = 0x0001020304050607L;
+      *e->Get<std::int32_t>("zigzag") = 1;
       *e->Get<float>("float") = std::nextafterf(1.f, 2.f); // 0 01111111 00000000000000000000001 == 0x3f800001
       *e->Get<double>("double") = std::nextafter(1., 2.);  // 0x3ff0 0000 0000 0001
 
@@ -173,6 +216,7 @@ TEST(Packing, OnDiskEncoding)
       *e->Get<std::int16_t>("int16") = -2;
       *e->Get<std::int32_t>("int32") = 0x04050607;
       *e->Get<std::int64_t>("int64") = 0x08090a0b0c0d0e0fL;
+      *e->Get<std::int32_t>("zigzag") = -2;
       *e->Get<float>("float") = std::nextafterf(1.f, 0.f);            // 0 01111110 11111111111111111111111 = 0x3f7fffff
       *e->Get<double>("double") = std::numeric_limits<double>::max(); // 0x7fef ffff ffff ffff
 
@@ -203,6 +247,10 @@ TEST(Packing, OnDiskEncoding)
                                0x03, 0x0b, 0x02, 0x0a, 0x01, 0x09, 0x00, 0x08};
    EXPECT_EQ(memcmp(sealedPage.fBuffer, expInt64, sizeof(expInt64)), 0);
 
+   source->LoadSealedPage(fnGetColumnId("zigzag"), RClusterIndex(0, 0), sealedPage);
+   unsigned char expZigzag[] = {0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+   EXPECT_EQ(memcmp(sealedPage.fBuffer, expZigzag, sizeof(expZigzag)), 0);
+
    source->LoadSealedPage(fnGetColumnId("float"), RClusterIndex(0, 0), sealedPage);
    unsigned char expFloat[] = {0x01, 0xff, 0x00, 0xff, 0x80, 0x7f, 0x3f, 0x3f};
    EXPECT_EQ(memcmp(sealedPage.fBuffer, expFloat, sizeof(expFloat)), 0);
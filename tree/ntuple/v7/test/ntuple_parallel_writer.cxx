@@ -0,0 +1,88 @@
+#include "ntuple_test.hxx"
+
+#include <thread>
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_basics.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   model->MakeField<std::vector<std::int32_t>>("tracks");
+
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto context = writer->CreateFillContext();
+      auto entry = context->CreateEntry();
+      *entry->Get<float>("pt") = 1.0;
+      entry->Get<std::vector<std::int32_t>>("tracks")->assign({1, 2, 3});
+      context->Fill(*entry);
+      context->CommitCluster();
+      *entry->Get<float>("pt") = 2.0;
+      entry->Get<std::vector<std::int32_t>>("tracks")->clear();
+      context->Fill(*entry);
+      EXPECT_EQ(2U, context->GetNEntries());
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(2U, reader->GetNEntries());
+   EXPECT_EQ(2U, reader->GetDescriptor()->GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewTracks = reader->GetView<std::vector<std::int32_t>>("tracks");
+   EXPECT_FLOAT_EQ(1.0, viewPt(0));
+   EXPECT_EQ(std::vector<std::int32_t>({1, 2, 3}), viewTracks(0));
+   EXPECT_FLOAT_EQ(2.0, viewPt(1));
+   EXPECT_TRUE(viewTracks(1).empty());
+}
+
+TEST(RNTupleParallelWriter, MultiThreaded)
+{
+   FileRaii fileGuard("test_ntuple_parallel_mt.root");
+
+   constexpr int kNThreads = 4;
+   constexpr int kNEntriesPerThread = 10000;
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<std::int32_t>("thread");
+   model->MakeField<std::int32_t>("index");
+   model->MakeField<std::vector<std::int32_t>>("values");
+
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t] {
+            auto context = writer->CreateFillContext();
+            auto entry = context->CreateEntry();
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *entry->Get<std::int32_t>("thread") = t;
+               *entry->Get<std::int32_t>("index") = i;
+               entry->Get<std::vector<std::int32_t>>("values")->assign(i % 5, t);
+               context->Fill(*entry);
+               if (i % 1000 == 999)
+                  context->CommitCluster();
+            }
+         });
+      }
+      for (auto &t : threads)
+         t.join();
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), reader->GetNEntries());
+   auto viewThread = reader->GetView<std::int32_t>("thread");
+   auto viewIndex = reader->GetView<std::int32_t>("index");
+   auto viewValues = reader->GetView<std::vector<std::int32_t>>("values");
+   // The clusters of the threads interleave, but the entries of every thread are in fill order
+   std::vector<std::int32_t> nextIndex(kNThreads, 0);
+   for (auto i : reader->GetEntryRange()) {
+      auto t = viewThread(i);
+      ASSERT_GE(t, 0);
+      ASSERT_LT(t, kNThreads);
+      EXPECT_EQ(nextIndex[t], viewIndex(i));
+      EXPECT_EQ(std::vector<std::int32_t>(nextIndex[t] % 5, t), viewValues(i));
+      nextIndex[t]++;
+   }
+   for (auto n : nextIndex)
+      EXPECT_EQ(kNEntriesPerThread, n);
+}
@@ -9,6 +9,8 @@ public:
       size_t fNCommitSealedPage = 0;
       size_t fNCommitSealedPageV = 0;
    } fCounters{};
+   /// Pretend that the sink is shared by several writers, as the one of RNTupleParallelWriter
+   bool fIsShared = false;
 
 protected:
    RPageAllocatorHeap fPageAllocator{};
@@ -46,6 +48,7 @@ protected:
 
 public:
    RPageSinkMock(const ROOT::Experimental::RNTupleWriteOptions &options) : RPageSink("test", options) {}
+   bool IsShared() const final { return fIsShared; }
 };
 } // namespace
 
@@ -120,6 +123,79 @@ TEST(RNTuple, Extended)
    EXPECT_EQ(chksumRead, chksumWrite);
 }
 
+TEST(RNTuple, PageStatistics)
+{
+   FileRaii fileGuard("test_ntuple_page_statistics.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrId = model->MakeField<std::int32_t>("id");
+   auto wrJets = model->MakeField<std::vector<float>>("jets");
+   {
+      RNTupleWriteOptions options;
+      options.SetEnablePageStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (std::int32_t i = 0; i < 30; ++i) {
+         *wrId = i;
+         wrJets->assign(i / 10, static_cast<float>(i));
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   const auto *desc = ntuple->GetDescriptor();
+   const auto idColumnId = desc->FindPhysicalColumnId(desc->FindFieldId("id"), 0);
+   const auto jetsColumnId = desc->FindPhysicalColumnId(desc->FindFieldId("jets"), 0);
+
+   const auto &idStats0 = desc->GetClusterDescriptor(desc->FindClusterId(idColumnId, 0)).GetColumnRange(idColumnId);
+   EXPECT_TRUE(idStats0.fStatistics.IsValid());
+   EXPECT_EQ(0., idStats0.fStatistics.fMin);
+   EXPECT_EQ(9., idStats0.fStatistics.fMax);
+   const auto &jetsStats0 = desc->GetClusterDescriptor(0).GetColumnRange(jetsColumnId).fStatistics;
+   EXPECT_EQ(0., jetsStats0.fMin);
+   EXPECT_EQ(0., jetsStats0.fMax);
+   EXPECT_EQ(10u, jetsStats0.fNEmpty);
+   const auto &jetsStats2 = desc->GetClusterDescriptor(2).GetColumnRange(jetsColumnId).fStatistics;
+   EXPECT_EQ(2., jetsStats2.fMin);
+   EXPECT_EQ(2., jetsStats2.fMax);
+   EXPECT_EQ(0u, jetsStats2.fNEmpty);
+
+   auto ranges = ntuple->GetEntryRanges("id", 12, 15);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(10u, *ranges[0].begin());
+   EXPECT_EQ(20u, *ranges[0].end());
+   EXPECT_TRUE(ntuple->GetEntryRanges("id", 30, 40).empty());
+   // Adjacent clusters are merged
+   ranges = ntuple->GetEntryRanges("jets", 1, 10);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(10u, *ranges[0].begin());
+   EXPECT_EQ(30u, *ranges[0].end());
+   // Values in collections cannot be used to skip entries
+   ranges = ntuple->GetEntryRanges("jets._0", 100, 200);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(0u, *ranges[0].begin());
+   EXPECT_EQ(30u, *ranges[0].end());
+   EXPECT_THROW(ntuple->GetEntryRanges("nonexistent", 0, 1), RException);
+
+   // Without statistics, no cluster can be skipped
+   model = RNTupleModel::Create();
+   wrId = model->MakeField<std::int32_t>("id");
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (std::int32_t i = 0; i < 30; ++i) {
+         *wrId = i;
+         writer->Fill();
+         if (i % 10 == 9)
+            writer->CommitCluster();
+      }
+   }
+   ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   ranges = ntuple->GetEntryRanges("id", 30, 40);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(30u, *ranges[0].end());
+}
+
 TEST(RNTuple, InvalidWriteOptions) {
    RNTupleWriteOptions options;
    try {
@@ -437,6 +513,23 @@ TEST(RPageSinkBuf, CommitSealedPageV)
       EXPECT_EQ(0, counters.fNCommitSealedPage);
       EXPECT_EQ(0, counters.fNCommitSealedPageV);
    }
+   {
+      std::unique_ptr<RPageSink> sink(new RPageSinkMock(options));
+      static_cast<RPageSinkMock *>(sink.get())->fIsShared = true;
+      auto &counters = static_cast<RPageSinkMock *>(sink.get())->fCounters;
+
+      auto model = RNTupleModel::Create();
+      auto u32Field = model->MakeField<std::uint32_t>("u32");
+      auto u16Field = model->MakeField<std::uint16_t>("u16");
+      auto ntuple = std::make_unique<RNTupleWriter>(std::move(model), std::make_unique<RPageSinkBuf>(std::move(sink)));
+      ntuple->Fill();
+      ntuple->Fill();
+      ntuple->CommitCluster();
+      // Shared sink: the pages are sealed by the filling thread, before the cluster is committed under the sink guard
+      EXPECT_EQ(0, counters.fNCommitPage);
+      EXPECT_EQ(0, counters.fNCommitSealedPage);
+      EXPECT_EQ(1, counters.fNCommitSealedPageV);
+   }
    ROOT::EnableImplicitMT();
    {
       std::unique_ptr<RPageSink> sink(new RPageSinkMock(options));
@@ -206,6 +206,192 @@ TEST(RNTuple, StdTuple)
    }
 }
 
+TEST(RNTuple, StdMap)
+{
+   auto field = RField<std::map<std::string, float>>("mapField");
+   EXPECT_STREQ("std::map<std::string,float>", field.GetType().c_str());
+   auto otherField = RFieldBase::Create("test", "std::map<std::string, float>").Unwrap();
+   EXPECT_STREQ(field.GetType().c_str(), otherField->GetType().c_str());
+   EXPECT_EQ((sizeof(std::map<std::string, float>)), field.GetValueSize());
+   EXPECT_EQ((sizeof(std::map<std::string, float>)), otherField->GetValueSize());
+
+   FileRaii fileGuard("test_ntuple_rfield_stdmap.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto mapField = model->MakeField<std::map<std::string, float>>("myMap");
+      auto unorderedMapField = model->MakeField<std::unordered_map<std::int32_t, double>>("myUnorderedMap");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "map_ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 3; i++) {
+         mapField->clear();
+         unorderedMapField->clear();
+         for (int j = 0; j < i; ++j) {
+            (*mapField)["key" + std::to_string(j)] = i + j;
+            (*unorderedMapField)[j] = 2. * j;
+         }
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("map_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(3, ntuple->GetNEntries());
+
+   auto viewMap = ntuple->GetView<std::map<std::string, float>>("myMap");
+   auto viewUnorderedMap = ntuple->GetView<std::unordered_map<std::int32_t, double>>("myUnorderedMap");
+   // Keys and values are stored in the columns of the pair item field
+   auto viewKeys = ntuple->GetView<std::string>("myMap._0._0");
+   auto viewValues = ntuple->GetView<float>("myMap._0._1");
+   for (auto i : ntuple->GetEntryRange()) {
+      const auto &m = viewMap(i);
+      ASSERT_EQ(i, m.size());
+      for (unsigned j = 0; j < i; ++j) {
+         EXPECT_FLOAT_EQ(static_cast<float>(i + j), m.at("key" + std::to_string(j)));
+      }
+      const auto &um = viewUnorderedMap(i);
+      ASSERT_EQ(i, um.size());
+      for (unsigned j = 0; j < i; ++j) {
+         EXPECT_DOUBLE_EQ(2. * j, um.at(j));
+      }
+   }
+   EXPECT_EQ("key0", viewKeys(0));
+   EXPECT_FLOAT_EQ(1.0, viewValues(0));
+
+   // std::map<char, std::int16_t> has no dictionary: its TClass only has an emulated collection proxy
+   try {
+      RFieldBase::Create("noDictionary", "std::map<char, std::int16_t>").Unwrap();
+      FAIL() << "maps without dictionary should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("emulated collection proxy"));
+   }
+}
+
+TEST(RNTuple, StdSet)
+{
+   auto field = RField<std::set<std::int64_t>>("setField");
+   EXPECT_STREQ("std::set<std::int64_t>", field.GetType().c_str());
+   auto otherField = RFieldBase::Create("test", "std::set<int64_t>").Unwrap();
+   EXPECT_STREQ(field.GetType().c_str(), otherField->GetType().c_str());
+
+   FileRaii fileGuard("test_ntuple_rfield_stdset.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto setField = model->MakeField<std::set<std::int64_t>>("mySet");
+      auto unorderedSetField = model->MakeField<std::unordered_set<std::string>>("myUnorderedSet");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "set_ntuple", fileGuard.GetPath());
+      *setField = {3, 1, 2};
+      *unorderedSetField = {"a", "b"};
+      ntuple->Fill();
+      setField->clear();
+      unorderedSetField->clear();
+      ntuple->Fill();
+   }
+
+   auto ntuple = RNTupleReader::Open("set_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(2, ntuple->GetNEntries());
+   auto viewSet = ntuple->GetView<std::set<std::int64_t>>("mySet");
+   auto viewUnorderedSet = ntuple->GetView<std::unordered_set<std::string>>("myUnorderedSet");
+   EXPECT_EQ((std::set<std::int64_t>{1, 2, 3}), viewSet(0));
+   EXPECT_EQ((std::unordered_set<std::string>{"a", "b"}), viewUnorderedSet(0));
+   EXPECT_TRUE(viewSet(1).empty());
+   EXPECT_TRUE(viewUnorderedSet(1).empty());
+}
+
+TEST(RNTuple, StdOptional)
+{
+   auto field = RField<std::optional<std::string>>("optionalField");
+   EXPECT_STREQ("std::optional<std::string>", field.GetType().c_str());
+   auto otherField = RFieldBase::Create("test", "std::optional<std::string>").Unwrap();
+   EXPECT_STREQ(field.GetType().c_str(), otherField->GetType().c_str());
+   EXPECT_EQ((sizeof(std::optional<std::string>)), field.GetValueSize());
+   EXPECT_EQ((sizeof(std::optional<std::string>)), otherField->GetValueSize());
+   EXPECT_EQ((sizeof(std::optional<char>)), RField<std::optional<char>>("c").GetValueSize());
+   EXPECT_EQ((sizeof(std::optional<double>)), RField<std::optional<double>>("d").GetValueSize());
+
+   FileRaii fileGuard("test_ntuple_rfield_stdoptional.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto optField = model->MakeField<std::optional<std::string>>("myOptional");
+      auto optVecField = model->MakeField<std::optional<std::vector<float>>>("myOptionalVec");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "optional_ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 4; i++) {
+         if (i % 2 == 0) {
+            *optField = std::to_string(i);
+            *optVecField = std::vector<float>(i, 1.0);
+         } else {
+            optField->reset();
+            optVecField->reset();
+         }
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("optional_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(4, ntuple->GetNEntries());
+   auto viewOptional = ntuple->GetView<std::optional<std::string>>("myOptional");
+   auto viewOptionalVec = ntuple->GetView<std::optional<std::vector<float>>>("myOptionalVec");
+   auto viewItems = ntuple->GetView<std::string>("myOptional._0");
+   for (auto i : ntuple->GetEntryRange()) {
+      if (i % 2 == 0) {
+         ASSERT_TRUE(viewOptional(i).has_value());
+         EXPECT_EQ(std::to_string(i), viewOptional(i).value());
+         ASSERT_TRUE(viewOptionalVec(i).has_value());
+         EXPECT_EQ(std::vector<float>(i, 1.0), viewOptionalVec(i).value());
+      } else {
+         EXPECT_FALSE(viewOptional(i).has_value());
+         EXPECT_FALSE(viewOptionalVec(i).has_value());
+      }
+   }
+   // Only the engaged values are stored
+   unsigned nItems = 0;
+   for (auto i : viewItems.GetFieldRange()) {
+      EXPECT_EQ(std::to_string(2 * i), viewItems(i));
+      nItems++;
+   }
+   EXPECT_EQ(2U, nItems);
+}
+
+TEST(RNTuple, UniquePtr)
+{
+   auto field = RField<std::unique_ptr<CustomStruct>>("ptrField");
+   EXPECT_STREQ("std::unique_ptr<CustomStruct>", field.GetType().c_str());
+   auto otherField = RFieldBase::Create("test", "std::unique_ptr<CustomStruct>").Unwrap();
+   EXPECT_STREQ(field.GetType().c_str(), otherField->GetType().c_str());
+   EXPECT_EQ((sizeof(std::unique_ptr<CustomStruct>)), field.GetValueSize());
+
+   FileRaii fileGuard("test_ntuple_rfield_uniqueptr.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto ptrField = model->MakeField<std::unique_ptr<float>>("myPtr");
+      auto ptrVecField = model->MakeField<std::vector<std::unique_ptr<std::int32_t>>>("myPtrVec");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "uniqueptr_ntuple", fileGuard.GetPath());
+      *ptrField = std::make_unique<float>(1.0);
+      ptrVecField->emplace_back(std::make_unique<std::int32_t>(42));
+      ptrVecField->emplace_back(nullptr);
+      ntuple->Fill();
+      ptrField->reset();
+      ptrVecField->clear();
+      ntuple->Fill();
+      *ptrField = std::make_unique<float>(3.0);
+      ntuple->Fill();
+   }
+
+   auto ntuple = RNTupleReader::Open("uniqueptr_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(3, ntuple->GetNEntries());
+   auto viewPtr = ntuple->GetView<std::unique_ptr<float>>("myPtr");
+   auto viewPtrVec = ntuple->GetView<std::vector<std::unique_ptr<std::int32_t>>>("myPtrVec");
+   ASSERT_TRUE(viewPtr(0));
+   EXPECT_FLOAT_EQ(1.0, *viewPtr(0));
+   EXPECT_FALSE(viewPtr(1));
+   ASSERT_TRUE(viewPtr(2));
+   EXPECT_FLOAT_EQ(3.0, *viewPtr(2));
+
+   const auto &ptrVec = viewPtrVec(0);
+   ASSERT_EQ(2U, ptrVec.size());
+   ASSERT_TRUE(ptrVec[0]);
+   EXPECT_EQ(42, *ptrVec[0]);
+   EXPECT_FALSE(ptrVec[1]);
+   EXPECT_TRUE(viewPtrVec(1).empty());
+}
+
 TEST(RNTuple, Int64)
 {
    auto field = RFieldBase::Create("test", "std::int64_t").Unwrap();
@@ -132,6 +132,59 @@ TEST(RNTuple, BulkViewCollection)
    }
 }
 
+TEST(RNTuple, BulkRead)
+{
+   FileRaii fileGuard("test_ntuple_bulk_read.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldVec = model->MakeField<std::vector<std::int32_t>>("vec");
+   auto eltsPerPage = 1000;
+   auto nEntries = 10 * eltsPerPage + 17;
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(eltsPerPage * sizeof(float));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < nEntries; i++) {
+         *fieldPt = i;
+         *fieldVec = std::vector<std::int32_t>(i % 3, i);
+         ntuple->Fill();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<std::int32_t>>("vec");
+
+   // Range crossing several page boundaries
+   std::vector<float> pt(3 * eltsPerPage);
+   viewPt.ReadBulk(eltsPerPage / 2, pt.size(), pt.data());
+   for (std::size_t i = 0; i < pt.size(); ++i) {
+      ASSERT_EQ(static_cast<float>(eltsPerPage / 2 + i), pt[i]) << i;
+   }
+
+   // Page-wise zero-copy iteration over the entire field
+   double sum = 0;
+   NTupleSize_t nVisited = 0;
+   while (nVisited < ntuple->GetNEntries()) {
+      auto span = viewPt.MapSpan(nVisited);
+      ASSERT_FALSE(span.empty());
+      EXPECT_LE(span.size(), static_cast<std::size_t>(eltsPerPage));
+      for (auto v : span)
+         sum += v;
+      nVisited += span.size();
+   }
+   EXPECT_EQ(static_cast<NTupleSize_t>(nEntries), nVisited);
+   EXPECT_DOUBLE_EQ(static_cast<double>(nEntries) * (nEntries - 1) / 2, sum);
+
+   // Non-mappable fields are deserialized into the caller's objects
+   std::vector<std::vector<std::int32_t>> vec(5);
+   viewVec.ReadBulk(nEntries - 5, vec.size(), vec.data());
+   for (std::size_t i = 0; i < vec.size(); ++i) {
+      std::int32_t entry = nEntries - 5 + i;
+      EXPECT_EQ(std::vector<std::int32_t>(entry % 3, entry), vec[i]);
+   }
+}
+
 TEST(RNTuple, Composable)
 {
    FileRaii fileGuard("test_ntuple_composable.root");
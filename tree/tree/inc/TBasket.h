@@ -95,11 +95,12 @@ public:
    // in the fIOBits -- then the zombie flag will be set for this object.
    //
    enum class EIOBits : Char_t {
-      // The following to bits are reserved for now; when supported, set
-      // kSupported = kGenerateOffsetMap | kBasketClassMap
+      // The following bit is reserved for now; when supported, set
+      // kSupported = kGenerateOffsetMap | kZstdDictionary | kBasketClassMap
       kGenerateOffsetMap = BIT(0),
-      // kBasketClassMap = BIT(1),
-      kSupported = kGenerateOffsetMap
+      kZstdDictionary = BIT(1),
+      // kBasketClassMap = BIT(2),
+      kSupported = kGenerateOffsetMap | kZstdDictionary
    };
    // This enum covers IOBits that are known to this ROOT release but
    // not supported; provides a mechanism for us to have experimental
@@ -108,7 +109,7 @@ public:
    // (kUnsupported | kSupported) should result in the '|' of all IOBits.
    enum class EUnsupportedIOBits : Char_t { kUnsupported = 0 };
    // The number of known, defined IOBits.
-   static constexpr int kIOBitCount = 1;
+   static constexpr int kIOBitCount = 2;
 
    TBasket();
    TBasket(TDirectory *motherDir);
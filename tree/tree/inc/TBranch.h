@@ -31,6 +31,8 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -50,6 +52,7 @@ class TBulkBranchRead;
 }
 namespace Internal {
 class TBranchIMTHelper; ///< A helper class for managing IMT work during TTree:Fill operations.
+class RZSTDDictionary;
 }
 }
 
@@ -73,7 +76,9 @@ public:
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
+   Int_t GetEntriesWithOffsets(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
    Bool_t SupportsBulkRead() const;
+   Bool_t SupportsBulkReadWithOffsets(EDataType *type = nullptr);
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -90,6 +95,7 @@ class TBranch : public TNamed, public TAttFill {
    using TIOFeatures = ROOT::TIOFeatures;
 
 protected:
+   friend class TBasket;
    friend class TTreeCache;
    friend class TTreeCloner;
    friend class TTree;
@@ -143,6 +149,12 @@ protected:
    char       *fAddress;          ///<! Address of 1st leaf (variable or object)
    TDirectory *fDirectory;        ///<! Pointer to directory where this branch buffers are stored
    TString     fFileName;         ///<  Name of file where buffers are stored ("" if in same file as Tree header)
+   Int_t       fCompressionDictionarySize{0};   ///<  Size of fCompressionDictionary
+   char       *fCompressionDictionary{nullptr}; ///<[fCompressionDictionarySize] zstd dictionary trained from the first baskets
+   ROOT::Internal::RZSTDDictionary *fZSTDDictionary{nullptr}; ///<! Digested fCompressionDictionary
+   std::vector<char>   fDictionarySamples;       ///<! Content of the first baskets, to train the compression dictionary
+   std::vector<size_t> fDictionarySampleSizes;   ///<! Size of each basket in fDictionarySamples
+   Bool_t      fSkipDictionaryTraining{kFALSE};  ///<! The baskets of this branch are not suited for a dictionary
    TBuffer    *fEntryBuffer;      ///<! Buffer used to directly pass the content without streaming
    TBuffer    *fTransientBuffer;  ///<! Pointer to the current transient buffer.
    TList      *fBrowsables;       ///<! List of TVirtualBranchBrowsables used for Browse()
@@ -173,6 +185,8 @@ protected:
    TString  GetRealFileName() const;
 
    virtual void SetAddressImpl(void *addr, Bool_t /* implied */) { SetAddress(addr); }
+   virtual Bool_t GetBulkReadLayout(EDataType &type, TClass *&headerClass);
+   const ROOT::Internal::RZSTDDictionary *UpdateCompressionDictionary(const char *buffer, Int_t len, Int_t cxlevel);
 
 private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
@@ -180,8 +194,10 @@ private:
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
+   Int_t    GetEntriesWithOffsets(Long64_t, TBuffer&, std::vector<Int_t>&);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
+   void     SetCompressionDictionary(const char *content, Int_t size);
    TBranch(const TBranch&) = delete;             // not implemented
    TBranch& operator=(const TBranch&) = delete;  // not implemented
 
@@ -217,6 +233,8 @@ public:
            Int_t     GetCompressionAlgorithm() const;
            Int_t     GetCompressionLevel() const;
            Int_t     GetCompressionSettings() const;
+   const ROOT::Internal::RZSTDDictionary *GetCompressionDictionary() const {return fZSTDDictionary;}
+           Int_t     GetCompressionDictionarySize() const {return fCompressionDictionarySize;}
    TDirectory       *GetDirectory() const {return fDirectory;}
    virtual Int_t     GetEntry(Long64_t entry=0, Int_t getall = 0);
    virtual Int_t     GetEntryExport(Long64_t entry, Int_t getall, TClonesArray *list, Int_t n);
@@ -283,12 +301,13 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree; }
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+           Bool_t    SupportsBulkReadWithOffsets(EDataType *type = nullptr);
    virtual void      UpdateAddress() {}
    virtual void      UpdateFile();
 
    static  void      ResetCount();
 
-   ClassDefOverride(TBranch, 13); // Branch descriptor
+   ClassDefOverride(TBranch, 14); // Branch descriptor
 };
 
 //______________________________________________________________________________
@@ -316,7 +335,9 @@ namespace Internal {
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
+inline Int_t  TBulkBranchRead::GetEntriesWithOffsets(Long64_t evt, TBuffer& user_buf, std::vector<Int_t>& offsets) { return fParent.GetEntriesWithOffsets(evt, user_buf, offsets); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Bool_t TBulkBranchRead::SupportsBulkReadWithOffsets(EDataType *type) { return fParent.SupportsBulkReadWithOffsets(type); }
 
 }  // Internal
 }  // Experimental
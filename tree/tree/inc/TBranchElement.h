@@ -116,6 +116,7 @@ protected:
    virtual void             InitInfo();
    Bool_t                   IsMissingCollection() const;
    TStreamerInfo           *FindOnfileInfo(TClass *valueClass, const TObjArray &branches) const;
+   Bool_t                   GetBulkReadLayout(EDataType &type, TClass *&headerClass) override;
    TClass                  *GetParentClass(); // Class referenced by fParentName
    TStreamerInfo           *GetInfoImp() const;
    void                     ReleaseObject();
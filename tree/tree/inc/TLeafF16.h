@@ -38,7 +38,7 @@ public:
    TLeafF16(TBranch *parent, const char *name, const char *type);
    virtual ~TLeafF16();
 
-   DeserializeType GetDeserializeType() const override { return DeserializeType::kExternal; }
+   DeserializeType GetDeserializeType() const override { return DeserializeType::kInPlace; }
    void            Export(TClonesArray *list, Int_t n) override;
    void            FillBasket(TBuffer &b) override;
    const char     *GetTypeName() const override { return "Float16_t"; }
@@ -47,6 +47,8 @@ public:
    void            Import(TClonesArray *list, Int_t n) override;
    void            PrintValue(Int_t i = 0) const override;
    void            ReadBasket(TBuffer &b) override;
+   bool            ReadBasketFast(TBuffer &input_buf, Long64_t N) override;
+   bool            ReadBasketSerialized(TBuffer &, Long64_t) override { return false; }
    void            ReadBasketExport(TBuffer &b, TClonesArray *list, Int_t n) override;
    void            ReadValue(std::istream &s, Char_t delim = ' ') override;
    void            SetAddress(void *add = nullptr) override;
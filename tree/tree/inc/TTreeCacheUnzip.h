@@ -43,7 +43,7 @@ public:
    enum EUnzipState { kUntouched, kProgress, kFinished };
 
 protected:
-   // Unzipping state for baskets
+   // Unzipping state for baskets, indexed by the position of the basket in the sorted list of prefetched blocks
    struct UnzipState {
       // Note: we cannot use std::unique_ptr<std::unique_ptr<char[]>[]> or vector of unique_ptr
       // for fUnzipChunks since std::unique_ptr is not copy constructable.
@@ -79,8 +79,7 @@ protected:
 
    // Members for paral. managing
    Bool_t      fAsyncReading;
-   Bool_t      fEmpty;
-   Int_t       fCycle;
+   std::atomic<Int_t> fCycle;     ///<! Incremented whenever the cache content is invalidated, stops the unzip tasks
    Bool_t      fParallel; ///< Indicate if we want to activate the parallelism (for this instance)
 
    std::unique_ptr<TMutex> fIOMutex;
@@ -94,8 +93,20 @@ protected:
 
    // Unzipping related members
    Int_t       fNseekMax;         ///<!  fNseek can change so we need to know its max size
-   Int_t       fUnzipGroupSize;   ///<!  Min accumulated size of a group of baskets ready to be unzipped by a IMT task
-   Long64_t    fUnzipBufferSize;  ///<!  Max Size for the ready unzipped blocks (default is 2*fBufferSize)
+   Int_t       fUnzipGroupSize;   ///<!  Unused, the unzip-ahead window is bounded by fUnzipBufferSize (deprecated)
+   Long64_t    fUnzipBufferSize;  ///<!  Max Size for the ready unzipped blocks (default is fgRelBuffSize*fBufferSize)
+
+   // Unzip-ahead window
+   std::vector<Long64_t> fSeekEntry;    ///<! First entry of each prefetched basket, in the order of fSeek
+   std::vector<TBranch*> fSeekBranch;   ///<! Branch of each prefetched basket, in the order of fSeek
+   std::vector<Int_t> fUnzipOrder;      ///<! Sorted blocks in the order in which the reader needs them
+   std::vector<Int_t> fUnzipOrderPos;   ///<! Position of each sorted block in fUnzipOrder
+   std::atomic<Int_t> fUnzipNext;       ///<! Next position in fUnzipOrder to be unzipped ahead of the reader
+   std::atomic<Long64_t> fUnzipBytes;   ///<! Size of the unzipped blocks not yet handed to the reader
+   std::atomic<Long64_t> fUnzipBytesPeak; ///<! Largest value of fUnzipBytes reserved by the unzip tasks
+   std::atomic<Int_t> fNUnzipTasks;     ///<! Number of running unzip tasks
+   Int_t       fUnzipReadPos;           ///<! Furthest position in fUnzipOrder requested by the reader
+   Int_t       fUnzipEvictPos;          ///<! Position in fUnzipOrder up to which unread blocks were released
 
    static Double_t fgRelBuffSize; ///< This is the percentage of the TTreeCacheUnzip that will be used
 
@@ -103,7 +114,8 @@ protected:
    Int_t       fNFound;           ///<! number of blocks that were found in the cache
    Int_t       fNMissed;          ///<! number of blocks that were not found in the cache and were unzipped
    Int_t       fNStalls;          ///<! number of hits which caused a stall
-   Int_t       fNUnzip;           ///<! number of blocks that were unzipped
+   std::atomic<Int_t> fNUnzip;    ///<! number of blocks that were unzipped
+   Double_t    fStallTime;        ///<! time spent by the reader waiting for blocks being unzipped, in seconds
 
 private:
    TTreeCacheUnzip(const TTreeCacheUnzip &) = delete;
@@ -114,6 +126,15 @@ private:
 
    // Private methods
    void  Init();
+   void  BuildUnzipOrder();
+   void  EvictUnzipped();
+   TBranch *GetSeekBranch(Int_t loc) const;
+   void  MoveUnzipWindow(Int_t loc);
+   Bool_t ReserveUnzipBytes(Long64_t len);
+   void  StopUnzipTasks();
+#ifdef R__USE_IMT
+   void  UnzipAhead(Int_t cycle);
+#endif
 
 public:
    TTreeCacheUnzip();
@@ -139,19 +160,31 @@ public:
 #endif
    Int_t          GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes, Int_t &objlen, Int_t &keylen);
    Int_t          GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_t *free) override;
-   Int_t          GetUnzipGroupSize() { return fUnzipGroupSize; }
+   Int_t          GetUnzipGroupSize()
+      R__DEPRECATED(6, 32, "the unzip-ahead window is bounded by the unzip buffer size, see GetUnzipBufferSize()")
+   {
+      return fUnzipGroupSize;
+   }
+   Long64_t       GetUnzipBufferSize() const { return fUnzipBufferSize; }
    void           ResetCache() override;
    Int_t          SetBufferSize(Int_t buffersize) override;
    void           SetUnzipBufferSize(Long64_t bufferSize);
-   void           SetUnzipGroupSize(Int_t groupSize) { fUnzipGroupSize = groupSize; }
+   void           SetUnzipGroupSize(Int_t groupSize)
+      R__DEPRECATED(6, 32, "the unzip-ahead window is bounded by the unzip buffer size, see SetUnzipBufferSize()")
+   {
+      fUnzipGroupSize = groupSize;
+   }
    static void    SetUnzipRelBufferSize(Float_t relbufferSize);
-   Int_t          UnzipBuffer(char **dest, char *src);
-   Int_t          UnzipCache(Int_t index);
+   Int_t          UnzipBuffer(char **dest, char *src, TBranch *branch = nullptr);
+   Int_t          UnzipCache(Int_t index, Long64_t reservedLen = 0);
 
    // Methods to get stats
    Int_t  GetNUnzip() { return fNUnzip; }
    Int_t  GetNMissed(){ return fNMissed; }
    Int_t  GetNFound() { return fNFound; }
+   Int_t  GetNStalls() { return fNStalls; }
+   Double_t GetStallTime() { return fStallTime; }
+   Long64_t GetUnzipBytesPeak() const { return fUnzipBytesPeak; }
 
    void Print(Option_t* option = "") const override;
 
@@ -33,6 +33,7 @@ class TTreeCloner {
 
    Bool_t     fIsValid;
    Bool_t     fNeedConversion;   ///< True if the fast merge is not possible but a slow merge might possible.
+   Bool_t     fNeedRecompression; ///< True if the baskets must be recompressed, e.g. for a different zstd dictionary.
    UInt_t     fOptions;
    TTree     *fFromTree;
    TTree     *fToTree;
@@ -119,6 +120,7 @@ public:
    Bool_t Exec();
    Bool_t IsValid() { return fIsValid; }
    Bool_t NeedConversion() { return fNeedConversion; }
+   Bool_t NeedRecompression() { return fNeedRecompression; }
    void   SetCacheSize(Int_t size);
    void   SortBaskets();
    void   WriteBaskets();
@@ -25,6 +25,7 @@
 #include "TTimeStamp.h"
 #include "ROOT/TIOFeatures.hxx"
 #include "RZip.h"
+#include "ZipZSTD.h"
 
 #include <bitset>
 
@@ -618,7 +619,17 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
             goto AfterBuffer;
          }
 
-         R__unzip(&nin, rawCompressedObjectBuffer, &nbuf, (unsigned char*) rawUncompressedObjectBuffer, &nout);
+         if (R__unlikely(ROOT::Internal::RZSTDDictionary::IsDictionaryHeader(rawCompressedObjectBuffer))) {
+            auto dictionary = fBranch->GetCompressionDictionary();
+            if (!dictionary) {
+               Error("ReadBasketBuffers", "Basket of branch %s was compressed with a dictionary that is not available",
+                     fBranch->GetName());
+               break;
+            }
+            dictionary->Unzip(&nin, rawCompressedObjectBuffer, &nbuf, (unsigned char*) rawUncompressedObjectBuffer, &nout);
+         } else {
+            R__unzip(&nin, rawCompressedObjectBuffer, &nbuf, (unsigned char*) rawUncompressedObjectBuffer, &nout);
+         }
          if (!nout) break;
          noutot += nout;
          nintot += nin;
@@ -1217,6 +1228,18 @@ Int_t TBasket::WriteBuffer()
    if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kInherit)
       cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(file->GetCompressionAlgorithm());
    if (cxlevel > 0) {
+      const ROOT::Internal::RZSTDDictionary *dictionary = nullptr;
+      if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTD &&
+          (fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kZstdDictionary))) {
+         // Like the compression below, training the dictionary only touches this basket's branch.
+#ifdef R__USE_IMT
+         sentry.unlock();
+#endif  // R__USE_IMT
+         dictionary = fBranch->UpdateCompressionDictionary(fBufferRef->Buffer() + fKeylen, fObjlen, cxlevel);
+#ifdef R__USE_IMT
+         sentry.lock();
+#endif  // R__USE_IMT
+      }
       Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
       Int_t buflen = fKeylen + fObjlen + 9 * nbuffers + 28; //add 28 bytes in case object is placed in a deleted gap
       InitializeCompressedBuffer(buflen, file);
@@ -1242,7 +1265,10 @@ Int_t TBasket::WriteBuffer()
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
          // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
          // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+         if (dictionary)
+            dictionary->Zip(&bufmax, objbuf, &bufmax, bufcur, &nout);
+         else
+            R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
 #ifdef R__USE_IMT
          sentry.lock();
 #endif  // R__USE_IMT
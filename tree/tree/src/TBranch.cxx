@@ -52,7 +52,9 @@
 #include "TBranchIMTHelper.h"
 
 #include "ROOT/TIOFeatures.hxx"
+#include "ZipZSTD.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
@@ -464,6 +466,11 @@ TBranch::~TBranch()
    delete [] fBasketBytes;
    fBasketBytes = 0;
 
+   delete [] fCompressionDictionary;
+   fCompressionDictionary = nullptr;
+   delete fZSTDDictionary;
+   fZSTDDictionary = nullptr;
+
    if (fExtraBasket && !fBaskets.Remove(fExtraBasket))
       delete fExtraBasket;
    fBaskets.Delete();
@@ -1595,7 +1602,10 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
 
    Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
    //Info("GetEntriesSerialized", "Requesting %d events; fNextBasketEntry=%lld; first=%lld.\n", N, fNextBasketEntry, first);
-
+   if (R__unlikely(!leaf->ReadBasketSerialized(user_buf, N))) {
+      Error("GetEntriesSerialized", "Leaf failed to read.\n");
+      return -1;
+   }
    user_buf.SetBufferOffset(bufbegin);
 
    if (count_buf) {
@@ -1630,6 +1640,192 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
    return N;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Describe how the entries of this branch are laid out in its baskets, for
+/// GetEntriesWithOffsets(); returns false if the values of the entries cannot be
+/// deserialized in place.
+///
+/// On success, `type` is the type of the values. If `headerClass` is not null,
+/// each entry starts with the version of this (collection) class followed by the
+/// number of values; otherwise the entries are made only of their values.
+
+Bool_t TBranch::GetBulkReadLayout(EDataType &type, TClass *&headerClass)
+{
+   headerClass = nullptr;
+   if (fNleaves != 1)
+      return kFALSE;
+   TLeaf *leaf = static_cast<TLeaf *>(fLeaves.UncheckedAt(0));
+   if (leaf->GetDeserializeType() == TLeaf::DeserializeType::kExternal)
+      return kFALSE;
+   TClass *expectedClass = nullptr;
+   if (GetExpectedType(expectedClass, type) || expectedClass)
+      return kFALSE;
+   // Float16_t and Double32_t are stored in a compressed form that is only decoded by GetBulkEntries().
+   if (type == kFloat16_t || type == kDouble32_t)
+      return kFALSE;
+   return TDataType::GetDataType(type) != nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if GetEntriesWithOffsets() can be used on this branch, i.e. if
+/// the branch holds a single leaf of a fundamental type (possibly a variable-size
+/// array or a data member of a split collection) or a collection of a fundamental
+/// type such as `std::vector<float>`. As for SupportsBulkRead(), the read may still
+/// fail depending on the contents of the individual TBaskets.
+/// If `type` is not null, it is set to the type of the values.
+
+Bool_t TBranch::SupportsBulkReadWithOffsets(EDataType *type)
+{
+   EDataType valueType = kOther_t;
+   TClass *headerClass = nullptr;
+   const Bool_t supported = GetBulkReadLayout(valueType, headerClass);
+   if (type)
+      *type = valueType;
+   return supported;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read all the entries of the basket starting at `entry` into the given buffer,
+/// storing the values of all the entries contiguously and deserialized.
+///
+/// This is the counterpart of GetBulkEntries() for branches with a variable number
+/// of values per entry: C-style variable-size arrays (`x[n]/F`), data members of
+/// split STL collections and TClonesArrays, and collections of fundamental types.
+///
+/// Returns -1 in case of a failure; in particular `entry` must be the first entry of
+/// a basket. On success, returns the number N of entries read. The values are then
+///
+/// reinterpret_cast<T*>(user_buf.GetCurrent())
+///
+/// where T is the type of the values; `offsets` holds N + 1 elements and the values
+/// of entry `entry + i` are those from index `offsets[i]` to `offsets[i + 1]`
+/// (excluded). The values start at an 8-byte boundary.
+
+Int_t TBranch::GetEntriesWithOffsets(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   EDataType type;
+   TClass *headerClass = nullptr;
+   if (R__unlikely(!GetBulkReadLayout(type, headerClass))) {
+      return -1;
+   }
+   const Int_t valueSize = TDataType::GetDataType(type)->Size();
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   Bool_t enabled = !TestBit(kDoNotProcess);
+   if (R__unlikely(!enabled)) { return -1; }
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result < 0)) { return -1; }
+   // Only support reading from full clusters.
+   if (R__unlikely(entry != first)) {
+      if (fCurrentBasket == nullptr) {
+         // The basket was read into user_buf, which does not hold any useful data; keep it for the next read.
+         fExtraBasket = basket;
+         basket->DisownBuffer();
+      }
+      return -1;
+   }
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetEntriesWithOffsets", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetEntriesWithOffsets", "Basket has displacement.\n");
+      return -1;
+   }
+
+   // End of the data of the last entry.
+   Int_t last = basket->GetLast();
+   if (&user_buf != buf) {
+      // The basket was already in memory and might (and might not) be backed by persistent
+      // storage.
+      R__ASSERT(result == fReadBasket);
+      if (fBasketSeek[fReadBasket]) {
+         // It is backed, so we can be destructive
+         user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
+         buf->ResetBit(TBufferIO::kIsOwner);
+         fCurrentBasket = nullptr;
+         fBaskets[fReadBasket] = nullptr;
+      } else {
+         // This is the only copy, we can't return it as is to the user, just make a copy.
+         // The basket is still being filled: its data ends at the current position.
+         last = buf->Length();
+         if (user_buf.BufferSize() < buf->BufferSize()) {
+            user_buf.AutoExpand(buf->BufferSize());
+         }
+         memcpy(user_buf.Buffer(), buf->Buffer(), buf->BufferSize());
+      }
+   }
+
+   if (fCurrentBasket == nullptr) {
+      R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+      fExtraBasket = basket;
+      basket->DisownBuffer();
+   }
+
+   const Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+   const Int_t keylen = basket->GetKeylen();
+   const Int_t *entryOffset = basket->GetEntryOffset();
+   const Int_t entrySize = basket->GetNevBufSize();
+   if (R__unlikely(!entryOffset && entrySize <= 0)) {
+      Error("GetEntriesWithOffsets", "Cannot determine the entry boundaries in branch %s.\n", GetName());
+      return -1;
+   }
+
+   // The values of each entry are moved down next to those of the previous entry, over the entry headers (if any);
+   // the key is not needed anymore, so the values start at the 8-byte boundary preceding it.
+   char *data = user_buf.Buffer();
+   const Int_t valuesBegin = keylen & ~7;
+   Int_t out = valuesBegin;
+   Int_t nvalues = 0;
+   offsets.resize(N + 1);
+   offsets[0] = 0;
+   for (Int_t i = 0; i < N; ++i) {
+      Int_t begin = entryOffset ? entryOffset[i] : keylen + i * entrySize;
+      const Int_t end = entryOffset ? ((i + 1 < N) ? entryOffset[i + 1] : last) : begin + entrySize;
+      if (headerClass) {
+         user_buf.SetBufferOffset(begin);
+         Version_t version = user_buf.ReadVersion(nullptr, nullptr, headerClass);
+         Int_t n = 0;
+         user_buf >> n;
+         begin = user_buf.Length();
+         if (R__unlikely((version & TBufferFile::kStreamedMemberWise) || n < 0 || begin + n * valueSize != end)) {
+            Error("GetEntriesWithOffsets", "Unexpected layout of entry %lld in branch %s.\n", first + i, GetName());
+            return -1;
+         }
+      }
+      const Int_t nbytes = end - begin;
+      if (R__unlikely(nbytes < 0 || nbytes % valueSize)) {
+         Error("GetEntriesWithOffsets", "Unexpected size of entry %lld in branch %s.\n", first + i, GetName());
+         return -1;
+      }
+      memmove(data + out, data + begin, nbytes);
+      out += nbytes;
+      nvalues += nbytes / valueSize;
+      offsets[i + 1] = nvalues;
+   }
+
+   // ByteSwapBuffer only cares about the size of the values.
+   user_buf.SetBufferOffset(valuesBegin);
+   EDataType swapType = (valueSize == 2) ? kShort_t : ((valueSize == 4) ? kInt_t : kLong64_t);
+   if (R__unlikely(valueSize > 1 && !user_buf.ByteSwapBuffer(nvalues, swapType))) {
+      Error("GetEntriesWithOffsets", "Failed to deserialize the values of branch %s.\n", GetName());
+      return -1;
+   }
+   user_buf.SetBufferOffset(valuesBegin);
+
+   return N;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read all leaves of entry and return total number of bytes read.
 ///
@@ -2745,6 +2941,26 @@ void TBranch::SetCompressionLevel(Int_t level)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Replace the compression dictionary of this branch, e.g. when its baskets are
+/// copied from a branch that was compressed with a dictionary.
+
+void TBranch::SetCompressionDictionary(const char *content, Int_t size)
+{
+   delete [] fCompressionDictionary;
+   fCompressionDictionary = nullptr;
+   delete fZSTDDictionary;
+   fZSTDDictionary = nullptr;
+   fCompressionDictionarySize = size;
+   if (size > 0) {
+      fCompressionDictionary = new char[size];
+      memcpy(fCompressionDictionary, content, size);
+      fZSTDDictionary = new ROOT::Internal::RZSTDDictionary(fCompressionDictionary, fCompressionDictionarySize, 0);
+   }
+   std::vector<char>().swap(fDictionarySamples);
+   std::vector<size_t>().swap(fDictionarySampleSizes);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set compression settings.
 
@@ -2950,6 +3166,11 @@ void TBranch::Streamer(TBuffer& b)
 
          }
          if (!fSplitLevel && fBranches.GetEntriesFast()) fSplitLevel = 1;
+         // Digest the compression dictionary once, rather than for each basket.
+         delete fZSTDDictionary;
+         fZSTDDictionary = nullptr;
+         if (fCompressionDictionarySize > 0)
+            fZSTDDictionary = new ROOT::Internal::RZSTDDictionary(fCompressionDictionary, fCompressionDictionarySize, 0);
          gROOT->SetReadingObject(kFALSE);
          if (IsA() == TBranch::Class()) {
             if (fNleaves == 0) {
@@ -3242,6 +3463,62 @@ void TBranch::SetupAddresses()
    SetAddress(nullptr); // in some cases, this triggers setting of the address
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the zstd dictionary to compress a basket of this branch with, training it first if needed.
+///
+/// Used for branches with the ROOT::Experimental::EIOFeatures::kZstdDictionary IO feature.
+/// The content of the first baskets, \p buffer of \p len bytes, is collected until there is
+/// enough of it to train a dictionary; the baskets written until then are compressed without
+/// dictionary. The dictionary is stored with the branch metadata, such that readers digest it
+/// once when reading the TTree header. A branch with large baskets, or whose baskets do not
+/// yield a dictionary, is compressed without dictionary. Returns nullptr in that case or while
+/// the dictionary is being trained.
+
+const ROOT::Internal::RZSTDDictionary *TBranch::UpdateCompressionDictionary(const char *buffer, Int_t len, Int_t cxlevel)
+{
+   // Baskets larger than this compress well enough on their own.
+   constexpr std::size_t kMaxSampleSize = 64 * 1024;
+   // Train once this much basket content, or this many baskets, have been collected.
+   constexpr std::size_t kTrainingSize = 256 * 1024;
+   constexpr std::size_t kTrainingBaskets = 128;
+   // The dictionary is part of the TTree header, keep it small.
+   constexpr std::size_t kMaxDictionarySize = 16 * 1024;
+
+   if (!fCompressionDictionary) {
+      if (fSkipDictionaryTraining)
+         return nullptr;
+      if (static_cast<std::size_t>(len) > kMaxSampleSize) {
+         fSkipDictionaryTraining = kTRUE;
+         std::vector<char>().swap(fDictionarySamples);
+         std::vector<size_t>().swap(fDictionarySampleSizes);
+         return nullptr;
+      }
+      fDictionarySamples.insert(fDictionarySamples.end(), buffer, buffer + len);
+      fDictionarySampleSizes.push_back(len);
+      if (fDictionarySamples.size() < kTrainingSize && fDictionarySampleSizes.size() < kTrainingBaskets)
+         return nullptr;
+
+      std::vector<char> content(std::min(kMaxDictionarySize, fDictionarySamples.size() / 10));
+      auto size = ROOT::Internal::RZSTDDictionary::Train(content.data(), content.size(), fDictionarySamples.data(),
+                                                         fDictionarySampleSizes.data(), fDictionarySampleSizes.size());
+      std::vector<char>().swap(fDictionarySamples);
+      std::vector<size_t>().swap(fDictionarySampleSizes);
+      if (size == 0) {
+         fSkipDictionaryTraining = kTRUE;
+         return nullptr;
+      }
+      fCompressionDictionarySize = size;
+      fCompressionDictionary = new char[size];
+      memcpy(fCompressionDictionary, content.data(), size);
+   }
+
+   if (!fZSTDDictionary || fZSTDDictionary->GetCompressionLevel() != cxlevel) {
+      delete fZSTDDictionary;
+      fZSTDDictionary = new ROOT::Internal::RZSTDDictionary(fCompressionDictionary, fCompressionDictionarySize, cxlevel);
+   }
+   return fZSTDDictionary->IsValid() ? fZSTDDictionary : nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Refresh the value of fDirectory (i.e. where this branch writes/reads its buffers)
 /// with the current value of fTree->GetCurrentFile unless this branch has been
@@ -2797,6 +2797,37 @@ Int_t TBranchElement::GetEntry(Long64_t entry, Int_t getall)
    return nbytes;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// In addition to what TBranch::GetBulkReadLayout() supports, unsplit vectors of
+/// a fundamental type (e.g. `std::vector<float>`) can be read in bulk, whether
+/// they are stored in a top-level branch or are a data member of a split object.
+
+Bool_t TBranchElement::GetBulkReadLayout(EDataType &type, TClass *&headerClass)
+{
+   // Arrays pointed to by a data member are preceded by a flag in each entry.
+   if (fStreamerType >= TVirtualStreamerInfo::kOffsetP && fStreamerType < TVirtualStreamerInfo::kObject)
+      return kFALSE;
+   if (TBranch::GetBulkReadLayout(type, headerClass))
+      return kTRUE;
+   headerClass = nullptr;
+   if (fType != 0 || fNleaves != 1 || fBranches.GetEntriesFast())
+      return kFALSE;
+   TClass *expectedClass = nullptr;
+   if (GetExpectedType(expectedClass, type) || !expectedClass)
+      return kFALSE;
+   TVirtualCollectionProxy *proxy = expectedClass->GetCollectionProxy();
+   if (!proxy || proxy->GetValueClass() || proxy->HasPointers())
+      return kFALSE;
+   if (proxy->GetCollectionType() != ROOT::kSTLvector && proxy->GetCollectionType() != ROOT::kROOTRVec)
+      return kFALSE;
+   type = proxy->GetType();
+   // Double32_t and Float16_t are not stored as they are represented in memory.
+   if (type == kDouble32_t || type == kFloat16_t || !TDataType::GetDataType(type))
+      return kFALSE;
+   headerClass = expectedClass;
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill expectedClass and expectedType with information on the data type of the
 /// object/values contained in this branch (and thus the type of pointers
@@ -20,7 +20,9 @@ A TLeaf for a 24 bit truncated floating point data type.
 #include "TBuffer.h"
 #include "TClonesArray.h"
 #include "TStreamerElement.h"
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 ClassImp(TLeafD32);
 
@@ -141,6 +143,28 @@ void TLeafD32::ReadBasket(TBuffer &b)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Deserialize N events from an input buffer.
+/// The doubles are decoded in place: the buffer is expanded if needed since they
+/// take more space in memory than on disk.
+
+bool TLeafD32::ReadBasketFast(TBuffer &input_buf, Long64_t N)
+{
+   if (R__unlikely(fLeafCount)) {
+      return false;
+   }
+   const Int_t n = fLen * N;
+   const Int_t begin = input_buf.Length();
+   std::vector<Double32_t> values(n);
+   input_buf.ReadFastArrayDouble32(values.data(), n, fElement);
+   const Int_t end = begin + n * sizeof(Double32_t);
+   if (end > input_buf.BufferSize())
+      input_buf.AutoExpand(end);
+   memcpy(input_buf.Buffer() + begin, values.data(), n * sizeof(Double32_t));
+   input_buf.SetBufferOffset(begin);
+   return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read leaf elements from Basket input buffer and export buffer to
 /// TClonesArray objects.
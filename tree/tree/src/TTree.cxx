@@ -3576,7 +3576,9 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
             if (cacheSize != -1) cloner.SetCacheSize(cacheSize);
             cloner.Exec();
          } else {
-            if (i == 0) {
+            // Baskets compressed with another zstd dictionary can not be copied as they are, even from the first tree:
+            // they are unzipped and rezipped below.
+            if (i == 0 && !cloner.NeedRecompression()) {
                Warning("CopyEntries","%s",cloner.GetWarning());
                // If the first cloning does not work, something is really wrong
                // (since apriori the source and target are exactly the same structure!)
@@ -16,6 +16,22 @@
 
 A TTreeCache which exploits parallelized decompression of its own content.
 
+Once the baskets of a cluster have been prefetched, tasks running in ROOT's
+task arena (see ROOT::EnableImplicitMT()) unzip them ahead of the reader, in
+the order in which the reader needs them: by first entry of the basket, then
+by position in the file. The unzipped baskets that have not been handed to the
+reader yet are bounded by SetUnzipBufferSize(): a task reserves the unzipped
+size of a basket before unzipping it, such that concurrent tasks never exceed
+the budget, except for a single basket larger than the whole budget, which is
+unzipped ahead only when nothing else is pending. The tasks stop when the
+budget is used up and are restarted as the reader consumes baskets. A basket that is
+not unzipped ahead is unzipped by the reader itself rather than waited for;
+the reader only waits for a basket that a task is unzipping (a stall). The hits,
+misses, stalls, the time spent waiting for a basket being unzipped and the
+largest amount of unzipped bytes reserved by the tasks are available through
+GetNFound(), GetNMissed(), GetNStalls(), GetStallTime(), GetUnzipBytesPeak()
+and Print().
+
 */
 
 #include "TTreeCacheUnzip.h"
@@ -27,9 +43,15 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TMath.h"
 #include "TROOT.h"
 #include "TMutex.h"
+#include "ZipZSTD.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <numeric>
+#include <thread>
 
 #ifdef R__USE_IMT
-#include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
@@ -151,22 +173,28 @@ void TTreeCacheUnzip::UnzipState::SetUnzipped(Int_t index, char* buf, Int_t len)
 Bool_t TTreeCacheUnzip::UnzipState::TryUnzipping(Int_t index) {
    Byte_t oldValue = kUntouched;
    Byte_t newValue = kProgress;
-   return fUnzipStatus[index].compare_exchange_weak(oldValue, newValue, std::memory_order_release, std::memory_order_relaxed);
+   return fUnzipStatus[index].compare_exchange_strong(oldValue, newValue, std::memory_order_acq_rel, std::memory_order_acquire);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
    fAsyncReading(kFALSE),
-   fEmpty(kTRUE),
    fCycle(0),
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
+   fUnzipNext(0),
+   fUnzipBytes(0),
+   fUnzipBytesPeak(0),
+   fNUnzipTasks(0),
+   fUnzipReadPos(0),
+   fUnzipEvictPos(0),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
-   fNUnzip(0)
+   fNUnzip(0),
+   fStallTime(0)
 {
    // Default Constructor.
    Init();
@@ -177,15 +205,21 @@ TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
 
 TTreeCacheUnzip::TTreeCacheUnzip(TTree *tree, Int_t buffersize) : TTreeCache(tree,buffersize),
    fAsyncReading(kFALSE),
-   fEmpty(kTRUE),
    fCycle(0),
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
+   fUnzipNext(0),
+   fUnzipBytes(0),
+   fUnzipBytesPeak(0),
+   fNUnzipTasks(0),
+   fUnzipReadPos(0),
+   fUnzipEvictPos(0),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
-   fNUnzip(0)
+   fNUnzip(0),
+   fStallTime(0)
 {
    Init();
 }
@@ -203,7 +237,7 @@ void TTreeCacheUnzip::Init()
    fCompBuffer = new char[16384];
    fCompBufferSize = 16384;
 
-   fUnzipGroupSize = 102400; // Each task unzips at least 100 KB
+   fUnzipGroupSize = 102400; // Unused, kept for the deprecated GetUnzipGroupSize()
 
    if (fgParallel == kDisable) {
       fParallel = kFALSE;
@@ -281,6 +315,9 @@ Bool_t TTreeCacheUnzip::FillBuffer()
    // the end of the training phase).
    if (fEntryCurrent <= entry  && entry < fEntryNext) return kFALSE;
 
+   // The unzip tasks read from the cache buffer that is about to be refilled.
+   StopUnzipTasks();
+
    // Triggered by the user, not the learning phase
    if (entry == -1)  entry = 0;
 
@@ -307,6 +344,8 @@ Bool_t TTreeCacheUnzip::FillBuffer()
 
    //clear cache buffer
    TFileCacheRead::Prefetch(0,0);
+   fSeekEntry.clear();
+   fSeekBranch.clear();
 
    //store baskets
    for (Int_t i = 0; i < fNbranches; i++) {
@@ -338,6 +377,8 @@ Bool_t TTreeCacheUnzip::FillBuffer()
          fNReadPref++;
 
          TFileCacheRead::Prefetch(pos, len);
+         fSeekEntry.push_back(entries[j]);
+         fSeekBranch.push_back(b);
       }
       if (gDebug > 0) printf("Entry: %lld, registering baskets branch %s, fEntryNext=%lld, fNseek=%d, fNtot=%d\n", entry, ((TBranch*)fBranches->UncheckedAt(i))->GetName(), fEntryNext, fNseek, fNtot);
    }
@@ -358,6 +399,7 @@ Bool_t TTreeCacheUnzip::FillBuffer()
 
 Int_t TTreeCacheUnzip::SetBufferSize(Int_t buffersize)
 {
+   StopUnzipTasks();
    Int_t res = TTreeCache::SetBufferSize(buffersize);
    if (res < 0) {
       return res;
@@ -374,6 +416,7 @@ Int_t TTreeCacheUnzip::SetBufferSize(Int_t buffersize)
 
 void TTreeCacheUnzip::SetEntryRange(Long64_t emin, Long64_t emax)
 {
+   StopUnzipTasks();
    TTreeCache::SetEntryRange(emin, emax);
 }
 
@@ -391,6 +434,7 @@ void TTreeCacheUnzip::StopLearningPhase()
 
 void TTreeCacheUnzip::UpdateBranches(TTree *tree)
 {
+   StopUnzipTasks();
    TTreeCache::UpdateBranches(tree);
 }
 
@@ -501,73 +545,130 @@ Int_t TTreeCacheUnzip::GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes,
 void TTreeCacheUnzip::ResetCache()
 {
    // Reset all the lists and wipe all the chunks
-   fCycle++;
+   StopUnzipTasks();
    fUnzipState.Clear(fNseekMax);
 
-   if(fNseekMax < fNseek){
+   // The order is built again once the new content of the cache is available, see CreateTasks().
+   fUnzipOrder.clear();
+   fUnzipOrderPos.clear();
+   fUnzipNext = 0;
+   fUnzipBytes = 0;
+   fUnzipReadPos = 0;
+   fUnzipEvictPos = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop the unzip tasks and wait for them to return. This has to be called by
+/// the reader before the content of the cache buffer changes.
+
+void TTreeCacheUnzip::StopUnzipTasks()
+{
+   fCycle++;
+#ifdef R__USE_IMT
+   if (fUnzipTaskGroup)
+      fUnzipTaskGroup->Wait();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the branch of the prefetched block at position loc in the sorted
+/// list of blocks, or nullptr if unknown.
+
+TBranch *TTreeCacheUnzip::GetSeekBranch(Int_t loc) const
+{
+   Int_t index = fSeekIndex[loc];
+   return index < (Int_t)fSeekBranch.size() ? fSeekBranch[index] : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Order the prefetched blocks by the first entry of their basket, i.e. in the
+/// order in which a reader going through the entries needs them. Blocks of
+/// baskets starting at the same entry stay in file order.
+
+void TTreeCacheUnzip::BuildUnzipOrder()
+{
+   if (fNseekMax < fNseek) {
       if (gDebug > 0)
-         Info("ResetCache", "Changing fNseekMax from:%d to:%d", fNseekMax, fNseek);
+         Info("BuildUnzipOrder", "Changing fNseekMax from:%d to:%d", fNseekMax, fNseek);
 
       fUnzipState.Reset(fNseekMax, fNseek);
       fNseekMax = fNseek;
    }
-   fEmpty = kTRUE;
+
+   auto firstEntry = [this](Int_t loc) {
+      Int_t index = fSeekIndex[loc];
+      return index < (Int_t)fSeekEntry.size() ? fSeekEntry[index] : std::numeric_limits<Long64_t>::max();
+   };
+   fUnzipOrder.resize(fNseek);
+   std::iota(fUnzipOrder.begin(), fUnzipOrder.end(), 0);
+   std::stable_sort(fUnzipOrder.begin(), fUnzipOrder.end(),
+                    [&firstEntry](Int_t a, Int_t b) { return firstEntry(a) < firstEntry(b); });
+   fUnzipOrderPos.resize(fNseek);
+   for (Int_t i = 0; i < fNseek; ++i)
+      fUnzipOrderPos[fUnzipOrder[i]] = i;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The reader requested the block at position loc in the sorted list of
+/// blocks: make sure the unzip tasks carry on after it rather than working on
+/// blocks the reader is already past.
+
+void TTreeCacheUnzip::MoveUnzipWindow(Int_t loc)
+{
+   Int_t pos = fUnzipOrderPos[loc];
+   if (pos > fUnzipReadPos)
+      fUnzipReadPos = pos;
+   Int_t next = fUnzipNext;
+   while (next <= pos && !fUnzipNext.compare_exchange_weak(next, pos + 1)) {
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the unzipped blocks the reader went past without requesting them,
+/// e.g. for entries it skipped, such that they do not hold the unzip budget.
+/// Should the reader need them after all, it unzips them itself.
+
+void TTreeCacheUnzip::EvictUnzipped()
+{
+   for (; fUnzipEvictPos < fUnzipReadPos; ++fUnzipEvictPos) {
+      Int_t loc = fUnzipOrder[fUnzipEvictPos];
+      if (fUnzipState.IsProgress(loc))
+         break; // A task is still working on it, try again later.
+      if (fUnzipState.IsUnzipped(loc)) {
+         fUnzipBytes -= fUnzipState.fUnzipLen[loc];
+         fUnzipState.SetMissed(loc);
+      }
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// This inflates a basket in the cache.. passing the data to a new
 /// buffer that will only wait there to be read...
+/// The index is the position of the basket in the sorted list of prefetched
+/// blocks; the compressed basket is read directly from the cache buffer, which
+/// does not change while unzip tasks are running (see StopUnzipTasks()).
 /// This function is responsible to update corresponding elements in
 /// fUnzipStatus, fUnzipChunks and fUnzipLen. Since we use atomic variables
 /// in fUnzipStatus to exclusively unzip the basket, we must update
 /// fUnzipStatus after fUnzipChunks and fUnzipLen and make sure fUnzipChunks
 /// and fUnzipLen are ready before main thread fetch the data.
+/// reservedLen is the number of bytes the caller already added to the unzipped
+/// bytes for this basket, see ReserveUnzipBytes(): they are given back if the
+/// basket is not unzipped.
 
-Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
+Int_t TTreeCacheUnzip::UnzipCache(Int_t index, Long64_t reservedLen)
 {
-   Int_t myCycle;
-   const Int_t hlen = 128;
    Int_t objlen = 0, keylen = 0;
    Int_t nbytes = 0;
-   Int_t readbuf = 0;
-
-   Long64_t rdoffs = 0;
-   Int_t rdlen = 0;
-
-   // To synchronize with the 'paging'
-   myCycle = fCycle;
-   rdoffs = fSeek[index];
-   rdlen = fSeekLen[index];
-
-   Int_t loc = -1;
-   if (!fNseek || fIsLearning) {
-      return 1;
-   }
 
-   if ((myCycle != fCycle) || !fIsTransferred)  {
+   if (!fNseek || fIsLearning || !fIsTransferred || fAsyncReading || index >= fNseek) {
+      fUnzipBytes -= reservedLen;
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
       return 1;
    }
 
-   // Prepare a memory buffer of adequate size
-   char* locbuff = 0;
-   if (rdlen > 16384) {
-      locbuff = new char[rdlen];
-   } else if (rdlen * 3 < 16384) {
-      locbuff = new char[rdlen * 2];
-   } else {
-      locbuff = new char[16384];
-   }
-
-   readbuf = ReadBufferExt(locbuff, rdoffs, rdlen, loc);
-
-   if (readbuf <= 0) {
-      fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-      if (locbuff) delete [] locbuff;
-      return -1;
-   }
-
-   GetRecordHeader(locbuff, hlen, nbytes, objlen, keylen);
+   char *locbuff = &fBuffer[fSeekPos[index]];
+   GetRecordHeader(locbuff, fSeekSortLen[index], nbytes, objlen, keylen);
 
    Int_t len = (objlen > nbytes - keylen) ? keylen + objlen : nbytes;
    // If the single unzipped chunk is really too big, reset it to not processable
@@ -575,83 +676,112 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
    // This block will be unzipped synchronously in the main thread
    // TODO: ROOT internally breaks zipped buffers into 16MB blocks, we can probably still unzip in parallel.
    if (len > 4 * fUnzipBufferSize) {
-           if (gDebug > 0)
-                   Info("UnzipCache", "Block %d is too big, skipping.", index);
+      if (gDebug > 0)
+         Info("UnzipCache", "Block %d is too big, skipping.", index);
 
-           fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-           if (locbuff) delete [] locbuff;
-           return 0;
+      fUnzipBytes -= reservedLen;
+      fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
+      return 0;
    }
 
    // Unzip it into a new blk
    char *ptr = nullptr;
-   Int_t loclen = UnzipBuffer(&ptr, locbuff);
+   Int_t loclen = UnzipBuffer(&ptr, locbuff, GetSeekBranch(index));
    if ((loclen > 0) && (loclen == objlen + keylen)) {
-      if ((myCycle != fCycle) || !fIsTransferred) {
-         fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-         if (locbuff) delete [] locbuff;
-         delete [] ptr;
-         return 1;
-      }
+      fUnzipBytes += loclen - reservedLen;
       fUnzipState.SetUnzipped(index, ptr, loclen); // Set it as done
       fNUnzip++;
-   } else {
-      fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-      delete [] ptr;
+      return 0;
    }
 
-   if (locbuff) delete [] locbuff;
-   return 0;
+   fUnzipBytes -= reservedLen;
+   fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
+   delete [] ptr;
+   return -1;
 }
 
 #ifdef R__USE_IMT
 ////////////////////////////////////////////////////////////////////////////////
-/// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
-/// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping
-/// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// Start tasks unzipping the prefetched baskets ahead of the reader, as long as
+/// there are baskets left and the unzipped baskets waiting for the reader fit
+/// in the unzip buffer. There are at most as many tasks as threads in ROOT's
+/// task arena, minus the reader. Called by the reader after every request.
+/// Returns the number of tasks started.
 
 Int_t TTreeCacheUnzip::CreateTasks()
 {
-   auto mapFunction = [&]() {
-      auto unzipFunction = [&](const std::vector<Int_t> &indices) {
-         // If cache is invalidated and we should return immediately.
-         if (!fIsTransferred) return nullptr;
-
-         for (auto ii : indices) {
-            if(fUnzipState.TryUnzipping(ii)) {
-               Int_t res = UnzipCache(ii);
-               if(res)
-                  if (gDebug > 0)
-                     Info("UnzipCache", "Unzipping failed or cache is in learning state");
-            }
-         }
-         return nullptr;
-      };
-
-      Int_t accusz = 0;
-      std::vector<std::vector<Int_t>> basketIndices;
-      std::vector<Int_t> indices;
-      if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
-      for (Int_t i = 0; i < fNseek; i++) {
-         while (accusz < fUnzipGroupSize) {
-            accusz += fSeekLen[i];
-            indices.push_back(i);
-            i++;
-            if (i >= fNseek) break;
-         }
-         if (i < fNseek) i--;
-         basketIndices.push_back(indices);
-         indices.clear();
-         accusz = 0;
-      }
-      ROOT::TThreadExecutor pool;
-      pool.Foreach(unzipFunction, basketIndices);
-   };
+   if (!fParallel || fIsLearning || !fIsTransferred || fAsyncReading || !fNseek || !ROOT::IsImplicitMTEnabled())
+      return 0;
+
+   if (fUnzipOrder.empty())
+      BuildUnzipOrder();
+   if (fUnzipBytes >= fUnzipBufferSize)
+      EvictUnzipped();
+
+   const Int_t maxTasks = std::max(1, (Int_t)ROOT::GetThreadPoolSize() - 1);
+   Int_t nTasks = 0;
+   while (fNUnzipTasks < maxTasks && fUnzipNext < fNseek && fUnzipBytes < fUnzipBufferSize) {
+      if (!fUnzipTaskGroup)
+         fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
+      fNUnzipTasks++;
+      Int_t cycle = fCycle;
+      fUnzipTaskGroup->Run([this, cycle]() { UnzipAhead(cycle); });
+      nTasks++;
+   }
 
-   fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
-   fUnzipTaskGroup->Run(mapFunction);
+   return nTasks;
+}
 
-   return 0;
+////////////////////////////////////////////////////////////////////////////////
+/// Add len bytes to the unzipped bytes if they fit in the unzip buffer. A block
+/// larger than the whole buffer is accepted when nothing else is pending, such
+/// that it can still be unzipped ahead. Returns whether the bytes were reserved.
+
+Bool_t TTreeCacheUnzip::ReserveUnzipBytes(Long64_t len)
+{
+   Long64_t bytes = fUnzipBytes;
+   do {
+      if (bytes > 0 && bytes + len > fUnzipBufferSize)
+         return kFALSE;
+   } while (!fUnzipBytes.compare_exchange_weak(bytes, bytes + len));
+   Long64_t peak = fUnzipBytesPeak;
+   while (bytes + len > peak && !fUnzipBytesPeak.compare_exchange_weak(peak, bytes + len)) {
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Body of an unzip task: unzip the next baskets of the unzip-ahead window until
+/// the window is exhausted, the unzip buffer is full or the cache is invalidated.
+/// The unzipped size of a basket is reserved before the basket is taken, such
+/// that concurrent tasks never exceed the unzip buffer.
+
+void TTreeCacheUnzip::UnzipAhead(Int_t cycle)
+{
+   while (cycle == fCycle) {
+      Int_t pos = fUnzipNext;
+      if (pos >= (Int_t)fUnzipOrder.size())
+         break;
+      Int_t index = fUnzipOrder[pos];
+      Int_t nbytes = 0, objlen = 0, keylen = 0;
+      GetRecordHeader(&fBuffer[fSeekPos[index]], fSeekSortLen[index], nbytes, objlen, keylen);
+      const Long64_t len = objlen + keylen;
+      if (!ReserveUnzipBytes(len))
+         break;
+      if (!fUnzipNext.compare_exchange_strong(pos, pos + 1)) {
+         // Another task took this basket or the reader moved the window: retry with the new position.
+         fUnzipBytes -= len;
+         continue;
+      }
+      if (fUnzipState.TryUnzipping(index)) {
+         Int_t res = UnzipCache(index, len);
+         if (res && gDebug > 0)
+            Info("UnzipAhead", "Unzipping failed or cache is in learning state");
+      } else {
+         fUnzipBytes -= len;
+      }
+   }
+   fNUnzipTasks--;
 }
 #endif
 
@@ -670,109 +800,50 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
    Int_t res = 0;
    Int_t loc = -1;
 
-   // We go straight to TTreeCache/TfileCacheRead, in order to get the info we need
-   //  pointer to the original zipped chunk
-   //  its index in the original unsorted offsets lists
-   //
-   // Actually there are situations in which copying the buffer is not
-   // useful. But the choice is among doing once more a small memcpy or a binary search in a large array. I prefer the former.
-   // Also, here we prefer not to trigger the (re)population of the chunks in the TFileCacheRead. That is
-   // better to be done in the main thread.
-
-   Int_t myCycle = fCycle;
-
-   if (fParallel && !fIsLearning) {
-
-      if(fNseekMax < fNseek){
-         if (gDebug > 0)
-            Info("GetUnzipBuffer", "Changing fNseekMax from:%d to:%d", fNseekMax, fNseek);
-
-         fUnzipState.Reset(fNseekMax, fNseek);
-         fNseekMax = fNseek;
-      }
+   if (fParallel && !fIsLearning && !fUnzipOrder.empty()) {
 
       loc = (Int_t)TMath::BinarySearch(fNseek, fSeekSort, pos);
-      if ((fCycle == myCycle) && (loc >= 0) && (loc < fNseek) && (pos == fSeekSort[loc])) {
-
-         // The buffer is, at minimum, in the file cache. We must know its index in the requests list
-         // In order to get its info
-         Int_t seekidx = fSeekIndex[loc];
-
-         do {
-
-            // If the block is ready we get it immediately.
-            // And also we don't have to alloc the blks. This is supposed to be
-            // the main thread of the app.
-            if (fUnzipState.IsUnzipped(seekidx)) {
-               if(!(*buf)) {
-                  *buf = fUnzipState.fUnzipChunks[seekidx].get();
-                  fUnzipState.fUnzipChunks[seekidx].release();
-                  *free = kTRUE;
-               } else {
-                  memcpy(*buf, fUnzipState.fUnzipChunks[seekidx].get(), fUnzipState.fUnzipLen[seekidx]);
-                  fUnzipState.fUnzipChunks[seekidx].reset();
-                  *free = kFALSE;
-               }
-
-               fNFound++;
-               return fUnzipState.fUnzipLen[seekidx];
-            }
-
-            // If the requested basket is being unzipped by a background task, we try to steal a blk to unzip.
-            Int_t reqi = -1;
-
-            if (fUnzipState.IsProgress(seekidx)) {
-               if (fEmpty) {
-                  for (Int_t ii = 0; ii < fNseek; ++ii) {
-                     Int_t idx = (seekidx + 1 + ii) % fNseek;
-                     if (fUnzipState.IsUntouched(idx)) {
-                        if(fUnzipState.TryUnzipping(idx)) {
-                           reqi = idx;
-                           break;
-                        }
-                     }
-                  }
-                  if (reqi < 0) {
-                     fEmpty = kFALSE;
-                  } else {
-                     UnzipCache(reqi);
-                  }
-               }
-
-               if ( myCycle != fCycle ) {
-                  if (gDebug > 0)
-                     Info("GetUnzipBuffer", "Sudden paging Break!!! fNseek: %d, fIsLearning:%d",
-                          fNseek, fIsLearning);
-
-                  seekidx = -1;
-                  break;
-               }
-            }
-
-         } while (fUnzipState.IsProgress(seekidx));
+      if ((loc >= 0) && (loc < fNseek) && (pos == fSeekSort[loc])) {
+         MoveUnzipWindow(loc);
+
+         // Either we claim the block, such that no task will unzip it, or a task got it first.
+         Bool_t claimed = fUnzipState.TryUnzipping(loc);
+         Bool_t stalled = kFALSE;
+         if (!claimed && fUnzipState.IsProgress(loc)) {
+            // The block is being unzipped: waiting for it is cheaper than unzipping it again.
+            auto start = std::chrono::steady_clock::now();
+            while (fUnzipState.IsProgress(loc))
+               std::this_thread::yield();
+            fStallTime += std::chrono::duration<Double_t>(std::chrono::steady_clock::now() - start).count();
+            fNStalls++;
+            stalled = kTRUE;
+         }
 
-         // Here the block is not pending. It could be done or aborted or not yet being processed.
-         if ( (seekidx >= 0) && (fUnzipState.IsUnzipped(seekidx)) ) {
-            if(!(*buf)) {
-              *buf = fUnzipState.fUnzipChunks[seekidx].get();
-               fUnzipState.fUnzipChunks[seekidx].release();
+         if (!claimed && fUnzipState.IsUnzipped(loc)) {
+            Int_t unzipLen = fUnzipState.fUnzipLen[loc];
+            if (!(*buf)) {
+               *buf = fUnzipState.fUnzipChunks[loc].release();
                *free = kTRUE;
             } else {
-               memcpy(*buf, fUnzipState.fUnzipChunks[seekidx].get(), fUnzipState.fUnzipLen[seekidx]);
-               fUnzipState.fUnzipChunks[seekidx].reset();
+               memcpy(*buf, fUnzipState.fUnzipChunks[loc].get(), unzipLen);
+               fUnzipState.fUnzipChunks[loc].reset();
                *free = kFALSE;
             }
+            fUnzipBytes -= unzipLen;
 
-            fNStalls++;
-            return fUnzipState.fUnzipLen[seekidx];
-         } else {
-            // This is a complete miss. We want to avoid the background tasks
-            // to try unzipping this block in the future.
-            fUnzipState.SetMissed(seekidx);
+            if (!stalled)
+               fNFound++;
+#ifdef R__USE_IMT
+            CreateTasks();
+#endif
+            return unzipLen;
          }
+
+         // The block was not unzipped ahead (out of the window, released or failed): unzip it here.
+         if (claimed)
+            fUnzipState.SetMissed(loc);
       } else {
          loc = -1;
-         fIsTransferred = kFALSE;
       }
    }
 
@@ -790,30 +861,35 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
 
    res = 0;
    if (!ReadBufferExt(fCompBuffer, pos, len, loc)) {
-      // Cache is invalidated and we need to wait for all unzipping tasks to be finished before fill new baskets in cache.
-#ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled() && fUnzipTaskGroup) {
-         fUnzipTaskGroup->Cancel();
-         fUnzipTaskGroup.reset();
-      }
-#endif
-      {
-         // Fill new baskets into cache.
-         R__LOCKGUARD(fIOMutex.get());
-	      fFile->Seek(pos);
-	      res = fFile->ReadBuffer(fCompBuffer, len);
-      } // end of lock scope
-#ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled()) {
-         CreateTasks();
-      }
-#endif
+      // Not in the cache: this refills the cache (see FillBuffer()) if the reader moved to the next cluster.
+      R__LOCKGUARD(fIOMutex.get());
+      fFile->Seek(pos);
+      res = fFile->ReadBuffer(fCompBuffer, len);
    }
 
    if (res) res = -1;
 
    if (!res) {
-      res = UnzipBuffer(buf, fCompBuffer);
+      TBranch *branch = nullptr;
+      loc = -1;
+      if (fIsSorted) {
+         loc = (Int_t)TMath::BinarySearch(fNseek, fSeekSort, pos);
+         if ((loc >= 0) && (loc < fNseek) && (pos == fSeekSort[loc]))
+            branch = GetSeekBranch(loc);
+         else
+            loc = -1;
+      }
+#ifdef R__USE_IMT
+      if (loc >= 0 && fParallel && !fIsLearning && fIsTransferred && !fAsyncReading) {
+         // Make sure the unzip tasks carry on after this block instead of unzipping it again.
+         if (fUnzipOrder.empty())
+            BuildUnzipOrder();
+         MoveUnzipWindow(loc);
+         if (fUnzipState.TryUnzipping(loc))
+            fUnzipState.SetMissed(loc);
+      }
+#endif
+      res = UnzipBuffer(buf, fCompBuffer, branch);
       *free = kTRUE;
    }
 
@@ -821,6 +897,10 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
       fNMissed++;
    }
 
+#ifdef R__USE_IMT
+   CreateTasks();
+#endif
+
    return res;
 }
 
@@ -849,8 +929,10 @@ void TTreeCacheUnzip::SetUnzipBufferSize(Long64_t bufferSize)
 /// to pass it to the creator of TBuffer
 /// src is the original buffer with the record (header+compressed data)
 /// *dest is the inflated buffer (including the header)
+/// branch is the branch the basket belongs to, needed for baskets compressed
+/// with a dictionary (see TBranch::GetCompressionDictionary())
 
-Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
+Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src, TBranch *branch)
 {
    Int_t  uzlen = 0;
    Bool_t alloc = kFALSE;
@@ -911,7 +993,19 @@ Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
             return uzlen;
          }
 
-         R__unzip(&nin, bufcur, &nbuf, objbuf, &nout);
+         if (ROOT::Internal::RZSTDDictionary::IsDictionaryHeader(bufcur)) {
+            const ROOT::Internal::RZSTDDictionary *dictionary = branch ? branch->GetCompressionDictionary() : nullptr;
+            if (!dictionary) {
+               // Without the dictionary of the basket's branch, leave it to TBasket::ReadBasketBuffers.
+               uzlen = -1;
+               if(alloc) delete [] *dest;
+               *dest = 0;
+               return uzlen;
+            }
+            dictionary->Unzip(&nin, bufcur, &nbuf, (UChar_t *)objbuf, &nout);
+         } else {
+            R__unzip(&nin, bufcur, &nbuf, objbuf, &nout);
+         }
 
          if (gDebug > 2)
             Info("UnzipBuffer", "R__unzip nin:%d, bufcur:%p, nbuf:%d, objbuf:%p, nout:%d",
@@ -948,9 +1042,10 @@ void  TTreeCacheUnzip::Print(Option_t* option) const {
 
    printf("******TreeCacheUnzip statistics for file: %s ******\n",fFile->GetName());
    printf("Max allowed mem for pending buffers: %lld\n", fUnzipBufferSize);
-   printf("Number of blocks unzipped by threads: %d\n", fNUnzip);
+   printf("Pending unzipped bytes: %lld (at most %lld)\n", (Long64_t)fUnzipBytes, (Long64_t)fUnzipBytesPeak);
+   printf("Number of blocks unzipped by threads: %d\n", (Int_t)fNUnzip);
    printf("Number of hits: %d\n", fNFound);
-   printf("Number of stalls: %d\n", fNStalls);
+   printf("Number of stalls: %d (%.3f s)\n", fNStalls, fStallTime);
    printf("Number of misses: %d\n", fNMissed);
 
    TTreeCache::Print(option);
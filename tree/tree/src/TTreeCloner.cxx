@@ -37,6 +37,7 @@ Class implementing or helping  the various TTree cloning method
 #include "snprintf.h"
 
 #include <algorithm>
+#include <cstring>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -128,6 +129,7 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
    fWarningMsg(),
    fIsValid(kTRUE),
    fNeedConversion(kFALSE),
+   fNeedRecompression(kFALSE),
    fOptions(options),
    fFromTree(from),
    fToTree(to),
@@ -345,6 +347,26 @@ UInt_t TTreeCloner::CollectBranches(TBranch *from, TBranch *to) {
 
    }
 
+   if (from->fCompressionDictionarySize || to->fCompressionDictionarySize) {
+      // The copied baskets can only be decompressed with the dictionary they were compressed with.
+      Bool_t sameDictionary = from->fCompressionDictionarySize == to->fCompressionDictionarySize &&
+                              !memcmp(from->fCompressionDictionary, to->fCompressionDictionary,
+                                      from->fCompressionDictionarySize);
+      if (!sameDictionary && !to->fCompressionDictionarySize && to->GetEntries() == 0) {
+         to->SetCompressionDictionary(from->fCompressionDictionary, from->fCompressionDictionarySize);
+      } else if (!sameDictionary && from->fCompressionDictionarySize) {
+         fWarningMsg.Form("The export branch and the import branch (%s) do not have the same compression dictionary.",
+                          from->GetName());
+         if (!(fOptions & kNoWarnings)) {
+            Warning("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
+         }
+         fIsValid = kFALSE;
+         fNeedConversion = kTRUE;
+         fNeedRecompression = kTRUE;
+         return 0;
+      }
+   }
+
    fFromBranches.AddLast(from);
    if (!from->TestBit(TBranch::kDoNotUseBufferMap)) {
       // Make sure that we reset the Buffer's map if needed.
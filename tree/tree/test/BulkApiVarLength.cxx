@@ -6,6 +6,7 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TStopwatch.h"
+#include "TSystem.h"
 #include "TTreeReader.h"
 #include "TTreeReaderValue.h"
 #include "TTreeReaderArray.h"
@@ -15,6 +16,9 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
+#include <vector>
+
 class BulkApiVariableTest : public ::testing::Test {
 public:
    static constexpr Long64_t fClusterSize = 1e5;
@@ -236,3 +240,123 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, offsetsRead)
+{
+   auto hfile = TFile::Open(fFileName.c_str());
+   auto tree = dynamic_cast<TTree*>(hfile->Get("T"));
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+   EDataType type = kOther_t;
+   ASSERT_TRUE(branchFloat->GetBulkRead().SupportsBulkReadWithOffsets(&type));
+   ASSERT_EQ(type, kFloat_t);
+   ASSERT_TRUE(branchDouble->GetBulkRead().SupportsBulkReadWithOffsets(&type));
+   ASSERT_EQ(type, kDouble_t);
+
+   float idx_f = 0;
+   double idx_d = 2;
+   Long64_t evt_idx = 0;
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32*1024);
+   std::vector<Int_t> floatOffsets;
+   std::vector<Int_t> doubleOffsets;
+   while (evt_idx < fEventCount) {
+      auto count = branchFloat->GetBulkRead().GetEntriesWithOffsets(evt_idx, floatBuf, floatOffsets);
+      ASSERT_EQ(count, fClusterSize);
+      ASSERT_EQ(branchDouble->GetBulkRead().GetEntriesWithOffsets(evt_idx, doubleBuf, doubleOffsets), count);
+      ASSERT_EQ(floatOffsets.size(), static_cast<size_t>(count + 1));
+      auto floats = reinterpret_cast<float*>(floatBuf.GetCurrent());
+      auto doubles = reinterpret_cast<double*>(doubleBuf.GetCurrent());
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(doubles) % alignof(double), 0u);
+      for (Int_t idx = 0; idx < count; idx++) {
+         const Int_t entry_count = (evt_idx + idx + 1) % 10;
+         ASSERT_EQ(floatOffsets[idx + 1] - floatOffsets[idx], entry_count);
+         ASSERT_EQ(doubleOffsets[idx + 1] - doubleOffsets[idx], entry_count);
+         for (Int_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+            ASSERT_EQ(floats[floatOffsets[idx] + entry_idx], idx_f++);
+            ASSERT_EQ(doubles[doubleOffsets[idx] + entry_idx], idx_d++);
+         }
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, fEventCount);
+
+   // Only the first entry of a basket can be requested.
+   EXPECT_EQ(branchFloat->GetBulkRead().GetEntriesWithOffsets(1, floatBuf, floatOffsets), -1);
+
+   // TTreeReaderArray reads such branches in bulk.
+   TTreeReader myReader(tree);
+   TTreeReaderArray<float> myF(myReader, "f");
+   ASSERT_TRUE(myReader.Next());
+   ASSERT_TRUE(myReader.Next());
+   EXPECT_TRUE(myF.IsContiguous());
+   ASSERT_EQ(myF.GetSize(), 2u);
+   EXPECT_EQ(myF[0], 1.f);
+   EXPECT_EQ(myF[1], 2.f);
+   delete hfile;
+}
+
+TEST(BulkApiVariableVectorTest, offsetsRead)
+{
+   const std::string fileName = "BulkApiTestVector.root";
+   const Long64_t eventCount = 10000;
+   {
+      TFile file(fileName.c_str(), "RECREATE");
+      TTree tree("T", "A ROOT tree of std::vector<float> branches.");
+      tree.SetAutoFlush(1000);
+      std::vector<float> v;
+      tree.Branch("v", &v);
+      float counter = 0;
+      for (Long64_t ev = 0; ev < eventCount; ev++) {
+         v.resize(ev % 7);
+         for (auto &x : v)
+            x = counter++;
+         tree.Fill();
+      }
+      file.Write();
+   }
+
+   TFile file(fileName.c_str());
+   auto tree = file.Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   auto branch = tree->GetBranch("v");
+   ASSERT_TRUE(branch);
+   EDataType type = kOther_t;
+   ASSERT_TRUE(branch->GetBulkRead().SupportsBulkReadWithOffsets(&type));
+   ASSERT_EQ(type, kFloat_t);
+
+   TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+   std::vector<Int_t> offsets;
+   float expected = 0;
+   Long64_t evt_idx = 0;
+   while (evt_idx < eventCount) {
+      auto count = branch->GetBulkRead().GetEntriesWithOffsets(evt_idx, buf, offsets);
+      ASSERT_GT(count, 0);
+      auto values = reinterpret_cast<float *>(buf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         ASSERT_EQ(offsets[idx + 1] - offsets[idx], (evt_idx + idx) % 7);
+         for (Int_t i = offsets[idx]; i < offsets[idx + 1]; i++)
+            ASSERT_EQ(values[i], expected++);
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, eventCount);
+
+   // Same values through TTreeReaderArray, which takes the bulk path.
+   TTreeReader reader(tree);
+   TTreeReaderArray<float> rv(reader, "v");
+   expected = 0;
+   Long64_t ev = 0;
+   while (reader.Next()) {
+      EXPECT_TRUE(rv.IsContiguous());
+      ASSERT_EQ(rv.GetSize(), static_cast<size_t>(ev % 7));
+      for (auto x : rv)
+         ASSERT_EQ(x, expected++);
+      ev++;
+   }
+   ASSERT_EQ(ev, eventCount);
+   gSystem->Unlink(fileName.c_str());
+}
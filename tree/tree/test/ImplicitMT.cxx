@@ -2,9 +2,13 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCacheUnzip.h"
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+#include <thread>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -28,4 +32,85 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+/// Enable implicit multi-threading and the parallel unzipping, restore the previous settings at the end of the scope
+class ParallelUnzipRAII {
+   const bool fWasIMTEnabled = ROOT::IsImplicitMTEnabled();
+   const TTreeCacheUnzip::EParUnzipMode fOldMode = TTreeCacheUnzip::GetParallelUnzip();
+
+public:
+   ParallelUnzipRAII()
+   {
+      if (!fWasIMTEnabled)
+         ROOT::EnableImplicitMT(4);
+      TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+   }
+   ~ParallelUnzipRAII()
+   {
+      TTreeCacheUnzip::SetParallelUnzip(fOldMode);
+      if (!fWasIMTEnabled)
+         ROOT::DisableImplicitMT();
+   }
+};
+
+TEST(TTreeImplicitMT, parallelUnzip)
+{
+   const auto ofileName = "parallelUnzipMT.root";
+   const int nEntries = 100000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      double d = 0.;
+      t.Branch("i", &i, 1000);
+      t.Branch("d", &d, 1000);
+      for (int e = 0; e < nEntries; ++e) {
+         i = e;
+         d = 0.5 * e;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   ParallelUnzipRAII parallelUnzip;
+   const Long64_t unzipBufferSize = 20000;
+   {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(10000000);
+      t->AddBranchToCache("*", true);
+      t->StopCacheLearningPhase();
+      int i = -1;
+      double d = -1.;
+      t->SetBranchAddress("i", &i);
+      t->SetBranchAddress("d", &d);
+
+      auto cache = dynamic_cast<TTreeCacheUnzip *>(t->GetReadCache(&f));
+      ASSERT_NE(nullptr, cache);
+      // A budget of a few baskets, such that the tasks have to wait for the reader
+      cache->SetUnzipBufferSize(unzipBufferSize);
+
+      for (int e = 0; e < nEntries; ++e) {
+         t->GetEntry(e);
+         ASSERT_EQ(e, i);
+         ASSERT_EQ(0.5 * e, d);
+         // Give the tasks started by the first read the time to unzip ahead, however slow the machine is
+         for (int wait = 0; e == 0 && wait < 1000 && cache->GetNUnzip() == 0; ++wait)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+
+      EXPECT_GT(cache->GetNUnzip(), 0);
+      EXPECT_LE(cache->GetNFound(), cache->GetNUnzip());
+      // Every basket is unzipped ahead by a task (a hit, or a stall if the reader had to wait) or by the reader
+      const Int_t nBaskets = t->GetBranch("i")->GetWriteBasket() + t->GetBranch("d")->GetWriteBasket();
+      EXPECT_GE(cache->GetNFound() + cache->GetNStalls() + cache->GetNMissed(), nBaskets);
+      EXPECT_GE(cache->GetStallTime(), 0.);
+      if (cache->GetNStalls() == 0)
+         EXPECT_EQ(0., cache->GetStallTime());
+      // The baskets are much smaller than the budget, which is therefore never exceeded
+      EXPECT_GT(cache->GetUnzipBytesPeak(), 0);
+      EXPECT_LE(cache->GetUnzipBytesPeak(), unzipBufferSize);
+   }
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
@@ -4,12 +4,15 @@
 #include "TBranch.h"
 #include "TEnum.h"
 #include "TEnumConstant.h"
+#include "TList.h"
 #include "TMemFile.h"
 #include "TTree.h"
 
 #include "ROOT/TestSupport.hxx"
 #include "gtest/gtest.h"
 
+#include <memory>
+#include <string>
 #include <vector>
 
 static const Int_t gSampleEvents = 100;
@@ -411,3 +414,130 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<Bool_t *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, kTRUE);
 }
+
+TEST(TBasket, TestZstdDictionary)
+{
+   TMemFile *f = new TMemFile("tbasket_test.root", "CREATE");
+   ASSERT_NE(f, nullptr);
+   ASSERT_FALSE(f->IsZombie());
+   f->SetCompressionSettings(ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kZSTD, 5));
+
+   TTree t1("t1", "Simple tree for testing compression dictionaries.");
+   ASSERT_FALSE(t1.IsZombie());
+   ROOT::TIOFeatures settings;
+   settings.Set(ROOT::Experimental::EIOFeatures::kZstdDictionary);
+   t1.SetIOFeatures(settings);
+
+   // Many small baskets, such that the first ones train the dictionary and the later ones use it.
+   const Int_t nEntries = 250 * 200;
+   Int_t idx;
+   TBranch *br = t1.Branch("idx", &idx, "idx/I", 1000);
+   ASSERT_NE(br, nullptr);
+   for (Int_t i = 0; i < nEntries; i++) {
+      idx = (i * 7) % 100;
+      t1.Fill();
+   }
+   t1.Write();
+   EXPECT_GT(br->GetCompressionDictionarySize(), 0);
+   f->Close();
+
+   std::vector<char> memBuffer;
+   Long64_t maxsize = f->GetSize();
+   memBuffer.resize(maxsize);
+   f->CopyTo(&memBuffer[0], maxsize);
+
+   TMemFile f2("tbasket_test.root", &memBuffer[0], maxsize, "READ");
+   TTree *saved_t1 = nullptr;
+   f2.GetObject("t1", saved_t1);
+   ASSERT_NE(saved_t1, nullptr);
+   br = saved_t1->GetBranch("idx");
+   ASSERT_NE(br, nullptr);
+   EXPECT_GT(br->GetCompressionDictionarySize(), 0);
+   EXPECT_NE(br->GetCompressionDictionary(), nullptr);
+
+   // The compressed blocks of the first baskets have the plain zstd header "ZS", the ones of the baskets compressed
+   // once the dictionary is trained have the "ZD" header
+   auto blockHeader = [&](Int_t basket) {
+      const Int_t keylen = br->GetBasket(basket)->GetKeylen();
+      std::vector<char> raw(br->GetBasketBytes()[basket]);
+      f2.Seek(br->GetBasketSeek(basket));
+      EXPECT_FALSE(f2.ReadBuffer(raw.data(), raw.size()));
+      return std::string(raw.data() + keylen, 2);
+   };
+   const Int_t nBaskets = br->GetWriteBasket();
+   ASSERT_GT(nBaskets, 2);
+   EXPECT_EQ("ZS", blockHeader(0));
+   Int_t firstDictBasket = nBaskets;
+   for (Int_t i = 0; i < nBaskets; i++) {
+      const auto header = blockHeader(i);
+      if (header == "ZD" && firstDictBasket == nBaskets)
+         firstDictBasket = i;
+      if (i >= firstDictBasket)
+         EXPECT_EQ("ZD", header) << "basket " << i;
+      else
+         EXPECT_EQ("ZS", header) << "basket " << i;
+   }
+   EXPECT_LT(firstDictBasket, nBaskets - 1);
+
+   Int_t saved_idx;
+   saved_t1->SetBranchAddress("idx", &saved_idx);
+   ASSERT_EQ(saved_t1->GetEntries(), nEntries);
+   for (Int_t i = 0; i < nEntries; i++) {
+      ASSERT_GT(saved_t1->GetEntry(i), 0);
+      EXPECT_EQ((i * 7) % 100, saved_idx);
+   }
+}
+
+TEST(TBasket, MergeZstdDictionaries)
+{
+   // Each input file trains its own dictionary from different content; its baskets can not be fast-cloned into a
+   // tree compressed with the dictionary of the other one.
+   const Int_t nEntries = 250 * 200;
+   auto value = [](Int_t file, Int_t i) { return file == 0 ? (i * 7) % 100 : 100000 + (i * 13) % 1000; };
+   auto makeInput = [&](Int_t file) {
+      auto f = std::make_unique<TMemFile>(("tbasket_merge_" + std::to_string(file) + ".root").c_str(), "RECREATE");
+      f->SetCompressionSettings(ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kZSTD, 5));
+      auto t = new TTree("t1", "Input tree with its own compression dictionary.");
+      ROOT::TIOFeatures settings;
+      settings.Set(ROOT::Experimental::EIOFeatures::kZstdDictionary);
+      t->SetIOFeatures(settings);
+      Int_t idx;
+      t->Branch("idx", &idx, "idx/I", 1000);
+      for (Int_t i = 0; i < nEntries; i++) {
+         idx = value(file, i);
+         t->Fill();
+      }
+      t->Write();
+      t->ResetBranchAddresses();
+      return f;
+   };
+   auto f0 = makeInput(0);
+   auto f1 = makeInput(1);
+   auto t0 = f0->Get<TTree>("t1");
+   auto t1 = f1->Get<TTree>("t1");
+   ASSERT_NE(t0, nullptr);
+   ASSERT_NE(t1, nullptr);
+   TBranch *br0 = t0->GetBranch("idx");
+   TBranch *br1 = t1->GetBranch("idx");
+   ASSERT_GT(br0->GetCompressionDictionarySize(), 0);
+   ASSERT_GT(br1->GetCompressionDictionarySize(), 0);
+
+   TMemFile out("tbasket_merged.root", "RECREATE");
+   out.SetCompressionSettings(ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kZSTD, 5));
+   TList inputs;
+   inputs.Add(t0);
+   inputs.Add(t1);
+   TTree *merged = TTree::MergeTrees(&inputs, "fast");
+   ASSERT_NE(merged, nullptr);
+   EXPECT_EQ(&out, merged->GetCurrentFile());
+   merged->Write();
+
+   Int_t merged_idx;
+   merged->SetBranchAddress("idx", &merged_idx);
+   ASSERT_EQ(merged->GetEntries(), 2 * nEntries);
+   for (Int_t i = 0; i < 2 * nEntries; i++) {
+      ASSERT_GT(merged->GetEntry(i), 0);
+      EXPECT_EQ(value(i / nEntries, i % nEntries), merged_idx) << "entry " << i;
+   }
+   merged->ResetBranchAddresses();
+}
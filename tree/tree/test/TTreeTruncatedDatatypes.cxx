@@ -1,9 +1,15 @@
+#include "TBranch.h"
+#include "TBufferFile.h"
 #include "TFile.h"
 #include "TSystem.h"
 #include "TTree.h"
 
 #include "gtest/gtest.h"
 
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
 TEST(TTreeTruncatedDatatypes, float16double32leaves)
 {
    const auto ofileName = "float16double32leaves.root";
@@ -57,3 +63,51 @@ TEST(TTreeTruncatedDatatypes, float16double32leaves)
    f.Close();
    gSystem->Unlink(ofileName);
 }
+
+TEST(TTreeTruncatedDatatypes, float16double32bulkRead)
+{
+   TTree t("t", "t");
+   Float16_t f1 = 0., f2 = 0., f3[3] = {};
+   Double32_t d1 = 0., d2 = 0., d3[3] = {};
+   t.Branch("f1", &f1, "f1/f");
+   t.Branch("f2", &f2, "f2/f[-1000,1000,20]");
+   t.Branch("f3", f3, "f3[3]/f[0,0,8]");
+   t.Branch("d1", &d1, "d1/d");
+   t.Branch("d2", &d2, "d2/d[-1000,1000,20]");
+   t.Branch("d3", d3, "d3[3]/d[0,0,10]");
+   const Long64_t nEntries = 10000;
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      f1 = f2 = d1 = d2 = 0.37 * i - 1000.;
+      for (int j = 0; j < 3; ++j)
+         f3[j] = d3[j] = (j - 1) * 1.7 * i;
+      t.Fill();
+   }
+
+   // The values read in bulk must be the ones read entry by entry.
+   auto checkBulkRead = [&](const char *name, auto *value, Int_t len) {
+      using Value_t = std::remove_pointer_t<decltype(value)>;
+      SCOPED_TRACE(name);
+      auto branch = t.GetBranch(name);
+      ASSERT_TRUE(branch->GetBulkRead().SupportsBulkRead());
+      TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+      Long64_t entry = 0;
+      while (entry < nEntries) {
+         auto count = branch->GetBulkRead().GetBulkEntries(entry, buf);
+         ASSERT_GT(count, 0);
+         std::vector<Value_t> values(count * len);
+         memcpy(values.data(), buf.GetCurrent(), values.size() * sizeof(Value_t));
+         for (Int_t i = 0; i < count; ++i) {
+            branch->GetEntry(entry + i);
+            for (Int_t j = 0; j < len; ++j)
+               EXPECT_EQ(value[j], values[i * len + j]);
+         }
+         entry += count;
+      }
+   };
+   checkBulkRead("f1", &f1, 1);
+   checkBulkRead("f2", &f2, 1);
+   checkBulkRead("f3", f3, 3);
+   checkBulkRead("d1", &d1, 1);
+   checkBulkRead("d2", &d2, 1);
+   checkBulkRead("d3", d3, 3);
+}
@@ -94,6 +94,19 @@ private:
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
 
+public:
+   /// Statistics of one processing slot during the last call to Process(). There is one slot per worker of the
+   /// thread pool, a task takes a free slot for the time it processes its entry range.
+   struct RWorkerStats {
+      double fBusyTime = 0.;         ///< Seconds spent in the user function
+      double fIdleTime = 0.;         ///< Seconds of the Process() call spent elsewhere, e.g. waiting for other workers
+      ULong64_t fNTasks = 0;         ///< Number of entry ranges processed
+      ULong64_t fNStolenTasks = 0;   ///< Number of entry ranges taken from files started by other workers
+   };
+
+private:
+   std::vector<RWorkerStats> fWorkerStats;
+
 public:
    TTreeProcessorMT(std::string_view filename, std::string_view treename = "", UInt_t nThreads = 0u,
                     const std::pair<Long64_t, Long64_t> &globalRange = {0, std::numeric_limits<Long64_t>::max()});
@@ -105,6 +118,9 @@ public:
                     const std::pair<Long64_t, Long64_t> &globalRange = {0, std::numeric_limits<Long64_t>::max()});
 
    void Process(std::function<void(TTreeReader &)> func);
+   /// Return the statistics of each processing slot for the last call to Process(), e.g. to tune
+   /// GetTasksPerWorkerHint()
+   const std::vector<RWorkerStats> &GetWorkerStats() const { return fWorkerStats; }
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
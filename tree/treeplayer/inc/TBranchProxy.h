@@ -400,6 +400,9 @@ public:
       }
 
       void* GetWhere() const { return fWhere; } // intentionally non-virtual
+      TBranch *GetBranch() const { return fBranch; }
+      /// Return the entry of the tree that is being read, -1 if there is none.
+      Long64_t GetReadEntry() const { return fDirector ? fDirector->GetReadEntry() : -1; }
 
       /// Return the address of the element number i. Returns `nullptr` for non-collections. It assumed that Setip() has
       /// been called.
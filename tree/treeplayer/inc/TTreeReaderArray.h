@@ -34,6 +34,8 @@ Base class of TTreeReaderArray.
 
       std::size_t GetSize() const { return fImpl->GetSize(GetProxy()); }
       Bool_t IsEmpty() const { return !GetSize(); }
+      /// Whether the elements of the current entry are known to be contiguous in memory; valid once an entry was read.
+      bool IsContiguous() const { return fImpl && fImpl->IsContiguous(); }
 
       virtual EReadStatus GetReadStatus() const { return fImpl ? fImpl->fReadStatus : kReadError; }
 
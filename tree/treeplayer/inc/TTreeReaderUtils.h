@@ -76,6 +76,8 @@ namespace Internal {
       virtual ~TVirtualCollectionReader();
       virtual size_t GetSize(Detail::TBranchProxy*) = 0;
       virtual void* At(Detail::TBranchProxy*, size_t /*idx*/) = 0;
+      /// Whether the elements of a collection are stored contiguously in memory.
+      virtual bool IsContiguous() const { return false; }
    };
 
 }
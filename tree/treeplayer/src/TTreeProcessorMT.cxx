@@ -19,14 +19,29 @@ passes a function whose only parameter is a TTreeReader. The function iterates
 on a subrange of entries by using that TTreeReader.
 
 The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the subranges,
-each corresponding to a cluster in the TTree. This is possible thanks to the use
+each corresponding to one or more clusters in the TTree. This is possible thanks to the use
 of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
 objects.
+
+The subranges are not fixed up front. Each worker of the thread pool starts a file that no
+other worker has started yet and repeatedly claims the next contiguous group of clusters in
+it. The size of the groups decreases as the file is drained. Once all files have been
+started, idle workers help with the file that has the most clusters left. Large files and
+files with uneven processing cost therefore do not leave cores idle at the end of the event
+loop. GetWorkerStats() reports the time each worker spent processing entries and idling.
 */
 
 #include "TROOT.h"
+#include "ROOT/RSlotStack.hxx"
+#include "ROOT/TSeq.hxx"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread> // std::this_thread::yield
+
 using namespace ROOT;
 
 namespace {
@@ -125,7 +140,7 @@ using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
 static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
-                                       const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
+                                       const std::vector<std::string> &fileNames,
                                        const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()})
 {
    // Note that as a side-effect of opening all files that are going to be used in the
@@ -193,53 +208,46 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
                              "but the starting entry (" + range.first + ") is larger than the total number of " +
                              "entries (" + offset + ") in the dataset.");
 
-   // Here we "fuse" clusters together if the number of clusters is too big with respect to
-   // the number of slots, otherwise we can incur in an overhead which is big enough
-   // to make parallelisation detrimental to performance.
-   // For example, this is the case when, following a merging of many small files, a file
-   // contains a tree with many entries and with clusters of just a few entries each.
-   // Another problematic case is a high number of slots (e.g. 256) coupled with a high number
-   // of files (e.g. 1000 files): the large amount of files might result in a large amount
-   // of tasks, but the elevated concurrency level makes the little synchronization required by
-   // task initialization very expensive. In this case it's better to simply process fewer, larger tasks.
-   // Cluster-merging can help reduce the number of tasks down to a minumum of one task per file.
-   //
-   // The criterion according to which we fuse clusters together is to have around
-   // TTreeProcessorMT::GetTasksPerWorkerHint() clusters per slot.
-   // Concretely, for each file we will cap the number of tasks to ceil(GetTasksPerWorkerHint() * nWorkers / nFiles).
-
-   std::vector<std::vector<EntryRange>> eventRangesPerFile(clustersPerFile.size());
-   auto clustersPerFileIt = clustersPerFile.begin();
-   auto eventRangesPerFileIt = eventRangesPerFile.begin();
-   for (; clustersPerFileIt != clustersPerFile.end(); clustersPerFileIt++, eventRangesPerFileIt++) {
-      const auto clustersInThisFileSize = clustersPerFileIt->size();
-      const auto nFolds = clustersInThisFileSize / maxTasksPerFile;
-      // If the number of clusters is less than maxTasksPerFile
-      // we take the clusters as they are
-      if (nFolds == 0) {
-         *eventRangesPerFileIt = std::move(*clustersPerFileIt);
-         continue;
-      }
-      // Otherwise, we have to merge clusters, distributing the reminder evenly
-      // onto the first clusters
-      auto nReminderClusters = clustersInThisFileSize % maxTasksPerFile;
-      const auto &clustersInThisFile = *clustersPerFileIt;
-      for (auto i = 0ULL; i < clustersInThisFileSize; ++i) {
-         const auto start = clustersInThisFile[i].first;
-         // We lump together at least nFolds clusters, therefore
-         // we need to jump ahead of nFolds-1.
-         i += (nFolds - 1);
-         // We now add a cluster if we have some reminder left
-         if (nReminderClusters > 0) {
-            i += 1U;
-            nReminderClusters--;
-         }
-         const auto end = clustersInThisFile[i].second;
-         eventRangesPerFileIt->emplace_back(EntryRange({start, end}));
-      }
-   }
+   return std::make_pair(std::move(clustersPerFile), std::move(entriesPerFile));
+}
 
-   return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
+/// The clusters of one file and the progress of their processing, shared by all workers.
+struct RFileTasks {
+   enum class EState { kNotStarted, kReady, kFailed };
+   /// Set to kReady by the worker that retrieved the clusters of the file, only then other workers read them
+   std::atomic<EState> fState{EState::kNotStarted};
+   std::vector<EntryRange> fClusters;
+   /// Tree names, file names and entries to construct the TTreeReaders, only filled for clusters with local entries
+   std::vector<std::string> fTreeNames;
+   std::vector<std::string> fFileNames;
+   std::vector<Long64_t> fEntries;
+   /// Maximum number of clusters processed by a single task
+   std::size_t fMaxChunkSize = 1;
+   /// Index of the first cluster that has not been claimed by any worker yet
+   std::atomic<std::size_t> fNextCluster{0};
+};
+
+////////////////////////////////////////////////////////////////////////
+/// Claim the next group of contiguous clusters of a file and return its entry range, or return false if no clusters
+/// are left. The group size shrinks with the number of clusters left, so that the last tasks of a file are small and
+/// all workers finish at about the same time.
+///
+/// Grouping clusters avoids the overhead of one task per cluster, e.g. for a file produced by merging many small files,
+/// with many clusters of just a few entries each. The group size only depends on the position of the first unclaimed
+/// cluster, so that the entry ranges of the tasks do not depend on the scheduling.
+static bool ClaimClusters(RFileTasks &file, std::size_t nWorkers, EntryRange &range)
+{
+   const auto nClusters = file.fClusters.size();
+   auto next = file.fNextCluster.load();
+   std::size_t chunkSize = 0;
+   do {
+      if (next >= nClusters)
+         return false;
+      chunkSize = std::min(file.fMaxChunkSize, std::max<std::size_t>(1, (nClusters - next) / (2 * nWorkers)));
+   } while (!file.fNextCluster.compare_exchange_weak(next, next + chunkSize));
+
+   range = EntryRange{file.fClusters[next].first, file.fClusters[next + chunkSize - 1].second};
+   return true;
 }
 
 } // anonymous namespace
@@ -451,9 +459,14 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const EntryRang
 /// \param[in] func User-defined function that processes a subrange of entries
 void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
 {
-   // compute number of tasks per file
+   using Clock_t = std::chrono::steady_clock;
+   const auto processStart = Clock_t::now();
+
+   // compute the maximum number of tasks per file, which bounds the number of clusters processed by a single task,
+   // see ClaimClusters
+   const std::size_t nWorkers = fPool.GetPoolSize();
    const unsigned int maxTasksPerFile =
-      std::ceil(float(GetTasksPerWorkerHint() * fPool.GetPoolSize()) / float(fFileNames.size()));
+      std::ceil(float(GetTasksPerWorkerHint() * nWorkers) / float(fFileNames.size()));
 
    // If an entry list or friend trees are present, we need to generate clusters with global entry numbers,
    // so we do it here for all files.
@@ -468,36 +481,11 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    auto &allClusters = allClusterAndEntries.first;
    const auto &allEntries = allClusterAndEntries.second;
    if (shouldRetrieveAllClusters) {
-      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange);
+      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, fGlobalRange);
       if (hasEntryList)
          allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
    }
 
-   // Per-file processing in case we retrieved all cluster info upfront
-   auto processFileUsingGlobalClusters = [&](std::size_t fileIdx) {
-      auto processCluster = [&](const EntryRange &c) {
-         auto r =
-            fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList, allEntries);
-         func(*r);
-      };
-      fPool.Foreach(processCluster, allClusters[fileIdx]);
-   };
-
-   // Per-file processing that also retrieves cluster info for a file
-   auto processFileRetrievingClusters = [&](std::size_t fileIdx) {
-      // Evaluate clusters (with local entry numbers) and number of entries for this file
-      const auto &treeNames = std::vector<std::string>({fTreeNames[fileIdx]});
-      const auto &fileNames = std::vector<std::string>({fFileNames[fileIdx]});
-      const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
-      const auto &clusters = clustersAndEntries.first[0];
-      const auto &entries = clustersAndEntries.second[0];
-      auto processCluster = [&](const EntryRange &c) {
-         auto r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries});
-         func(*r);
-      };
-      fPool.Foreach(processCluster, clusters);
-   };
-
    const auto firstNonEmpty =
       fGlobalRange.first > 0u ? std::distance(allClusters.begin(), std::find_if(allClusters.begin(), allClusters.end(),
                                                                                 [](auto &c) { return !c.empty(); }))
@@ -505,11 +493,97 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
 
    std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
    std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
+   const auto nFiles = fileIdxs.size();
+   std::unique_ptr<RFileTasks[]> files(new RFileTasks[nFiles]);
+
+   // Retrieve the clusters of a file. It is called once per file, by the worker that starts it: the other workers
+   // only steal clusters from files that are ready, they never wait for a file to be opened.
+   auto initFile = [&](std::size_t i) -> RFileTasks & {
+      auto &file = files[i];
+      try {
+         if (shouldRetrieveAllClusters) {
+            file.fClusters = std::move(allClusters[fileIdxs[i]]);
+         } else {
+            // Evaluate clusters (with local entry numbers) and number of entries for this file
+            file.fTreeNames = {fTreeNames[fileIdxs[i]]};
+            file.fFileNames = {fFileNames[fileIdxs[i]]};
+            auto clustersAndEntries = MakeClusters(file.fTreeNames, file.fFileNames);
+            file.fClusters = std::move(clustersAndEntries.first[0]);
+            file.fEntries = std::move(clustersAndEntries.second);
+         }
+      } catch (...) {
+         file.fState = RFileTasks::EState::kFailed;
+         throw;
+      }
+      file.fMaxChunkSize = std::max<std::size_t>(1, (file.fClusters.size() + maxTasksPerFile - 1) / maxTasksPerFile);
+      file.fState = RFileTasks::EState::kReady;
+      return file;
+   };
+
+   std::atomic<std::size_t> nextFile{0};
+   fWorkerStats.assign(nWorkers, RWorkerStats());
+   ROOT::Internal::RSlotStack slotStack(nWorkers);
+
+   auto worker = [&](unsigned int) {
+      auto processClusters = [&](RFileTasks &file, const EntryRange &range, bool stolen) {
+         ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
+         auto &stats = fWorkerStats[slotRAII.fSlot];
+         const auto start = Clock_t::now();
+         auto r = shouldRetrieveAllClusters
+                     ? fTreeView->GetTreeReader(range.first, range.second, fTreeNames, fFileNames, fFriendInfo,
+                                                fEntryList, allEntries)
+                     : fTreeView->GetTreeReader(range.first, range.second, file.fTreeNames, file.fFileNames,
+                                                fFriendInfo, fEntryList, file.fEntries);
+         func(*r);
+         stats.fBusyTime += std::chrono::duration<double>(Clock_t::now() - start).count();
+         ++stats.fNTasks;
+         if (stolen)
+            ++stats.fNStolenTasks;
+      };
 
-   if (shouldRetrieveAllClusters)
-      fPool.Foreach(processFileUsingGlobalClusters, fileIdxs);
-   else
-      fPool.Foreach(processFileRetrievingClusters, fileIdxs);
+      EntryRange range;
+      // Start files that no other worker has started yet, in order
+      for (auto i = nextFile++; i < nFiles; i = nextFile++) {
+         RFileTasks &file = initFile(i);
+         while (ClaimClusters(file, nWorkers, range))
+            processClusters(file, range, /*stolen=*/false);
+      }
+
+      // All files have been started: help with the file that has the most clusters left
+      while (true) {
+         RFileTasks *victim = nullptr;
+         std::size_t maxLeft = 0;
+         bool filesBeingOpened = false;
+         for (std::size_t i = 0; i < nFiles; ++i) {
+            RFileTasks &file = files[i];
+            const auto state = file.fState.load();
+            if (state != RFileTasks::EState::kReady) {
+               filesBeingOpened |= state == RFileTasks::EState::kNotStarted;
+               continue;
+            }
+            const auto next = file.fNextCluster.load();
+            const auto nLeft = next < file.fClusters.size() ? file.fClusters.size() - next : 0;
+            if (nLeft > maxLeft) {
+               maxLeft = nLeft;
+               victim = &file;
+            }
+         }
+         if (victim) {
+            if (ClaimClusters(*victim, nWorkers, range))
+               processClusters(*victim, range, /*stolen=*/true);
+         } else if (filesBeingOpened) {
+            // the last files are still being opened by other workers, their clusters will be available soon
+            std::this_thread::yield();
+         } else {
+            break;
+         }
+      }
+   };
+   fPool.Foreach(worker, ROOT::TSeqU(nWorkers));
+
+   const auto wallTime = std::chrono::duration<double>(Clock_t::now() - processStart).count();
+   for (auto &stats : fWorkerStats)
+      stats.fIdleTime = std::max(0., wallTime - stats.fBusyTime);
 
    // make sure TChains and TFiles are cleaned up since they are not globally tracked
    for (unsigned int islot = 0; islot < fTreeView.GetNSlots(); ++islot) {
@@ -523,6 +597,10 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
 ////////////////////////////////////////////////////////////////////////
 /// \brief Retrieve the current value for the desired number of tasks per worker.
 /// \return The desired number of tasks to be created per worker. TTreeProcessorMT uses this value as an hint.
+///
+/// The hint bounds the number of clusters processed by a single task: clusters are grouped so that at least about
+/// this number of tasks per worker is created. Towards the end of each file tasks get smaller, so that the actual
+/// number of tasks is larger.
 unsigned int TTreeProcessorMT::GetTasksPerWorkerHint()
 {
    return fgTasksPerWorkerHint;
@@ -17,11 +17,13 @@
 #include "TBranchSTL.h"
 #include "TBranchObject.h"
 #include "TBranchProxyDirector.h"
+#include "TBufferFile.h"
 #include "TClassEdit.h"
 #include "TFriendElement.h"
 #include "TFriendProxy.h"
 #include "TLeaf.h"
 #include "TList.h"
+#include "TMath.h"
 #include "TROOT.h"
 #include "TStreamerInfo.h"
 #include "TStreamerElement.h"
@@ -30,6 +32,7 @@
 #include "TRegexp.h"
 
 #include <memory>
+#include <vector>
 
 // pin vtable
 ROOT::Internal::TVirtualCollectionReader::~TVirtualCollectionReader() {}
@@ -386,6 +389,65 @@ namespace {
          return TDynamicArrayReader<TLeafReader>::GetSize(proxy);
       }
    };
+
+   // Reader interface for branches that support bulk reads with offsets, see TBranch::GetEntriesWithOffsets():
+   // the values of all the entries of a basket are deserialized at once in a contiguous buffer, from which the
+   // entries are then served without going through the branch proxy.
+   class TBulkArrayReader final : public TVirtualCollectionReader {
+   private:
+      TTreeReader *fTreeReader;
+      Int_t fValueSize;
+      TBufferFile fBuffer{TBuffer::kWrite, 32 * 1024};
+      std::vector<Int_t> fOffsets; // Offsets of the entries in the buffer, in number of values
+      TBranch *fBranch = nullptr;  // Branch the buffer was read from
+      Int_t fTreeNumber = -1;      // Number of the tree of fBranch in the chain
+      Long64_t fFirst = -1;        // First entry in the buffer
+      Int_t fNEntries = 0;         // Number of entries in the buffer
+
+      // Return the index of the current entry in the buffer, reading the basket that holds it if needed.
+      Int_t GetIndex(ROOT::Detail::TBranchProxy *proxy) {
+         if (!proxy->IsInitialized() && !proxy->Setup()) {
+            fReadStatus = TTreeReaderValueBase::kReadError;
+            Error("TBulkArrayReader::GetIndex()", "Unable to initialize %s.", proxy->GetBranchName());
+            return -1;
+         }
+         TBranch *branch = proxy->GetBranch();
+         const Long64_t entry = proxy->GetReadEntry();
+         const Int_t treeNumber = fTreeReader->GetTree()->GetTreeNumber();
+         if (branch != fBranch || treeNumber != fTreeNumber || entry < fFirst || entry >= fFirst + fNEntries) {
+            fBranch = nullptr;
+            const Int_t basket = TMath::BinarySearch(branch->GetWriteBasket() + 1, branch->GetBasketEntry(), entry);
+            const Long64_t first = basket < 0 ? entry : branch->GetBasketEntry()[basket];
+            fNEntries = branch->GetBulkRead().GetEntriesWithOffsets(first, fBuffer, fOffsets);
+            if (fNEntries <= 0 || entry >= first + fNEntries) {
+               fReadStatus = TTreeReaderValueBase::kReadError;
+               Error("TBulkArrayReader::GetIndex()", "Read error in branch %s at entry %lld.", branch->GetName(),
+                     entry);
+               return -1;
+            }
+            fBranch = branch;
+            fTreeNumber = treeNumber;
+            fFirst = first;
+         }
+         fReadStatus = TTreeReaderValueBase::kReadSuccess;
+         return entry - fFirst;
+      }
+
+   public:
+      TBulkArrayReader(TTreeReader *treeReader, Int_t valueSize) : fTreeReader(treeReader), fValueSize(valueSize) {}
+
+      size_t GetSize(ROOT::Detail::TBranchProxy *proxy) final {
+         const Int_t index = GetIndex(proxy);
+         return index < 0 ? 0 : fOffsets[index + 1] - fOffsets[index];
+      }
+
+      void *At(ROOT::Detail::TBranchProxy *proxy, size_t idx) final {
+         const Int_t index = GetIndex(proxy);
+         return index < 0 ? nullptr : fBuffer.GetCurrent() + (fOffsets[index] + idx) * fValueSize;
+      }
+
+      bool IsContiguous() const final { return true; }
+   };
 }
 
 
@@ -651,6 +713,21 @@ void ROOT::Internal::TTreeReaderArrayBase::SetImpl(TBranch* branch, TLeaf* myLea
    // A proxy for branch must not have been created before (i.e. check
    // fProxies before calling this function!)
 
+   // Collections of fundamental types are read a basket at a time when the branch supports it. This is not done
+   // for branches of friend trees, whose entries are not known to us, nor for variable-size multi-dimensional
+   // arrays, whose size is the number of rows rather than the number of values.
+   EDataType bulkType = kOther_t;
+   auto basicType = dynamic_cast<TDataType *>(fDict);
+   auto topLeaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->At(0));
+   if (!myLeaf && basicType && branch->GetTree() == fTreeReader->GetTree()->GetTree() &&
+       branch->GetBulkRead().SupportsBulkReadWithOffsets(&bulkType) && bulkType == basicType->GetType() &&
+       !(topLeaf->GetLeafCount() && topLeaf->GetLenStatic() > 1)) {
+      fImpl = std::make_unique<TBulkArrayReader>(fTreeReader, basicType->Size());
+      if (fSetupStatus == kSetupInternalError)
+         fSetupStatus = kSetupMatch;
+      return;
+   }
+
    if (myLeaf){
       if (!myLeaf->GetLeafCount()){
          fImpl = std::make_unique<TLeafReader>(this);
@@ -300,21 +300,37 @@ TEST(TreeProcessorMT, LimitNTasks_CheckEntries)
    ROOT::TTreeProcessorMT p(filename, treename);
    p.Process(f);
 
+   // Tasks group at most ceil(991 / (10 * nslots)) clusters of one entry each, then they get smaller towards the end
+   // of the file. The task sizes do not depend on the scheduling.
    if (nslots == 4) {
-      EXPECT_EQ(nTasks, 40U) << "Wrong number of tasks generated!\n";
-      EXPECT_EQ(nEntriesCountsMap[24], 9U) << "Wrong number of tasks with 24 clusters each!\n";
-      EXPECT_EQ(nEntriesCountsMap[25], 31U) << "Wrong number of tasks with 25 clusters each!\n";
+      EXPECT_EQ(nTasks, 68U) << "Wrong number of tasks generated!\n";
+      EXPECT_EQ(nEntriesCountsMap[25], 32U) << "Wrong number of tasks with 25 clusters each!\n";
+      EXPECT_EQ(nEntriesCountsMap[1], 15U) << "Wrong number of tasks with 1 cluster each!\n";
+   } else if (nslots == 2) {
+      EXPECT_EQ(nTasks, 35U) << "Wrong number of tasks generated!\n";
+      EXPECT_EQ(nEntriesCountsMap[50], 16U) << "Wrong number of tasks with 50 clusters each!\n";
+      EXPECT_EQ(nEntriesCountsMap[1], 7U) << "Wrong number of tasks with 1 cluster each!\n";
+   } else if (nslots == 1) {
+      EXPECT_EQ(nTasks, 17U) << "Wrong number of tasks generated!\n";
+      EXPECT_EQ(nEntriesCountsMap[100], 8U) << "Wrong number of tasks with 100 clusters each!\n";
+      EXPECT_EQ(nEntriesCountsMap[1], 3U) << "Wrong number of tasks with 1 cluster each!\n";
    }
-   else if (nslots == 2) {
-      EXPECT_EQ(nTasks, 20U) << "Wrong number of tasks generated!\n";
-      EXPECT_EQ(nEntriesCountsMap[49], 9U) << "Wrong number of tasks with 49 clusters each!\n";
-      EXPECT_EQ(nEntriesCountsMap[50], 11U) << "Wrong number of tasks with 50 clusters each!\n";
-   }
-   else if (nslots == 1) {
-      EXPECT_EQ(nTasks, 10U) << "Wrong number of tasks generated!\n";
-      EXPECT_EQ(nEntriesCountsMap[99], 9U) << "Wrong number of tasks with 99 clusters each!\n";
-      EXPECT_EQ(nEntriesCountsMap[100], 1U) << "Wrong number of tasks with 100 clusters each!\n";
+   const unsigned int maxEntriesPerTask = (nEvents + 10 * nslots - 1) / (10 * nslots);
+   EXPECT_LE(nEntriesCountsMap.rbegin()->first, maxEntriesPerTask) << "Task with too many clusters!\n";
+   unsigned int nEntries = 0;
+   for (const auto &countAndTasks : nEntriesCountsMap)
+      nEntries += countAndTasks.first * countAndTasks.second;
+   EXPECT_EQ(nEntries, 991U);
+
+   const auto &stats = p.GetWorkerStats();
+   EXPECT_EQ(stats.size(), nslots);
+   ULong64_t nTasksFromStats = 0;
+   for (const auto &s : stats) {
+      nTasksFromStats += s.fNTasks;
+      EXPECT_GE(s.fBusyTime, 0.);
+      EXPECT_GE(s.fIdleTime, 0.);
    }
+   EXPECT_EQ(nTasksFromStats, nTasks);
 
    gSystem->Unlink(filename);
    ROOT::DisableImplicitMT();